@@ -290,6 +290,135 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_dropout(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_dropout(
         dnnl_primitive_attr_t attr, const_dnnl_memory_desc_t dropout_desc);
 
+/// Returns the parameters of the source normalization primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param flags Output normalization flags.
+/// @param epsilon Output epsilon value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_normalization(
+        const_dnnl_primitive_attr_t attr, unsigned *flags, float *epsilon);
+
+/// Sets the source normalization primitive attribute. The source tensor is
+/// normalized along its last dimension before it is consumed by the
+/// primitive, with the semantics of the layer normalization primitive.
+///
+/// The normalization statistics are computed by the primitive unless
+/// #dnnl_use_global_stats is set, in which case they are passed as the
+/// #DNNL_ARG_ATTR_SRC_NORM_MEAN and #DNNL_ARG_ATTR_SRC_NORM_VARIANCE
+/// arguments. Scale and shift are passed as the #DNNL_ARG_ATTR_SRC_NORM_SCALE
+/// and #DNNL_ARG_ATTR_SRC_NORM_SHIFT arguments. All of them are f32.
+///
+/// @param attr Primitive attributes.
+/// @param flags Normalization flags, a combination of
+///     #dnnl_use_global_stats, #dnnl_use_scale, #dnnl_use_shift and
+///     #dnnl_rms_norm.
+/// @param epsilon Epsilon value added to the variance.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_normalization(
+        dnnl_primitive_attr_t attr, unsigned flags, float epsilon);
+
+/// Returns the parameters of the low-rank adaptation (LoRA) primitive
+/// attribute.
+///
+/// @param attr Primitive attributes.
+/// @param rank Output rank of the adapters.
+/// @param num_adapters Output number of adapters.
+/// @param alpha Output scaling factor of the update.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_lora(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *rank,
+        dnnl_dim_t *num_adapters, float *alpha);
+
+/// Sets the low-rank adaptation (LoRA) primitive attribute. The primitive
+/// adds the low-rank update `alpha * (src * A_i) * B_i` to its accumulator,
+/// where `i` is the adapter selected for the destination row.
+///
+/// The adapters are passed as the #DNNL_ARG_ATTR_LORA_A argument of shape
+/// `num_adapters x K x rank` and the #DNNL_ARG_ATTR_LORA_B argument of shape
+/// `num_adapters x rank x N`, both f32 with a plain layout. With more than
+/// one adapter, the #DNNL_ARG_ATTR_LORA_INDICES s32 argument holds the
+/// adapter of every destination row; a negative index means no adapter.
+///
+/// @param attr Primitive attributes.
+/// @param rank Rank of the adapters.
+/// @param num_adapters Number of adapters.
+/// @param alpha Scaling factor of the update.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_lora(dnnl_primitive_attr_t attr,
+        dnnl_dim_t rank, dnnl_dim_t num_adapters, float alpha);
+
+/// Returns the number of destination tensors of the destination split
+/// primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param ndsts Output number of destination tensors. Zero means the
+///     destination is not split.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_split(
+        const_dnnl_primitive_attr_t attr, int *ndsts);
+
+/// Returns a memory descriptor of the destination split primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param index Index of the destination tensor.
+/// @param dst_desc Output memory descriptor of the destination tensor.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_split_desc(
+        const_dnnl_primitive_attr_t attr, int index,
+        const_dnnl_memory_desc_t *dst_desc);
+
+/// Sets the destination split primitive attribute. The columns of the
+/// destination are written to @p ndsts tensors instead of one, in order:
+/// the first tensor gets the first columns, the second one the following
+/// columns, and so on. The tensors are passed as the
+/// #DNNL_ARG_MULTIPLE_DST + `i` arguments and #DNNL_ARG_DST is not used.
+///
+/// A tensor either has the shape of the destination with its own number of
+/// columns `N_i`, or an extra dimension in front of the rows splitting the
+/// columns into heads: `... x H_i x M x D_i` with `H_i * D_i = N_i`. Every
+/// tensor has its own data type and layout, and can be quantized with its
+/// own scale set for the #DNNL_ARG_MULTIPLE_DST + `i` argument.
+///
+/// @param attr Primitive attributes.
+/// @param ndsts Number of destination tensors, from 1 to 8.
+/// @param dst_descs Memory descriptors of the destination tensors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_split(
+        dnnl_primitive_attr_t attr, int ndsts,
+        const_dnnl_memory_desc_t const *dst_descs);
+
+/// Returns the batch statistics primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Output value: non-zero if the primitive computes the batch
+///     statistics of the destination.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_batch_stats(
+        const_dnnl_primitive_attr_t attr, int *enabled);
+
+/// Sets the batch statistics primitive attribute. A forward convolution with
+/// the attribute also computes the mean and the variance of every channel of
+/// the destination over the mini-batch and the spatial dimensions. They are
+/// written to the f32 one-dimensional #DNNL_ARG_MEAN and #DNNL_ARG_VARIANCE
+/// tensors in the form a batch normalization primitive takes them with the
+/// #dnnl_use_global_stats flag.
+///
+/// @param attr Primitive attributes.
+/// @param enabled Non-zero to compute the batch statistics.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_batch_stats(
+        dnnl_primitive_attr_t attr, int enabled);
+
 /// Returns the floating-point math mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -357,6 +486,31 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the constant weights primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output constant weights attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_constant_weights(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the constant weights primitive attribute value.
+///
+/// When set, the user guarantees that the contents of a weights buffer passed
+/// to the primitive do not change while the primitive exists. The primitive
+/// may then compute data that depends only on the weights, such as
+/// zero-point compensations, once per weights buffer and reuse it in the
+/// following executions. The attribute is a hint and does not affect the
+/// choice of implementation.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set constant weights attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_constant_weights(
+        dnnl_primitive_attr_t attr, int value);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -501,8 +655,8 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_v2(
 ///     that has correspondence mask @p mask set.
 /// @param data_type Scaling factors data_type.
 /// @param is_on_host Indicates whether the scale is a host-side scalar.
-/// @param qmode Quantization mode, can be #dnnl_quantization_mode_static_sazp
-///     or #dnnl_quantization_mode_dynamic_mx
+/// @param qmode Quantization mode, can be #dnnl_quantization_mode_static_sazp,
+///     #dnnl_quantization_mode_dynamic_mx or #dnnl_quantization_mode_dynamic_fp
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_v3(
@@ -1061,6 +1215,34 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_csr_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz, dnnl_data_type_t indices_dt,
         dnnl_data_type_t pointers_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into dense blocks of @p block_dims and only the
+/// blocks that contain non-zero entries are stored. The created memory
+/// descriptor will describe a memory object that contains 3 buffers.
+/// The buffers have the following meaning and assigned numbers (index):
+///  - 0: values of the non-zero blocks, each block stored in row-major
+///       order, blocks ordered by block row
+///  - 1: block column indices of the non-zero blocks
+///  - 2: block row pointers
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions. Each dimension must be divisible by the
+///     corresponding block dimension.
+/// @param data_type Elements data type.
+/// @param nnz_blocks Number of non-zero blocks.
+/// @param block_dims Array of block dimensions.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz_blocks,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
 /// Creates a memory descriptor for COO encoding.
 ///
 /// The created memory descriptor will describe a memory object that
@@ -1108,6 +1290,36 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_packed_encoding(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_dim_t nnz);
 
+/// Creates a memory descriptor for N:M structured sparse encoding.
+///
+/// The tensor is expected to have at most @p n non-zero elements in each
+/// group of @p m consecutive elements along the reduction dimension, which
+/// is the second to last dimension. The number of non-zero entries is
+/// derived from the dimensions and the sparsity pattern.
+///
+/// The created memory descriptor cannot be used to create a memory
+/// object. It can only be used to create a primitive descriptor to
+/// query the actual memory descriptor (similar to the format tag
+/// `any`).
+///
+/// @warning
+///     The meaning and content of the handles of the memory object that
+///     is created using the queried memory descriptor are unspecified
+///     therefore using the content is an undefined behavior.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param n Maximum number of non-zero elements in a group.
+/// @param m Number of elements in a group.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @sa @ref dev_guide_sparsity
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_structured_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t n, dnnl_dim_t m);
+
 /// Creates a memory descriptor for a scalar value that resides on the host.
 ///
 /// @param memory_desc Output memory descriptor.
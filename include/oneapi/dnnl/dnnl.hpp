@@ -331,6 +331,11 @@ enum class quantization_mode {
     /// parameter is computed by oneDNN following the OCP MX spec
     /// formula and written as an output.
     dynamic_mx = dnnl_quantization_mode_dynamic_mx,
+    /// dynamic quantization mode with floating-point scales: quantization
+    /// parameter of a group is computed by oneDNN as the maximum absolute
+    /// value of the group divided by the largest value of the quantized data
+    /// type, and written as an output.
+    dynamic_fp = dnnl_quantization_mode_dynamic_fp,
 };
 
 /// Converts a quantization kind enum value from C++ API to C API type.
@@ -975,6 +980,14 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// An encoding that is used for an opaque storage schema for
+        /// tensors with N:M structured sparsity. A memory descriptor with
+        /// the structured encoding cannot be used to create a memory object.
+        /// It can only be used to create a primitive descriptor to query the
+        /// actual memory descriptor (similar to the format tag `any`).
+        structured = dnnl_structured,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
     };
 
     /// Memory format tag specification.
@@ -2916,6 +2929,47 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The tensor is split into dense blocks of @p block_dims and only
+        /// the blocks that contain non-zero entries are stored.
+        /// The created memory descriptor will describe a memory object that
+        /// contains 3 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values of the non-zero blocks (row-major blocks)
+        ///  - 1: block column indices
+        ///  - 2: block row pointers
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz_blocks Number of non-zero blocks.
+        /// @param block_dims Block dimensions.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type,
+                dim nnz_blocks, const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_container_size(block_dims,
+                    "dimensions of blocks do not match dimensions of tensor",
+                    (int)adims.size(), (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz_blocks, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for COO sparse encodings.
         ///
         /// The created memory descriptor will describe a memory object that
@@ -2984,6 +3038,47 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for N:M structured
+        /// sparse encoding.
+        ///
+        /// The tensor is expected to have at most @p n non-zero elements in
+        /// each group of @p m consecutive elements along the reduction
+        /// dimension, which is the second to last dimension.
+        ///
+        /// The created memory descriptor cannot be used to create a memory
+        /// object. It can only be used to create a primitive descriptor to
+        /// query the actual memory descriptor (similar to the format tag
+        /// `any`).
+        ///
+        /// @warning
+        ///     The meaning and content of the handles of the memory object that
+        ///     is created using the queried memory descriptor are unspecified
+        ///     therefore using the content is an undefined behavior.
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param n Maximum number of non-zero elements in a group.
+        /// @param m Number of elements in a group.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc structured(const dims &adims, data_type adata_type, dim n,
+                dim m, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_structured_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), n, m);
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for structured "
+                        "sparse encoding");
+            return desc {md};
+        }
+
         /// Creates a memory descriptor for a scalar value that resides on the host.
         ///
         /// @param adata_type Data type of the scalar.
@@ -4069,6 +4164,128 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set dropout primitive attribute");
     }
 
+    /// Returns the parameters of a source normalization attribute.
+    ///
+    /// @param flags Output normalization flags.
+    /// @param epsilon Output epsilon value.
+    void get_src_normalization(
+            normalization_flags &flags, float &epsilon) const {
+        unsigned c_flags;
+        error::wrap_c_api(dnnl_primitive_attr_get_src_normalization(
+                                  get(), &c_flags, &epsilon),
+                "could not get parameters of a source normalization "
+                "attribute");
+        flags = static_cast<normalization_flags>(c_flags);
+    }
+
+    /// Sets a source normalization attribute. The source tensor is
+    /// normalized along its last dimension before it is consumed by the
+    /// primitive, with the semantics of the layer normalization primitive.
+    ///
+    /// @param flags Normalization flags, a combination of
+    ///     #dnnl::normalization_flags::use_global_stats,
+    ///     #dnnl::normalization_flags::use_scale,
+    ///     #dnnl::normalization_flags::use_shift and
+    ///     #dnnl::normalization_flags::rms_norm.
+    /// @param epsilon Epsilon value added to the variance.
+    void set_src_normalization(normalization_flags flags, float epsilon) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_normalization(get(),
+                                  static_cast<unsigned>(flags), epsilon),
+                "could not set source normalization primitive attribute");
+    }
+
+    /// Returns the parameters of a low-rank adaptation (LoRA) attribute.
+    ///
+    /// @param rank Output rank of the adapters.
+    /// @param num_adapters Output number of adapters.
+    /// @param alpha Output scaling factor of the update.
+    void get_lora(memory::dim &rank, memory::dim &num_adapters,
+            float &alpha) const {
+        error::wrap_c_api(dnnl_primitive_attr_get_lora(
+                                  get(), &rank, &num_adapters, &alpha),
+                "could not get parameters of a LoRA attribute");
+    }
+
+    /// Sets a low-rank adaptation (LoRA) attribute. The primitive adds the
+    /// low-rank update `alpha * (src * A_i) * B_i` to its accumulator,
+    /// where `i` is the adapter selected for the destination row.
+    ///
+    /// @param rank Rank of the adapters.
+    /// @param num_adapters Number of adapters. With more than one adapter,
+    ///     the adapter of every destination row is passed as the
+    ///     #DNNL_ARG_ATTR_LORA_INDICES argument.
+    /// @param alpha Scaling factor of the update.
+    void set_lora(memory::dim rank, memory::dim num_adapters = 1,
+            float alpha = 1.f) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_lora(get(), rank, num_adapters, alpha),
+                "could not set LoRA primitive attribute");
+    }
+
+    /// Returns the memory descriptors of the destination split attribute.
+    ///
+    /// @returns Memory descriptors of the destination tensors, empty if the
+    ///     destination is not split.
+    std::vector<memory::desc> get_dst_split() const {
+        int ndsts = 0;
+        error::wrap_c_api(dnnl_primitive_attr_get_dst_split(get(), &ndsts),
+                "could not get parameters of a destination split attribute");
+        std::vector<memory::desc> dst_descs;
+        for (int i = 0; i < ndsts; i++) {
+            const_dnnl_memory_desc_t cdesc;
+            error::wrap_c_api(
+                    dnnl_primitive_attr_get_dst_split_desc(get(), i, &cdesc),
+                    "could not get parameters of a destination split "
+                    "attribute");
+            dnnl_memory_desc_t cloned_md = nullptr;
+            error::wrap_c_api(dnnl_memory_desc_clone(&cloned_md, cdesc),
+                    "could not clone a memory descriptor");
+            dst_descs.emplace_back(cloned_md);
+        }
+        return dst_descs;
+    }
+
+    /// Sets a destination split attribute. The columns of the destination
+    /// are written to several tensors, passed as the
+    /// #DNNL_ARG_MULTIPLE_DST + `i` arguments, instead of #DNNL_ARG_DST.
+    ///
+    /// @param dst_descs Memory descriptors of the destination tensors, in
+    ///     the order of their columns. A tensor either has the shape of the
+    ///     destination with its own number of columns, or an extra heads
+    ///     dimension in front of the rows.
+    void set_dst_split(const std::vector<memory::desc> &dst_descs) {
+        std::vector<const_dnnl_memory_desc_t> c_dst_descs;
+        c_dst_descs.reserve(dst_descs.size());
+        for (const auto &md : dst_descs)
+            c_dst_descs.push_back(md.get());
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_dst_split(get(),
+                        static_cast<int>(c_dst_descs.size()),
+                        c_dst_descs.data()),
+                "could not set destination split primitive attribute");
+    }
+
+    /// Returns whether the primitive computes the batch statistics of the
+    /// destination.
+    bool get_batch_stats() const {
+        int enabled = 0;
+        error::wrap_c_api(dnnl_primitive_attr_get_batch_stats(get(), &enabled),
+                "could not get batch statistics primitive attribute");
+        return enabled != 0;
+    }
+
+    /// Sets a batch statistics attribute. A forward convolution with the
+    /// attribute also writes the mean and the variance of every channel of
+    /// the destination to the #DNNL_ARG_MEAN and #DNNL_ARG_VARIANCE
+    /// arguments.
+    ///
+    /// @param enabled Whether to compute the batch statistics.
+    void set_batch_stats(bool enabled) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_batch_stats(get(), enabled ? 1 : 0),
+                "could not set batch statistics primitive attribute");
+    }
+
     /// Returns the fpmath mode
     fpmath_mode get_fpmath_mode() const {
         dnnl_fpmath_mode_t result;
@@ -4136,6 +4353,26 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the constant weights attribute value
+    bool get_constant_weights() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_constant_weights(get(), &result),
+                "could not get constant weights primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets constant weights attribute value
+    ///
+    /// @param value Whether the contents of the weights buffers passed to
+    ///     the primitive do not change. See
+    ///     #dnnl_primitive_attr_set_constant_weights().
+    void set_constant_weights(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_constant_weights(
+                                  get(), static_cast<int>(value)),
+                "could not set constant weights primitive attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -4212,8 +4449,8 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
     ///     that has correspondence mask @p mask set.
     /// @param data_type Scaling factors data_type.
     /// @param is_on_host Indicates whether the scaling factor is a host-side scalar.
-    /// @param qmode Quantization mode, can be #quantization_mode::static_sazp
-    ///     or #quantization_mode::dynamic_mx
+    /// @param qmode Quantization mode, can be #quantization_mode::static_sazp,
+    ///     #quantization_mode::dynamic_mx or #quantization_mode::dynamic_fp
     void set_scales(int arg, int mask, const memory::dims &groups,
             memory::data_type data_type = memory::data_type::f32,
             bool is_on_host = false,
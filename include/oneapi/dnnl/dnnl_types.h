@@ -77,6 +77,16 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// An encoding that is used for an opaque storage schema for
+    /// tensors with N:M structured sparsity, i.e. at most N non-zero
+    /// elements in each group of M consecutive elements along the
+    /// reduction dimension. Similar to the packed encoding, a memory
+    /// descriptor with the structured encoding cannot be used to create a
+    /// memory object. It can only be used to create a primitive descriptor
+    /// to query the actual memory descriptor.
+    dnnl_structured,
+    /// Block Compressed Sparse Row (BSR) encoding.
+    dnnl_bsr,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -2437,6 +2447,11 @@ typedef enum {
     /// parameter is computed by oneDNN following the OCP MX spec
     /// formula and written as an output.
     dnnl_quantization_mode_dynamic_mx,
+    /// dynamic quantization mode with floating-point scales: quantization
+    /// parameter of a group is computed by oneDNN as the maximum absolute
+    /// value of the group divided by the largest value of the quantized data
+    /// type, and written as an output.
+    dnnl_quantization_mode_dynamic_fp,
 } dnnl_quantization_mode_t;
 
 /// @struct dnnl_primitive_attr
@@ -2682,6 +2697,32 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_DIFF_SHIFT 256
 
+/// Mean of the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_MEAN 500
+
+/// Variance of the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_VARIANCE 501
+
+/// Scale of the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_SCALE 502
+
+/// Shift of the source normalization attribute.
+#define DNNL_ARG_ATTR_SRC_NORM_SHIFT 503
+
+/// Down-projection matrices (A) of the LoRA attribute.
+#define DNNL_ARG_ATTR_LORA_A 504
+
+/// Up-projection matrices (B) of the LoRA attribute.
+#define DNNL_ARG_ATTR_LORA_B 505
+
+/// Adapter indices of the destination rows for the LoRA attribute.
+#define DNNL_ARG_ATTR_LORA_INDICES 506
+
+/// Memory to prefetch into the cache hierarchy while the primitive executes,
+/// typically the weights of the primitive executed next. The values are not
+/// used in computations. Primitives that do not support the hint ignore it.
+#define DNNL_ARG_PREFETCH_HINT 507
+
 /// Rounding mode seed for stochastic rounding
 /// Single seed needed independently of how many arguments need stochastic rounding
 #define DNNL_ARG_ATTR_ROUNDING_SEED 508
@@ -239,6 +239,18 @@ def func_to_str(enum, values):
             '%sif (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";\n'
             % indent
         )
+        func += (
+            '%sif (v == dnnl::impl::primitive_kind::gated_mlp) return "gated_mlp";\n'
+            % indent
+        )
+        func += (
+            '%sif (v == dnnl::impl::primitive_kind::matmul_topk) return "matmul_topk";\n'
+            % indent
+        )
+        func += (
+            '%sif (v == dnnl::impl::primitive_kind::rope) return "rope";\n'
+            % indent
+        )
     if enum == "dnnl_alg_kind_t":
         func += (
             '%sif (v == dnnl::impl::alg_kind::softmax_accurate_inf_as_zero) return "softmax_accurate_inf_as_zero";\n'
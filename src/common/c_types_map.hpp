@@ -216,6 +216,7 @@ namespace quantization_mode {
 const quantization_mode_t undef = dnnl_quantization_mode_undef;
 const quantization_mode_t static_sazp = dnnl_quantization_mode_static_sazp;
 const quantization_mode_t dynamic_mx = dnnl_quantization_mode_dynamic_mx;
+const quantization_mode_t dynamic_fp = dnnl_quantization_mode_dynamic_fp;
 } // namespace quantization_mode
 
 using sparse_encoding_t = dnnl_sparse_encoding_t;
@@ -224,6 +225,8 @@ const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
 const sparse_encoding_t packed = dnnl_packed;
+const sparse_encoding_t structured = dnnl_structured;
+const sparse_encoding_t bsr = dnnl_bsr;
 } // namespace sparse_encoding
 
 using format_kind_t = dnnl_format_kind_t;
@@ -1994,6 +1997,10 @@ const primitive_kind_t group_normalization = dnnl_group_normalization;
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
 const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
+const primitive_kind_t gated_mlp = (primitive_kind_t)(internal_only_start + 2);
+const primitive_kind_t matmul_topk
+        = (primitive_kind_t)(internal_only_start + 3);
+const primitive_kind_t rope = (primitive_kind_t)(internal_only_start + 4);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -190,7 +190,8 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         const data_type_t dst_dt = desc.dst_desc.data_type;
 
         auto fwd_attr_mask = smask_t::post_ops | smask_t::sum_dt
-                | smask_t::fpmath_mode | smask_t::rounding_mode;
+                | smask_t::fpmath_mode | smask_t::rounding_mode
+                | smask_t::batch_stats;
         const bool is_gpu = engine->kind() == engine_kind::gpu;
 
         const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8)
@@ -252,7 +253,14 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             const auto &po = attr->post_ops_;
             using namespace primitive_kind;
             VCHECK_CONV_UNIMPL(po.has_default_values({binary, eltwise, prelu,
-                                       sum, convolution}),
+                                       sum, convolution, pooling}),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            // Check pooling: the last post-op of a 2D convolution
+            const int pool_idx = po.find(pooling);
+            VCHECK_CONV_UNIMPL(IMPLICATION(pool_idx != -1,
+                                       pool_idx == po.len() - 1
+                                               && desc.src_desc.ndims == 4),
                     VERBOSE_UNSUPPORTED_POSTOP);
 
             // Check sum
@@ -334,6 +334,10 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE))
+            return with_batch_stats() ? arg_usage_t::output
+                                      : arg_usage_t::unused;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -344,6 +348,8 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
             case DNNL_ARG_WEIGHTS: return weights_md(0);
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_MEAN:
+            case DNNL_ARG_VARIANCE: return stat_md();
             default: return convolution_pd_t::arg_md(arg);
         }
     }
@@ -371,13 +377,22 @@ struct convolution_fwd_pd_t : public convolution_pd_t {
                 + n_prelu_po_inputs();
     }
 
-    int n_outputs() const override { return 1; }
+    int n_outputs() const override { return 1 + 2 * with_batch_stats(); }
+
+    // The mean and the variance of every channel of the destination.
+    bool with_batch_stats() const {
+        return !attr()->batch_stats_.has_default_values();
+    }
+    const memory_desc_t *stat_md() const {
+        return with_batch_stats() ? &stat_md_ : &glob_zero_md;
+    }
 
 protected:
     memory_desc_t src_md_;
     memory_desc_t weights_md_;
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
+    memory_desc_t stat_md_;
 
     convolution_fwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const convolution_fwd_pd_t *hint_fwd_pd)
@@ -385,7 +400,13 @@ protected:
         , src_md_(desc_.src_desc)
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
-        , dst_md_(desc_.dst_desc) {}
+        , dst_md_(desc_.dst_desc) {
+        if (with_batch_stats()) {
+            const dims_t stat_dims = {desc_.dst_desc.dims[1]};
+            memory_desc_init_by_tag(
+                    stat_md_, 1, stat_dims, data_type::f32, format_tag::x);
+        }
+    }
 
     bool set_default_formats_common(
             format_tag_t src_tag, format_tag_t wei_tag, format_tag_t dst_tag) {
@@ -100,6 +100,8 @@ const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_csr) return "csr";
     if (v == dnnl_packed) return "packed";
     if (v == dnnl_coo) return "coo";
+    if (v == dnnl_structured) return "structured";
+    if (v == dnnl_bsr) return "bsr";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
@@ -1787,6 +1789,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_group_normalization) return "group_normalization";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
+    if (v == dnnl::impl::primitive_kind::gated_mlp) return "gated_mlp";
+    if (v == dnnl::impl::primitive_kind::matmul_topk) return "matmul_topk";
+    if (v == dnnl::impl::primitive_kind::rope) return "rope";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -1903,6 +1908,7 @@ const char *dnnl_quantization_mode2str(dnnl_quantization_mode_t v) {
     if (v == dnnl_quantization_mode_undef) return "undef";
     if (v == dnnl_quantization_mode_static_sazp) return "static_sazp";
     if (v == dnnl_quantization_mode_dynamic_mx) return "dynamic_mx";
+    if (v == dnnl_quantization_mode_dynamic_fp) return "dynamic_fp";
     assert(!"unknown quantization_mode");
     return "unknown quantization_mode";
 }
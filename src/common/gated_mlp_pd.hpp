@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATED_MLP_PD_HPP
+#define COMMON_GATED_MLP_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/gated_mlp_utils.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_GATED_MLP(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, gated_mlp, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_GATED_MLP_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, gated_mlp, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct gated_mlp_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::gated_mlp;
+
+    using base_class = gated_mlp_pd_t;
+    using hint_class = gated_mlp_pd_t;
+
+    const gated_mlp_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS_GATE,
+                    DNNL_ARG_WEIGHTS_UP, DNNL_ARG_WEIGHTS_DOWN))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_WEIGHTS_GATE: return weights_md(0);
+            case DNNL_ARG_WEIGHTS_UP: return weights_md(1);
+            case DNNL_ARG_WEIGHTS_DOWN: return weights_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.src_desc : &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.w_gate_desc;
+            case 1: return &desc_.w_up_desc;
+            case 2: return &desc_.w_down_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *w_gate_md() const { return &desc_.w_gate_desc; }
+    const memory_desc_t *w_up_md() const { return &desc_.w_up_desc; }
+    const memory_desc_t *w_down_md() const { return &desc_.w_down_desc; }
+
+    int n_inputs() const override { return 4; }
+    int n_outputs() const override { return 1; }
+
+    dim_t MB() const { return desc_.mb(); }
+    dim_t IC() const { return desc_.ic(); }
+    dim_t HIDDEN() const { return desc_.hidden(); }
+    dim_t OC() const { return desc_.oc(); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim()
+                || memory_desc_wrapper(desc_.w_gate_desc).has_zero_dim()
+                || memory_desc_wrapper(desc_.dst_desc).has_zero_dim();
+    }
+
+protected:
+    gated_mlp_desc_t desc_;
+
+    gated_mlp_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<gated_mlp_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto md : {&desc_.src_desc, &desc_.w_gate_desc, &desc_.w_up_desc,
+                     &desc_.w_down_desc, &desc_.dst_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok
+                        && memory_desc_init_by_tag(*md, format_tag::ab)
+                                == status::success;
+        }
+        return ok;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
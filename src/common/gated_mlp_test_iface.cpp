@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/gated_mlp_pd.hpp"
+#include "common/gated_mlp_types.hpp"
+#include "common/gated_mlp_utils.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "opdesc.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API gated_mlp_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t w_gate_desc,
+        const_dnnl_memory_desc_t w_up_desc,
+        const_dnnl_memory_desc_t w_down_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_alg_kind_t activation,
+        float alpha, float beta, const_dnnl_primitive_attr_t attr) {
+    CHECK(gated_mlp_desc_check(src_desc, w_gate_desc, w_up_desc, w_down_desc,
+            dst_desc, activation));
+
+    dnnl::impl::gated_mlp_desc_t gated_mlp_desc
+            = dnnl::impl::create_gated_mlp_desc(src_desc, w_gate_desc,
+                    w_up_desc, w_down_desc, dst_desc, activation, alpha, beta);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&gated_mlp_desc, nullptr, attr);
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_GATED_MLP_TYPES_HPP
+#define COMMON_GATED_MLP_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_WEIGHTS_GATE DNNL_ARG_WEIGHTS_0
+#define DNNL_ARG_WEIGHTS_UP DNNL_ARG_WEIGHTS_1
+#define DNNL_ARG_WEIGHTS_DOWN DNNL_ARG_WEIGHTS_2
+
+// A descriptor for a gated multi-layer perceptron (gated MLP) operation:
+//   dst = (act(src * W_gate) x (src * W_up)) * W_down
+// where `x` is the elementwise multiplication.
+struct gated_mlp_desc_t : public op_desc_t {
+    gated_mlp_desc_t() : op_desc_t(primitive_kind::gated_mlp) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<gated_mlp_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* [mb, ic] */
+    memory_desc_t w_gate_desc; /* [ic, hidden] */
+    memory_desc_t w_up_desc; /* [ic, hidden] */
+    memory_desc_t w_down_desc; /* [hidden, oc] */
+    memory_desc_t dst_desc; /* [mb, oc] */
+
+    // Activation of the gate projection and its parameters, with the
+    // semantics of the eltwise primitive.
+    alg_kind_t activation = alg_kind::eltwise_swish;
+    float alpha = 1.f;
+    float beta = 0.f;
+
+    // Number of tokens.
+    dnnl_dim_t mb() const { return src_desc.dims[0]; }
+    // Number of input channels.
+    dnnl_dim_t ic() const { return src_desc.dims[1]; }
+    // Size of the hidden layer.
+    dnnl_dim_t hidden() const { return w_gate_desc.dims[1]; }
+    // Number of output channels.
+    dnnl_dim_t oc() const { return dst_desc.dims[1]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_GATED_MLP_TYPES_HPP
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_GATED_MLP_UTILS_HPP
+#define COMMON_GATED_MLP_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/gated_mlp_types.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_GATED_MLP(f, msg, ...) \
+    VCHECK(primitive, create, check, gated_mlp, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_GATED_MLP_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, gated_mlp, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t gated_mlp_desc_check(const memory_desc_t *src_desc,
+        const memory_desc_t *w_gate_desc, const memory_desc_t *w_up_desc,
+        const memory_desc_t *w_down_desc, const memory_desc_t *dst_desc,
+        alg_kind_t activation) {
+    VCHECK_GATED_MLP_COND(!utils::any_null(src_desc, w_gate_desc, w_up_desc,
+                                  w_down_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_GATED_MLP_COND(utils::everyone_is(2, src_desc->ndims,
+                                  w_gate_desc->ndims, w_up_desc->ndims,
+                                  w_down_desc->ndims, dst_desc->ndims),
+            VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+
+    VCHECK_GATED_MLP_COND(src_desc->dims[1] == w_gate_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "w_gate", 0);
+    VCHECK_GATED_MLP_COND(src_desc->dims[1] == w_up_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "w_up", 0);
+    VCHECK_GATED_MLP_COND(w_gate_desc->dims[1] == w_up_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "w_gate", 1, "w_up", 1);
+    VCHECK_GATED_MLP_COND(w_gate_desc->dims[1] == w_down_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "w_gate", 1, "w_down", 0);
+    VCHECK_GATED_MLP_COND(dst_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    VCHECK_GATED_MLP_COND(dst_desc->dims[1] == w_down_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "w_down", 1);
+
+    using namespace alg_kind;
+    VCHECK_GATED_MLP_COND(utils::one_of(activation, eltwise_swish,
+                                  eltwise_gelu_erf, eltwise_gelu_tanh,
+                                  eltwise_relu),
+            VERBOSE_BAD_ALGORITHM);
+
+    VCHECK_GATED_MLP_COND(!any_memory_desc_host_scalar(src_desc, w_gate_desc,
+                                  w_up_desc, w_down_desc, dst_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    return status::success;
+}
+
+static inline gated_mlp_desc_t create_gated_mlp_desc(
+        const memory_desc_t *src_md, const memory_desc_t *w_gate_md,
+        const memory_desc_t *w_up_md, const memory_desc_t *w_down_md,
+        const memory_desc_t *dst_md, alg_kind_t activation, float alpha,
+        float beta) {
+    auto gated_mlp_desc = gated_mlp_desc_t();
+    gated_mlp_desc.primitive_kind = primitive_kind::gated_mlp;
+    gated_mlp_desc.src_desc = *src_md;
+    gated_mlp_desc.w_gate_desc = *w_gate_md;
+    gated_mlp_desc.w_up_desc = *w_up_md;
+    gated_mlp_desc.w_down_desc = *w_down_md;
+    gated_mlp_desc.dst_desc = *dst_md;
+    gated_mlp_desc.activation = activation;
+    gated_mlp_desc.alpha = alpha;
+    gated_mlp_desc.beta = beta;
+    return gated_mlp_desc;
+}
+
+static inline status_t create_gated_mlp_pd(
+        std::shared_ptr<primitive_desc_t> &gated_mlp_pd_, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *w_gate_md,
+        const memory_desc_t *w_up_md, const memory_desc_t *w_down_md,
+        const memory_desc_t *dst_md, alg_kind_t activation, float alpha,
+        float beta, const primitive_attr_t *attr) {
+    CHECK(gated_mlp_desc_check(
+            src_md, w_gate_md, w_up_md, w_down_md, dst_md, activation));
+
+    auto gated_mlp_desc = create_gated_mlp_desc(src_md, w_gate_md, w_up_md,
+            w_down_md, dst_md, activation, alpha, beta);
+
+    primitive_attr_t gated_mlp_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&gated_mlp_desc, &gated_mlp_attr, nullptr);
+
+    gated_mlp_pd_ = *(++it);
+    VCHECK_GATED_MLP_COND(
+            gated_mlp_pd_, "failed to create the gated MLP primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
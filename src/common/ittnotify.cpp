@@ -80,6 +80,9 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(layer_normalization),
             CASE(group_normalization),
             CASE(sdpa),
+            CASE(gated_mlp),
+            CASE(matmul_topk),
+            CASE(rope),
     };
 #undef CASE
     int kind_idx = (int)kind;
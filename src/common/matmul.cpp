@@ -50,7 +50,7 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     auto attr_mask = smask_t::post_ops | smask_t::sum_dt | smask_t::dropout
-            | smask_t::rounding_mode;
+            | smask_t::rounding_mode | smask_t::dst_split;
     // Matmul supports scales for floating point data types
     attr_mask |= smask_t::scales_data_type;
 
@@ -63,6 +63,10 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     if (src_is_int8 || src_is_fp8 || src_is_fp4)
         attr_mask |= smask_t::zero_points;
     if (src_is_int8) attr_mask |= smask_t::precomputed_reductions;
+    // Source normalization and LoRA adapters are defined for floating point
+    // sources only.
+    if (utils::one_of(src_dt, data_type::f32, data_type::bf16, data_type::f16))
+        attr_mask |= smask_t::src_norm | smask_t::lora;
 
     // Matmul supports zero points for floating point data types as part of
     // weights decompression.
@@ -82,8 +86,14 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
             = utils::one_of(dst_dt, data_type::f8_e5m2, data_type::f8_e4m3);
     const bool dst_is_fp4
             = utils::one_of(dst_dt, data_type::f4_e2m1, data_type::f4_e3m0);
-    // grouped dst scales are supported for mxfp
-    if (dst_is_fp8 || dst_is_fp4) attr_mask |= smask_t::scales_groups;
+    const bool dst_is_int8
+            = utils::one_of(dst_dt, data_type::s8, data_type::u8);
+    // grouped dst scales are supported for mxfp and dynamic quantization
+    const bool dst_dyn_fp
+            = attr->scales_.get(DNNL_ARG_DST).get_quantization_mode()
+            == quantization_mode::dynamic_fp;
+    if (dst_is_fp8 || dst_is_fp4 || (dst_is_int8 && dst_dyn_fp))
+        attr_mask |= smask_t::scales_groups;
 
     // Matmul supports fpmath mode and accumulation mode
     attr_mask |= smask_t::fpmath_mode | smask_t::accumulation_mode;
@@ -183,6 +193,17 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
         }
 
+        // Split destination tensors support a single scale each.
+        const int ndsts = attr->dst_split_.ndsts();
+        for (int i = 0; i < dst_split_t::max_ndsts; i++) {
+            const int arg = DNNL_ARG_MULTIPLE_DST + i;
+            if (sc.has_default_values(arg)) continue;
+            VCHECK_MATMUL_UNIMPL(i < ndsts && sc.get_mask(arg) == 0
+                            && sc.get(arg).has_default_groups()
+                            && sc.get_data_type(arg) == data_type::f32,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+
         // Check dependency between scales.
         // Source scales groups are supported for int8 source and must divide
         // or be divided by weights groups when both are greater than 1.
@@ -207,6 +228,27 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
                     sc.get_data_type(DNNL_ARG_DST) == data_type::e8m0,
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
         }
+
+        // Dynamic quantization computes a floating-point scale per row or per
+        // group of a row of an int8 or fp8 destination.
+        if (dst_dyn_fp) {
+            VCHECK_MATMUL_UNIMPL(sc.get_mask(DNNL_ARG_DST) == full_tensor_mask,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            const dim_t group_n = sc.get_group(DNNL_ARG_DST, -1);
+            VCHECK_MATMUL_UNIMPL(sc.get_group(DNNL_ARG_DST, -2) == 1
+                            && group_n > 0 && N != DNNL_RUNTIME_DIM_VAL
+                            && N % group_n == 0,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VCHECK_MATMUL_UNIMPL(utils::one_of(sc.get_data_type(DNNL_ARG_DST),
+                                         data_type::f32, data_type::bf16,
+                                         data_type::f16),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VCHECK_MATMUL_UNIMPL(dst_is_int8 || dst_is_fp8,
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VCHECK_MATMUL_UNIMPL(
+                    attr->zero_points_.has_default_values(DNNL_ARG_DST),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+        }
     }
 
     // Check zero points
@@ -343,14 +385,58 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         }
     }
 
+    // Check destination split: the tensors take the destination columns in
+    // order. A tensor either has the shape of the destination, or its columns
+    // are split into heads placed in front of the rows.
+    if (!attr->dst_split_.has_default_values()) {
+        const auto &dst_split = attr->dst_split_;
+        const auto &dst_d = desc.dst_desc;
+        const int ndims_dst = dst_d.ndims;
+        dim_t split_N = 0;
+        for (int i = 0; i < dst_split.ndsts(); i++) {
+            const memory_desc_t &md = dst_split.dsts_[i];
+            const bool with_heads = md.ndims == ndims_dst + 1;
+            VCHECK_MATMUL_UNIMPL(md.ndims == ndims_dst || with_heads,
+                    VERBOSE_BAD_NDIMS, "dst_split", md.ndims);
+            for (int d = 0; d < ndims_dst - 2; d++)
+                VCHECK_MATMUL_UNIMPL(md.dims[d] == dst_d.dims[d],
+                        VERBOSE_INCONSISTENT_DIM, "dst_split", d, "dst", d);
+            VCHECK_MATMUL_UNIMPL(
+                    md.dims[md.ndims - 2] == dst_d.dims[ndims_dst - 2],
+                    VERBOSE_INCONSISTENT_DIM, "dst_split", md.ndims - 2, "dst",
+                    ndims_dst - 2);
+            const dim_t D = md.dims[md.ndims - 1];
+            split_N += with_heads ? md.dims[md.ndims - 3] * D : D;
+        }
+        VCHECK_MATMUL_UNIMPL(split_N == dst_d.dims[ndims_dst - 1],
+                VERBOSE_BAD_DIM, "dst_split", ndims_dst - 1);
+        // The destination itself is not written.
+        VCHECK_MATMUL_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_DST)
+                        && attr->zero_points_.has_default_values(DNNL_ARG_DST),
+                VERBOSE_UNSUPPORTED_ATTR);
+    }
+
     // Check post-ops
     if (!attr->post_ops_.has_default_values()) {
         const auto &po = attr->post_ops_;
         using namespace primitive_kind;
         VCHECK_MATMUL_UNIMPL(
-                po.has_default_values({binary, eltwise, prelu, sum}),
+                po.has_default_values({binary, eltwise, prelu, rope, sum}),
                 VERBOSE_UNSUPPORTED_POSTOP);
 
+        // Check RoPE: the destination rows are split into whole heads
+        for (int idx = 0; idx < po.len(); ++idx) {
+            if (!po.entry_[idx].is_rope()) continue;
+            VCHECK_MATMUL_UNIMPL(
+                    utils::one_of(dst_dt, data_type::f32, data_type::bf16,
+                            data_type::f16),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VCHECK_MATMUL_UNIMPL(IMPLICATION(!is_runtime_value(N),
+                                         N % po.entry_[idx].rope.head_size
+                                                 == 0),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+        }
+
         // Check sum
         VCHECK_MATMUL_UNIMPL(
                 po.check_sum_consistency(dst_dt, src_is_int8, true),
@@ -70,7 +70,14 @@ struct matmul_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_REDUCE)
             return with_reduce() ? arg_usage_t::output : arg_usage_t::unused;
-        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        // With the destination split, the columns of the destination go to
+        // several tensors instead.
+        if (arg == DNNL_ARG_DST)
+            return with_dst_split() ? arg_usage_t::unused
+                                    : arg_usage_t::output;
+        if (arg >= DNNL_ARG_MULTIPLE_DST
+                && arg < DNNL_ARG_MULTIPLE_DST + n_split_dsts())
+            return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
     }
@@ -83,7 +90,12 @@ struct matmul_pd_t : public primitive_desc_t {
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             case DNNL_ARG_REDUCE: return reduce_md(0);
-            default: return primitive_desc_t::arg_md(arg);
+            default:
+                if (arg >= DNNL_ARG_MULTIPLE_DST
+                        && arg < DNNL_ARG_MULTIPLE_DST + n_split_dsts())
+                    return &attr()->dst_split_.dsts_[arg
+                            - DNNL_ARG_MULTIPLE_DST];
+                return primitive_desc_t::arg_md(arg);
         }
     }
 
@@ -114,9 +126,12 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs()
+                + n_rope_po_inputs();
+    }
+    int n_outputs() const override {
+        return (with_dst_split() ? n_split_dsts() : 1) + with_reduce();
     }
-    int n_outputs() const override { return 1 + with_reduce(); }
 
     bool has_zero_dim_memory() const {
         return memory_desc_wrapper(src_md(0)).has_zero_dim()
@@ -134,6 +149,10 @@ struct matmul_pd_t : public primitive_desc_t {
 
     bool with_bias() const { return bias_md_.ndims != 0; }
     bool with_reduce() const { return reduce_md_.ndims != 0; }
+    bool with_dst_split() const {
+        return !attr()->dst_split_.has_default_values();
+    }
+    int n_split_dsts() const { return attr()->dst_split_.ndsts(); }
 
     matmul_reduce_kind_t reduce_kind() const { return desc_.reduce_kind; }
 
@@ -242,6 +261,9 @@ struct matmul_pd_t : public primitive_desc_t {
                                 (M() % scales.get_group(arg, -2)) == 0
                                         && (N() % scales.get_group(arg, -1))
                                                 == 0);
+            } else if (arg & DNNL_ARG_MULTIPLE_DST) {
+                // Every split destination tensor has a single scale.
+                ok = ok && mask == 0;
             } else {
                 assert(!"Unsupported arg");
             }
@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_MATMUL_TOPK_PD_HPP
+#define COMMON_MATMUL_TOPK_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/matmul_topk_utils.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_MATMUL_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, matmul_topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_MATMUL_TOPK_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, matmul_topk, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct matmul_topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::matmul_topk;
+
+    using base_class = matmul_topk_pd_t;
+    using hint_class = matmul_topk_pd_t;
+
+    const matmul_topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS))
+            return arg_usage_t::input;
+
+        if (utils::one_of(arg, DNNL_ARG_DST_VALUES, DNNL_ARG_DST_INDICES))
+            return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_DST_VALUES: return dst_md(0, user_input);
+            case DNNL_ARG_DST_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.src_desc : &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.weights_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.dst_values_desc;
+            case 1: return &desc_.dst_indices_desc;
+            default: return &glob_zero_md;
+        }
+    }
+
+    const memory_desc_t *dst_values_md() const {
+        return &desc_.dst_values_desc;
+    }
+    const memory_desc_t *dst_indices_md() const {
+        return &desc_.dst_indices_desc;
+    }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 2; }
+
+    dim_t M() const { return desc_.m(); }
+    dim_t K() const { return desc_.k(); }
+    dim_t N() const { return desc_.n(); }
+    dim_t TOPK() const { return desc_.topk(); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim()
+                || memory_desc_wrapper(desc_.weights_desc).has_zero_dim();
+    }
+
+protected:
+    matmul_topk_desc_t desc_;
+
+    matmul_topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<matmul_topk_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto md : {&desc_.src_desc, &desc_.weights_desc,
+                     &desc_.dst_values_desc, &desc_.dst_indices_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok
+                        && memory_desc_init_by_tag(*md, format_tag::ab)
+                                == status::success;
+        }
+        return ok;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/matmul_topk_pd.hpp"
+#include "common/matmul_topk_types.hpp"
+#include "common/matmul_topk_utils.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "opdesc.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API matmul_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_values_desc,
+        const_dnnl_memory_desc_t dst_indices_desc,
+        const_dnnl_primitive_attr_t attr) {
+    CHECK(matmul_topk_desc_check(
+            src_desc, weights_desc, dst_values_desc, dst_indices_desc));
+
+    dnnl::impl::matmul_topk_desc_t matmul_topk_desc
+            = dnnl::impl::create_matmul_topk_desc(
+                    src_desc, weights_desc, dst_values_desc, dst_indices_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&matmul_topk_desc, nullptr, attr);
+}
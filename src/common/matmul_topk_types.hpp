@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_MATMUL_TOPK_TYPES_HPP
+#define COMMON_MATMUL_TOPK_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_DST_VALUES DNNL_ARG_DST_0
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+// A descriptor for a matrix multiplication followed by a top-k selection
+// along the rows of the result:
+//   logits = src * weights
+//   dst_values[m, :], dst_indices[m, :] = topk(logits[m, :])
+// The selected logits are sorted in descending order, ties are resolved in
+// favor of the smaller index. With k = 1 the operation is an argmax. The
+// logits tensor itself is not an output of the operation.
+struct matmul_topk_desc_t : public op_desc_t {
+    matmul_topk_desc_t() : op_desc_t(primitive_kind::matmul_topk) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<matmul_topk_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* [m, k] */
+    memory_desc_t weights_desc; /* [k, n] */
+    memory_desc_t dst_values_desc; /* [m, topk] */
+    memory_desc_t dst_indices_desc; /* [m, topk], s32 */
+
+    // Number of rows.
+    dnnl_dim_t m() const { return src_desc.dims[0]; }
+    // Reduction dimension of the matrix multiplication.
+    dnnl_dim_t k() const { return src_desc.dims[1]; }
+    // Number of columns of the logits, e.g. the vocabulary size.
+    dnnl_dim_t n() const { return weights_desc.dims[1]; }
+    // Number of selected logits per row.
+    dnnl_dim_t topk() const { return dst_values_desc.dims[1]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_MATMUL_TOPK_TYPES_HPP
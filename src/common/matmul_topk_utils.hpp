@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_MATMUL_TOPK_UTILS_HPP
+#define COMMON_MATMUL_TOPK_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/matmul_topk_types.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_MATMUL_TOPK(f, msg, ...) \
+    VCHECK(primitive, create, check, matmul_topk, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_MATMUL_TOPK_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, matmul_topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t matmul_topk_desc_check(const memory_desc_t *src_desc,
+        const memory_desc_t *weights_desc,
+        const memory_desc_t *dst_values_desc,
+        const memory_desc_t *dst_indices_desc) {
+    VCHECK_MATMUL_TOPK_COND(!utils::any_null(src_desc, weights_desc,
+                                    dst_values_desc, dst_indices_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_MATMUL_TOPK_COND(
+            utils::everyone_is(2, src_desc->ndims, weights_desc->ndims,
+                    dst_values_desc->ndims, dst_indices_desc->ndims),
+            VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+
+    VCHECK_MATMUL_TOPK_COND(src_desc->dims[1] == weights_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "weights", 0);
+    VCHECK_MATMUL_TOPK_COND(dst_values_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst_values", 0, "src", 0);
+    VCHECK_MATMUL_TOPK_COND(
+            utils::array_cmp(dst_indices_desc->dims, dst_values_desc->dims, 2),
+            VERBOSE_INCONSISTENT_DIM, "dst_indices", 1, "dst_values", 1);
+    VCHECK_MATMUL_TOPK_COND(dst_values_desc->dims[1] > 0
+                    && dst_values_desc->dims[1] <= weights_desc->dims[1],
+            VERBOSE_BAD_DIM, "dst_values", 1);
+    VCHECK_MATMUL_TOPK_COND(dst_indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "dst_indices");
+
+    VCHECK_MATMUL_TOPK_COND(
+            !any_memory_desc_host_scalar(src_desc, weights_desc,
+                    dst_values_desc, dst_indices_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    return status::success;
+}
+
+static inline matmul_topk_desc_t create_matmul_topk_desc(
+        const memory_desc_t *src_md, const memory_desc_t *weights_md,
+        const memory_desc_t *dst_values_md,
+        const memory_desc_t *dst_indices_md) {
+    auto matmul_topk_desc = matmul_topk_desc_t();
+    matmul_topk_desc.primitive_kind = primitive_kind::matmul_topk;
+    matmul_topk_desc.src_desc = *src_md;
+    matmul_topk_desc.weights_desc = *weights_md;
+    matmul_topk_desc.dst_values_desc = *dst_values_md;
+    matmul_topk_desc.dst_indices_desc = *dst_indices_md;
+    return matmul_topk_desc;
+}
+
+static inline status_t create_matmul_topk_pd(
+        std::shared_ptr<primitive_desc_t> &matmul_topk_pd_, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *weights_md,
+        const memory_desc_t *dst_values_md,
+        const memory_desc_t *dst_indices_md, const primitive_attr_t *attr) {
+    CHECK(matmul_topk_desc_check(
+            src_md, weights_md, dst_values_md, dst_indices_md));
+
+    auto matmul_topk_desc = create_matmul_topk_desc(
+            src_md, weights_md, dst_values_md, dst_indices_md);
+
+    primitive_attr_t matmul_topk_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(engine, (op_desc_t *)&matmul_topk_desc,
+            &matmul_topk_attr, nullptr);
+
+    matmul_topk_pd_ = *(++it);
+    VCHECK_MATMUL_TOPK_COND(
+            matmul_topk_pd_, "failed to create the matmul top-k primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
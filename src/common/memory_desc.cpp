@@ -154,6 +154,51 @@ status_t memory_desc_init_by_csr_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, dim_t nnz_blocks,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // This is the only number of dims that is supported at this point.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    VCHECK_MEMORY(block_dims != nullptr, invalid_arguments,
+            VERBOSE_NULL_ARG);
+
+    for (int d = 0; d < ndims; d++) {
+        VCHECK_MEMORY(block_dims[d] > 0 && dims[d] % block_dims[d] == 0,
+                invalid_arguments, VERBOSE_BAD_PARAM, "block_dims");
+    }
+    const dim_t nblocks
+            = (dims[0] / block_dims[0]) * (dims[1] / block_dims[1]);
+    VCHECK_MEMORY(nnz_blocks >= 0 && nnz_blocks <= nblocks,
+            invalid_arguments, VERBOSE_BAD_PARAM, "nnz_blocks");
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz
+            = nnz_blocks * block_dims[0] * block_dims[1];
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.bsr_block_dims, block_dims, ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
         const dims_t dims, data_type_t data_type, dim_t nnz,
         data_type_t indices_dt) {
@@ -209,6 +254,44 @@ status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
     return success;
 }
 
+status_t memory_desc_init_by_structured_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t n,
+        dim_t m) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // The pattern is defined along the reduction dimension, which is the
+    // second to last one.
+    VCHECK_MEMORY(ndims >= 2, invalid_arguments, VERBOSE_BAD_NDIMS, "", ndims);
+    VCHECK_MEMORY(n > 0 && n < m, invalid_arguments, VERBOSE_BAD_PARAM,
+            "structured sparsity pattern");
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    const dim_t K = dims[ndims - 2];
+    const dim_t nelems = utils::array_product(dims, ndims);
+    const dim_t nnz = K == 0 ? 0 : nelems / K * utils::div_up(K, m) * n;
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::structured;
+    md.format_desc.sparse_desc.nnz = nnz;
+    md.format_desc.sparse_desc.structured_n = n;
+    md.format_desc.sparse_desc.structured_m = m;
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_submemory(memory_desc_t &memory_desc,
         const memory_desc_t &parent_memory_desc, const dims_t dims,
         const dims_t offsets) {
@@ -641,6 +724,20 @@ status_t dnnl_memory_desc_create_with_csr_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, dim_t nnz_blocks, const dims_t block_dims,
+        data_type_t indices_dt, data_type_t pointers_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type,
+            nnz_blocks, block_dims, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz,
         data_type_t indices_dt) {
@@ -667,6 +764,19 @@ status_t dnnl_memory_desc_create_with_packed_encoding(
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_structured_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, dim_t n, dim_t m) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_structured_encoding(
+            *md, ndims, dims, data_type, n, m));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_host_scalar(
         memory_desc_t **memory_desc, data_type_t data_type) {
     if (any_null(memory_desc)) return invalid_arguments;
@@ -815,7 +925,11 @@ status_t dnnl_memory_desc_query_v2(
                     case sparse_encoding::coo:
                         *(int *)result = md->ndims + 1;
                         break;
-                    case sparse_encoding::packed: *(int *)result = 3; break;
+                    case sparse_encoding::packed:
+                    case sparse_encoding::bsr: *(int *)result = 3; break;
+                    case sparse_encoding::structured:
+                        *(int *)result = 2;
+                        break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
             } else
@@ -180,17 +180,39 @@ struct sparse_desc_t {
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
+    //
+    // structured: Number of handles is 2:
+    //  - 0: values
+    //  - 1: bitmask
+    //
+    // BSR: Number of handles is 3:
+    //  - 0: values of the non-zero blocks
+    //  - 1: block column indices
+    //  - 2: block row pointers
     sparse_encoding_t encoding;
 
-    // Number of non-zero entries.
+    // Number of non-zero entries. For BSR this is the number of non-zero
+    // blocks times the block size.
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
     // - packed: N/A
+    // - structured: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // N:M structured sparsity pattern: at most `structured_n` non-zero
+    // elements in each group of `structured_m` consecutive elements along
+    // the reduction (second to last) dimension. Both are zero for other
+    // encodings.
+    dnnl_dim_t structured_n;
+    dnnl_dim_t structured_m;
+
+    // BSR block dimensions. Each block is stored densely in row-major order.
+    // Both are zero for other encodings.
+    dnnl_dim_t bsr_block_dims[2];
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
@@ -223,6 +245,15 @@ struct sparse_desc_t {
     // - Identify the block number that needs to be decoded (unpacked)
     // - Use the block number to find an offset in the packed data
     // - Use the bitmask to unpack the packed data
+    //
+    // The structured encoding uses the same storage schema with two
+    // differences:
+    // - The encoding process keeps exactly `blk_size * structured_n /
+    //   structured_m` elements in each block: groups that violate the N:M
+    //   pattern are pruned by magnitude and blocks that have fewer non-zero
+    //   elements keep some of their zeroes explicitly.
+    // - Since every block has the same number of packed elements the
+    //   offsets are implied and are not stored.
     blocking_desc_t packed_desc;
 };
 
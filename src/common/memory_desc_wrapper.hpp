@@ -64,6 +64,11 @@ struct memory_desc_wrapper : public c_compatible {
                 && sparse_desc().encoding == sparse_encoding::packed;
     }
 
+    bool is_sparse_structured_desc() const {
+        return is_sparse_desc()
+                && sparse_desc().encoding == sparse_encoding::structured;
+    }
+
     bool is_wino_desc() const { return format_kind() == format_kind::wino; }
     bool is_rnn_packed_desc() const {
         return format_kind() == format_kind::rnn_packed;
@@ -78,7 +83,8 @@ struct memory_desc_wrapper : public c_compatible {
     }
 
     const blocking_desc_t &blocking_desc() const {
-        assert(is_blocking_desc() || is_sparse_packed_desc());
+        assert(is_blocking_desc() || is_sparse_packed_desc()
+                || is_sparse_structured_desc());
         if (!is_sparse_desc()) return md_->format_desc.blocking;
         return sparse_desc().packed_desc;
     }
@@ -115,6 +121,14 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    /** returns the number of non-zero blocks of a BSR memory descriptor */
+    dim_t bsr_nnz_blocks() const {
+        assert(is_sparse_desc()
+                && sparse_desc().encoding == sparse_encoding::bsr);
+        const auto &bd = sparse_desc().bsr_block_dims;
+        return nnz() / (bd[0] * bd[1]);
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -209,7 +223,8 @@ struct memory_desc_wrapper : public c_compatible {
     }
 
     dim_t blk_size() const {
-        assert(is_blocking_desc() || is_sparse_packed_desc());
+        assert(is_blocking_desc() || is_sparse_packed_desc()
+                || is_sparse_structured_desc());
         const auto &bd = blocking_desc();
         return utils::array_product(bd.inner_blks, bd.inner_nblks);
     }
@@ -300,6 +315,25 @@ struct memory_desc_wrapper : public c_compatible {
                     }
                     default: assert(!"unknown index"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return bsr_nnz_blocks() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        const dim_t block_rows
+                                = dims()[0] / sparse_desc().bsr_block_dims[0];
+                        return (block_rows + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::coo) {
                 // Return size for values.
                 if (index == 0) {
@@ -330,6 +364,20 @@ struct memory_desc_wrapper : public c_compatible {
                         return utils::div_up(nelems(true), CHAR_BIT);
                     default: assert(!"unknown index"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::structured) {
+                // If the size if queried from a user-created memory descriptor.
+                if (blocking_desc().strides[0] == 0) return 0;
+
+                switch (index) {
+                    case 0:
+                        // Return size for values.
+                        return nnz() * data_type_size();
+                    case 1:
+                        // Return size for bitmask. The bitmask has 1 bit
+                        // per each value.
+                        return utils::div_up(nelems(true), CHAR_BIT);
+                    default: assert(!"unknown index"); return 0;
+                }
             } else {
                 assert(!"unknown sparse encoding");
                 return 0;
@@ -487,7 +535,8 @@ struct memory_desc_wrapper : public c_compatible {
      * represents the position in already padded area */
     dim_t off_v(const dims_t pos, bool is_pos_padded = false) const {
         if (is_host_scalar_desc()) return 0;
-        assert(is_blocking_desc() || is_sparse_packed_desc());
+        assert(is_blocking_desc() || is_sparse_packed_desc()
+                || is_sparse_structured_desc());
         const blocking_desc_t &blk = blocking_desc();
 
         dims_t pos_copy = {0};
@@ -608,7 +657,8 @@ private:
 
     template <int ORIG_LEN, typename T, typename... Args>
     dim_t _blk_off(T xc, Args... args) const {
-        assert(is_blocking_desc() || is_sparse_packed_desc());
+        assert(is_blocking_desc() || is_sparse_packed_desc()
+                || is_sparse_structured_desc());
         constexpr int dc = ORIG_LEN - sizeof...(args) - 1;
         return xc * blocking_desc().strides[dc]
                 + _blk_off<ORIG_LEN, Args...>(args...);
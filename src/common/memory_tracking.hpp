@@ -197,6 +197,7 @@ enum {
     key_conv_brgemm_out_buffer,
     key_conv_bwd_w_1st_bia_reorder,
     key_conv_bwd_w_1st_wei_reorder,
+    key_conv_batch_stats,
     key_conv_dst_scales,
     key_conv_gemm_acc,
     key_conv_gemm_col,
@@ -234,6 +235,8 @@ enum {
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
+    key_gated_mlp_dst_acc,
+    key_gated_mlp_wsp,
     key_gemm_asm_tmp_buffer,
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
@@ -276,6 +279,12 @@ enum {
     key_matmul_dst_cast_acc,
     key_matmul_dst_scales,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_topk_cand,
+    key_matmul_topk_wsp,
+    key_matmul_src_norm_stats,
+    key_matmul_lora_t,
+    key_matmul_rope_buf,
+    key_matmul_dst_dyn_quant_buf,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -322,6 +331,10 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rope_row,
+    key_sdpa_k_packed,
+    key_sdpa_v_packed,
+    key_sdpa_wsp,
     key_softmax_dst_scales,
     key_softmax_reduction,
     key_softmax_interim_store,
@@ -0,0 +1,28 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API pooling_post_ops_append(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg, dnnl_dim_t kernel, dnnl_dim_t stride,
+        dnnl_dim_t padding) {
+    if (post_ops == nullptr) return status::invalid_arguments;
+
+    return post_ops->append_pooling(alg, kernel, stride, padding);
+}
@@ -123,6 +123,10 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
+    CHECK_MASK(smask_t::src_norm, src_norm_);
+    CHECK_MASK(smask_t::lora, lora_);
+    CHECK_MASK(smask_t::dst_split, dst_split_);
+    CHECK_MASK(smask_t::batch_stats, batch_stats_);
     CHECK_ARG(this->defined(smask_t::none));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -291,6 +295,47 @@ status_t post_ops_t::append_prelu(int mask) {
     return success;
 }
 
+status_t post_ops_t::append_rope(
+        int layout, dim_t head_size, dim_t rotary_dims) {
+    if (len() == post_ops_limit) return out_of_memory;
+    VCHECK_ATTR(utils::one_of(layout, rope_layout::interleaved,
+                        rope_layout::half_split),
+            VERBOSE_BAD_PARAM, "layout");
+    VCHECK_ATTR(head_size > 0, VERBOSE_BAD_PARAM, "head_size");
+    VCHECK_ATTR(rotary_dims > 0 && rotary_dims % 2 == 0
+                    && rotary_dims <= head_size,
+            VERBOSE_BAD_PARAM, "rotary_dims");
+
+    auto it_entry = entry_.emplace(entry_.end());
+    it_entry->kind = primitive_kind::rope;
+    it_entry->rope.layout = layout;
+    it_entry->rope.head_size = head_size;
+    it_entry->rope.rotary_dims = rotary_dims;
+
+    return success;
+}
+
+status_t post_ops_t::append_pooling(
+        alg_kind_t alg, dim_t kernel, dim_t stride, dim_t padding) {
+    if (len() == post_ops_limit) return out_of_memory;
+    using namespace alg_kind;
+    VCHECK_ATTR(utils::one_of(alg, pooling_max, pooling_avg_include_padding,
+                        pooling_avg_exclude_padding),
+            VERBOSE_BAD_ALGORITHM);
+    VCHECK_ATTR(kernel > 0, VERBOSE_BAD_PARAM, "kernel");
+    VCHECK_ATTR(stride > 0, VERBOSE_BAD_PARAM, "stride");
+    VCHECK_ATTR(padding >= 0 && padding < kernel, VERBOSE_BAD_PARAM, "padding");
+
+    auto it_entry = entry_.emplace(entry_.end());
+    it_entry->kind = primitive_kind::pooling;
+    it_entry->pooling.alg = alg;
+    it_entry->pooling.kernel = kernel;
+    it_entry->pooling.stride = stride;
+    it_entry->pooling.padding = padding;
+
+    return success;
+}
+
 status_t post_ops_t::set_default_formats(const memory_desc_t *dst_md) {
     for (int idx = 0; idx < len(); ++idx) {
         if (!contain(primitive_kind::binary, idx)) continue;
@@ -411,6 +456,55 @@ status_t primitive_attr_t::set_dropout(const memory_desc_t *user_dropout_desc) {
     return success;
 }
 
+status_t primitive_attr_t::set_src_norm(unsigned flags, float epsilon) {
+    using namespace normalization_flags;
+    const unsigned supported_flags
+            = use_global_stats | use_scale | use_shift | rms_norm;
+    VCHECK_ATTR(!(flags & ~supported_flags), VERBOSE_UNSUPPORTED_FEATURE,
+            "normalization flags");
+    VCHECK_ATTR(epsilon >= 0.f, VERBOSE_BAD_PARAM, "epsilon");
+    src_norm_.enabled_ = true;
+    src_norm_.flags_ = flags;
+    src_norm_.epsilon_ = epsilon;
+    return success;
+}
+
+status_t primitive_attr_t::set_lora(
+        dim_t rank, dim_t num_adapters, float alpha) {
+    VCHECK_ATTR(rank > 0, VERBOSE_BAD_PARAM, "rank");
+    VCHECK_ATTR(num_adapters > 0, VERBOSE_BAD_PARAM, "num_adapters");
+    lora_.rank_ = rank;
+    lora_.num_adapters_ = num_adapters;
+    lora_.alpha_ = alpha;
+    return success;
+}
+
+status_t primitive_attr_t::set_dst_split(
+        int ndsts, const memory_desc_t *const *dst_descs) {
+    VCHECK_ATTR(ndsts > 0 && ndsts <= dst_split_t::max_ndsts,
+            VERBOSE_BAD_PARAM, "ndsts");
+    VCHECK_ATTR(dst_descs != nullptr, VERBOSE_NULL_ARG);
+    std::vector<memory_desc_t> dsts;
+    for (int i = 0; i < ndsts; i++) {
+        VCHECK_ATTR(dst_descs[i] != nullptr, VERBOSE_NULL_ARG);
+        const memory_desc_wrapper mdw(dst_descs[i]);
+        VCHECK_ATTR(!mdw.has_zero_dim() && mdw.ndims() >= 2,
+                VERBOSE_BAD_PARAM, "dst_descs");
+        // The tensors are written in place, so their layouts must be known.
+        VCHECK_ATTR(mdw.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+        VCHECK_ATTR(!mdw.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        dsts.push_back(*dst_descs[i]);
+    }
+    dst_split_.dsts_ = std::move(dsts);
+    return success;
+}
+
+status_t primitive_attr_t::set_batch_stats(bool enabled) {
+    batch_stats_.enabled_ = enabled;
+    return success;
+}
+
 status_t primitive_attr_t::set_fpmath_mode(
         fpmath_mode_t fpmath_mode, bool apply_to_int) {
     auto st = check_fpmath_mode(fpmath_mode);
@@ -497,6 +591,70 @@ status_t dnnl_primitive_attr_set_dropout(
     return attr->set_dropout(user_dropout_desc);
 }
 
+status_t dnnl_primitive_attr_get_src_normalization(
+        const primitive_attr_t *attr, unsigned *flags, float *epsilon) {
+    if (any_null(attr)) return invalid_arguments;
+    if (flags) *flags = attr->src_norm_.flags_;
+    if (epsilon) *epsilon = attr->src_norm_.epsilon_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_normalization(
+        primitive_attr_t *attr, unsigned flags, float epsilon) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_src_norm(flags, epsilon);
+}
+
+status_t dnnl_primitive_attr_get_lora(const primitive_attr_t *attr,
+        dim_t *rank, dim_t *num_adapters, float *alpha) {
+    if (any_null(attr)) return invalid_arguments;
+    if (rank) *rank = attr->lora_.rank_;
+    if (num_adapters) *num_adapters = attr->lora_.num_adapters_;
+    if (alpha) *alpha = attr->lora_.alpha_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_lora(primitive_attr_t *attr, dim_t rank,
+        dim_t num_adapters, float alpha) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_lora(rank, num_adapters, alpha);
+}
+
+status_t dnnl_primitive_attr_get_dst_split(
+        const primitive_attr_t *attr, int *ndsts) {
+    if (any_null(attr, ndsts)) return invalid_arguments;
+    *ndsts = attr->dst_split_.ndsts();
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_dst_split_desc(const primitive_attr_t *attr,
+        int index, const memory_desc_t **dst_desc) {
+    if (any_null(attr, dst_desc)) return invalid_arguments;
+    if (index < 0 || index >= attr->dst_split_.ndsts())
+        return invalid_arguments;
+    *dst_desc = &attr->dst_split_.dsts_[index];
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_split(primitive_attr_t *attr, int ndsts,
+        const memory_desc_t *const *dst_descs) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_dst_split(ndsts, dst_descs);
+}
+
+status_t dnnl_primitive_attr_get_batch_stats(
+        const primitive_attr_t *attr, int *enabled) {
+    if (any_null(attr, enabled)) return invalid_arguments;
+    *enabled = attr->batch_stats_.enabled_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_batch_stats(
+        primitive_attr_t *attr, int enabled) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_batch_stats(enabled != 0);
+}
+
 status_t dnnl_primitive_attr_get_fpmath_mode(
         const primitive_attr_t *attr, fpmath_mode_t *mode) {
     if (any_null(attr, mode)) return invalid_arguments;
@@ -550,6 +708,20 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_constant_weights(
+        const primitive_attr_t *attr, int *c) {
+    if (any_null(attr, c)) return invalid_arguments;
+    *c = attr->constant_weights_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_constant_weights(
+        primitive_attr_t *attr, int c) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->constant_weights_ = c;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -595,7 +767,8 @@ status_t dnnl_primitive_attr_set_scales_v3(primitive_attr_t *attr, int arg,
     VCHECK_ATTR(attr, VERBOSE_NULL_ARG);
     VCHECK_ATTR(arg >= 0, VERBOSE_BAD_PARAM, "arg");
     VCHECK_ATTR(utils::one_of(qmode, quantization_mode::static_sazp,
-                        quantization_mode::dynamic_mx),
+                        quantization_mode::dynamic_mx,
+                        quantization_mode::dynamic_fp),
             VERBOSE_BAD_PARAM, "qmode");
     VCHECK_ATTR(
             utils::one_of(data_type, f32, bf16, f16, e8m0, f8_e5m2, f8_e4m3),
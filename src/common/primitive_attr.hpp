@@ -198,6 +198,82 @@ struct dropout_t : public c_compatible {
     dnnl::impl::memory_desc_t user_dropout_desc_;
 };
 
+// Normalization of the source tensor along its last dimension, applied by the
+// primitive before the source is consumed (e.g. RMSNorm preceding a matmul).
+struct src_norm_t : public c_compatible {
+    src_norm_t() = default;
+
+    bool has_default_values() const { return !enabled_; }
+    bool operator==(const src_norm_t &rhs) const {
+        return enabled_ == rhs.enabled_ && flags_ == rhs.flags_
+                && epsilon_ == rhs.epsilon_;
+    }
+
+    bool use_global_stats() const {
+        return flags_ & normalization_flags::use_global_stats;
+    }
+    bool use_scale() const { return flags_ & normalization_flags::use_scale; }
+    bool use_shift() const { return flags_ & normalization_flags::use_shift; }
+    bool rms_norm() const { return flags_ & normalization_flags::rms_norm; }
+
+    bool enabled_ = false;
+    unsigned flags_ = 0;
+    float epsilon_ = 0.f;
+};
+
+// Low-rank adaptation of the weights: the primitive computes
+// src * (W + alpha * A_i * B_i), where i is the adapter of a destination row.
+struct lora_t : public c_compatible {
+    lora_t() = default;
+
+    bool has_default_values() const { return rank_ == 0; }
+    bool operator==(const lora_t &rhs) const {
+        return rank_ == rhs.rank_ && num_adapters_ == rhs.num_adapters_
+                && alpha_ == rhs.alpha_;
+    }
+
+    // Adapter indices are passed only when there is a choice to make.
+    bool with_indices() const { return num_adapters_ > 1; }
+
+    dim_t rank_ = 0;
+    dim_t num_adapters_ = 0;
+    float alpha_ = 1.f;
+};
+
+// Split of the destination columns between several tensors, e.g. the query,
+// key and value projections computed by a single matmul.
+struct dst_split_t : public c_compatible {
+    dst_split_t() = default;
+
+    static constexpr int max_ndsts = 8;
+
+    bool has_default_values() const { return dsts_.empty(); }
+    bool operator==(const dst_split_t &rhs) const {
+        if (dsts_.size() != rhs.dsts_.size()) return false;
+        for (size_t i = 0; i < dsts_.size(); i++)
+            if (!(dsts_[i] == rhs.dsts_[i])) return false;
+        return true;
+    }
+
+    int ndsts() const { return static_cast<int>(dsts_.size()); }
+
+    std::vector<memory_desc_t> dsts_;
+};
+
+// Per-channel batch statistics of the destination, computed by the
+// primitive while the destination is stored (e.g. for a batch normalization
+// following a forward convolution).
+struct batch_stats_t : public c_compatible {
+    batch_stats_t() = default;
+
+    bool has_default_values() const { return !enabled_; }
+    bool operator==(const batch_stats_t &rhs) const {
+        return enabled_ == rhs.enabled_;
+    }
+
+    bool enabled_ = false;
+};
+
 struct rnd_mode_t : public c_compatible {
     rnd_mode_t() = default;
 
@@ -320,6 +396,23 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             int mask;
         };
 
+        // Rotary position embedding of the heads of every destination row.
+        // `layout` is one of the `rope_layout` values.
+        struct rope_t {
+            int layout;
+            dnnl::impl::dim_t head_size;
+            dnnl::impl::dim_t rotary_dims;
+        };
+
+        // Spatial pooling of the destination with a square window. The
+        // destination of the primitive is the pooled tensor.
+        struct pooling_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::dim_t kernel;
+            dnnl::impl::dim_t stride;
+            dnnl::impl::dim_t padding;
+        };
+
         dnnl::impl::primitive_kind_t kind
                 = dnnl::impl::primitive_kind::undefined;
         union {
@@ -328,6 +421,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             depthwise_conv_t depthwise_conv;
             binary_t binary;
             prelu_t prelu;
+            rope_t rope;
+            pooling_t pooling;
         };
 
         bool is_eltwise(bool require_scale_one = false) const {
@@ -367,6 +462,14 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
         bool is_like_binary() const { return is_binary() || is_prelu(); }
 
+        bool is_rope() const {
+            return kind == dnnl::impl::primitive_kind::rope;
+        }
+
+        bool is_pooling() const {
+            return kind == dnnl::impl::primitive_kind::pooling;
+        }
+
         bool is_binary_with_ternary_op() const {
             return is_binary()
                     && (binary.alg == dnnl::impl::alg_kind::binary_select);
@@ -381,7 +484,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             using namespace dnnl::impl::utils;
             if (kind != rhs.kind) { return false; }
             bool ret = true;
-            switch (kind) {
+            switch ((int)kind) {
                 case primitive_kind::eltwise:
                     ret = eltwise.alg == rhs.eltwise.alg
                             && equal_with_nan(eltwise.scale, rhs.eltwise.scale)
@@ -415,6 +518,17 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 case primitive_kind::prelu:
                     ret = prelu.mask == rhs.prelu.mask;
                     break;
+                case primitive_kind::rope:
+                    ret = rope.layout == rhs.rope.layout
+                            && rope.head_size == rhs.rope.head_size
+                            && rope.rotary_dims == rhs.rope.rotary_dims;
+                    break;
+                case primitive_kind::pooling:
+                    ret = pooling.alg == rhs.pooling.alg
+                            && pooling.kernel == rhs.pooling.kernel
+                            && pooling.stride == rhs.pooling.stride
+                            && pooling.padding == rhs.pooling.padding;
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -440,6 +554,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             const dnnl::impl::memory_desc_t *user_src1_desc,
             const dnnl::impl::memory_desc_t *user_src2_desc = nullptr);
     dnnl::impl::status_t append_prelu(int mask);
+    dnnl::impl::status_t append_rope(int layout, dnnl::impl::dim_t head_size,
+            dnnl::impl::dim_t rotary_dims);
+    dnnl::impl::status_t append_pooling(dnnl::impl::alg_kind_t alg,
+            dnnl::impl::dim_t kernel, dnnl::impl::dim_t stride,
+            dnnl::impl::dim_t padding);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc,
@@ -535,7 +654,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , constant_weights_(false) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -560,6 +680,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        constant_weights_ = other.constant_weights_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -568,6 +689,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         CHECK(rnn_tparams_.copy_from(other.rnn_tparams_));
         if (other.gpu_attr_) gpu_attr_ = other.gpu_attr_->clone();
         dropout_ = other.dropout_;
+        src_norm_ = other.src_norm_;
+        lora_ = other.lora_;
+        dst_split_ = other.dst_split_;
+        batch_stats_ = other.batch_stats_;
 
         return status::success;
     }
@@ -628,6 +753,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
         precomputed_reductions = 1u << 18,
+        src_norm = 1u << 19,
+        lora = 1u << 20,
+        dst_split = 1u << 21,
+        batch_stats = 1u << 22,
     };
 
     /** Returns true if the attributes have default values.
@@ -643,6 +772,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && constant_weights_ == rhs.constant_weights_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && precomputed_reductions_ == rhs.precomputed_reductions_
                 && post_ops_ == rhs.post_ops_
@@ -655,7 +785,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                             && gpu_attr_->is_equal(*rhs.gpu_attr_))
                         || (!gpu_attr_ && !rhs.gpu_attr_))
                 && dropout_ == rhs.dropout_
-                && rounding_mode_ == rhs.rounding_mode_;
+                && rounding_mode_ == rhs.rounding_mode_
+                && src_norm_ == rhs.src_norm_ && lora_ == rhs.lora_
+                && dst_split_ == rhs.dst_split_
+                && batch_stats_ == rhs.batch_stats_;
         return ret;
     }
 
@@ -665,6 +798,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             dnnl::impl::accumulation_mode_t am);
     dnnl::impl::status_t set_dropout(
             const dnnl::impl::memory_desc_t *dropout_desc);
+    dnnl::impl::status_t set_src_norm(unsigned flags, float epsilon);
+    dnnl::impl::status_t set_lora(dnnl::impl::dim_t rank,
+            dnnl::impl::dim_t num_adapters, float alpha);
+    dnnl::impl::status_t set_dst_split(
+            int ndsts, const dnnl::impl::memory_desc_t *const *dst_descs);
+    dnnl::impl::status_t set_batch_stats(bool enabled);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
@@ -725,6 +864,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    // The weights do not change between executions, so implementations may
+    // keep data derived from them.
+    bool constant_weights_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
@@ -732,6 +874,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::rnn_tparams_t rnn_tparams_;
     dnnl::impl::dropout_t dropout_;
     dnnl::impl::rnd_mode_t rounding_mode_;
+    dnnl::impl::src_norm_t src_norm_;
+    dnnl::impl::lora_t lora_;
+    dnnl::impl::dst_split_t dst_split_;
+    dnnl::impl::batch_stats_t batch_stats_;
 
     std::unique_ptr<dnnl::impl::primitive_attr_item_t> gpu_attr_;
 
@@ -105,6 +105,11 @@ struct quant_entry_t : public c_compatible {
     bool is_host_scalar() const { return is_host_scalar_; }
     quantization_mode_t get_quantization_mode() const { return qmode_; }
     bool is_mx() const { return qmode_ == quantization_mode::dynamic_mx; }
+    // Dynamic quantization parameters are computed by the primitive.
+    bool is_dynamic() const {
+        return utils::one_of(qmode_, quantization_mode::dynamic_mx,
+                quantization_mode::dynamic_fp);
+    }
 
     status_t get_md(memory_desc_t &out_md, const memory_desc_t &base_md) const {
         if (has_default_values()) {
@@ -333,6 +338,8 @@ private:
         }
         // concat
         if (arg & DNNL_ARG_MULTIPLE_SRC) return true;
+        // destination split
+        if (arg & DNNL_ARG_MULTIPLE_DST) return true;
         // depth-wise convolution post op
         for (const auto &sa : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
             if (arg == (DNNL_ARG_ATTR_POST_OP_DW | sa)) return true;
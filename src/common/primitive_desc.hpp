@@ -171,7 +171,7 @@ struct primitive_desc_t : public c_compatible {
         if (arg & DNNL_ARG_ATTR_SCALES) {
             int scale_arg = arg & ~DNNL_ARG_ATTR_SCALES;
             if (!attr()->scales_.has_default_values(scale_arg)) {
-                if (attr()->scales_.get(scale_arg).is_mx())
+                if (attr()->scales_.get(scale_arg).is_dynamic())
                     return arg_usage_t::output;
                 else
                     return arg_usage_t::input;
@@ -191,6 +191,22 @@ struct primitive_desc_t : public c_compatible {
         if (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
             return !attr()->dropout_.has_default_values() ? arg_usage_t::input
                                                           : arg_usage_t::unused;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_SRC_NORM_MEAN,
+                    DNNL_ARG_ATTR_SRC_NORM_VARIANCE))
+            return attr()->src_norm_.use_global_stats() ? arg_usage_t::input
+                                                        : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_SRC_NORM_SCALE)
+            return attr()->src_norm_.use_scale() ? arg_usage_t::input
+                                                 : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_SRC_NORM_SHIFT)
+            return attr()->src_norm_.use_shift() ? arg_usage_t::input
+                                                 : arg_usage_t::unused;
+        if (utils::one_of(arg, DNNL_ARG_ATTR_LORA_A, DNNL_ARG_ATTR_LORA_B))
+            return !attr()->lora_.has_default_values() ? arg_usage_t::input
+                                                       : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_LORA_INDICES)
+            return attr()->lora_.with_indices() ? arg_usage_t::input
+                                                : arg_usage_t::unused;
         if (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
             return !attr()->rounding_mode_.has_default_values()
                     ? arg_usage_t::input
@@ -203,7 +219,13 @@ struct primitive_desc_t : public c_compatible {
                     || post_op_has_proper_input(
                             attr(), binary, idx, arg, DNNL_ARG_SRC_2)
                     || post_op_has_proper_input(
-                            attr(), prelu, idx, arg, DNNL_ARG_WEIGHTS))
+                            attr(), prelu, idx, arg, DNNL_ARG_WEIGHTS)
+                    || post_op_has_proper_input(
+                            attr(), rope, idx, arg, DNNL_ARG_SRC_1)
+                    || post_op_has_proper_input(
+                            attr(), rope, idx, arg, DNNL_ARG_SRC_2)
+                    || post_op_has_proper_input(
+                            attr(), rope, idx, arg, DNNL_ARG_SRC_3))
                 return arg_usage_t::input;
         }
 
@@ -219,6 +241,7 @@ struct primitive_desc_t : public c_compatible {
                            post_ops_t::post_ops_limit)) {
             const auto &po = attr()->post_ops_;
             for (int idx = 0; idx < po.len(); ++idx) {
+                if (!po.entry_[idx].is_binary()) continue;
                 if (!utils::one_of(arg,
                             (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
                                     | DNNL_ARG_SRC_1),
@@ -381,6 +404,11 @@ struct primitive_desc_t : public c_compatible {
     int n_prelu_po_inputs() const {
         return po_inputs(attr()->post_ops_, primitive_kind::prelu);
     }
+
+    // A RoPE post-op takes the cosine and sine tables and the positions.
+    int n_rope_po_inputs() const {
+        return 3 * po_inputs(attr()->post_ops_, primitive_kind::rope);
+    }
     // The `hint_mds(bool is_hint)` returns a vector of memory descriptors
     // that might affect the equality of primitive descriptors for backward pass.
     //
@@ -65,7 +65,12 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
                         || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
-                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED);
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || (arg >= DNNL_ARG_ATTR_SRC_NORM_MEAN
+                                && arg <= DNNL_ARG_ATTR_SRC_NORM_SHIFT)
+                        || (arg >= DNNL_ARG_ATTR_LORA_A
+                                && arg <= DNNL_ARG_ATTR_LORA_INDICES)
+                        || (arg == DNNL_ARG_PREFETCH_HINT);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
@@ -83,18 +83,21 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(matmul_topk)
             CASE(pooling)
             CASE(prelu)
             CASE(reduction)
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
@@ -179,6 +182,10 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = hash_combine(seed,
                     static_cast<size_t>(md.format_desc.sparse_desc.encoding));
             seed = hash_combine(seed, md.format_desc.sparse_desc.nnz);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.structured_n);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.structured_m);
+            seed = get_array_hash(
+                    seed, md.format_desc.sparse_desc.bsr_block_dims, 2);
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
@@ -228,6 +235,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // constant_weights
+    seed = hash_combine(seed, static_cast<size_t>(attr.constant_weights_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
     // rounding_mode
@@ -253,7 +262,7 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
-        switch (entry.kind) {
+        switch ((int)entry.kind) {
             case primitive_kind::eltwise:
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.eltwise.alg));
@@ -290,6 +299,19 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.prelu.mask));
                 break;
+            case primitive_kind::rope:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.rope.layout));
+                seed = hash_combine(seed, entry.rope.head_size);
+                seed = hash_combine(seed, entry.rope.rotary_dims);
+                break;
+            case primitive_kind::pooling:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.alg));
+                seed = hash_combine(seed, entry.pooling.kernel);
+                seed = hash_combine(seed, entry.pooling.stride);
+                seed = hash_combine(seed, entry.pooling.padding);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -312,6 +334,18 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(
                 seed, get_md_hash(attr.dropout_.user_dropout_desc_));
     }
+    if (!attr.src_norm_.has_default_values()) {
+        seed = hash_combine(seed, attr.src_norm_.flags_);
+        seed = hash_combine(seed, attr.src_norm_.epsilon_);
+    }
+    if (!attr.lora_.has_default_values()) {
+        seed = hash_combine(seed, attr.lora_.rank_);
+        seed = hash_combine(seed, attr.lora_.num_adapters_);
+        seed = hash_combine(seed, attr.lora_.alpha_);
+    }
+    for (const auto &md : attr.dst_split_.dsts_)
+        seed = hash_combine(seed, get_md_hash(md));
+    seed = hash_combine(seed, attr.batch_stats_.enabled_);
     // Combined hash for attributes
     return seed;
 }
@@ -731,6 +765,54 @@ size_t get_desc_hash(const zero_pad_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const gated_mlp_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.w_gate_desc));
+    seed = hash_combine(seed, get_md_hash(desc.w_up_desc));
+    seed = hash_combine(seed, get_md_hash(desc.w_down_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Activation
+    seed = hash_combine(seed, static_cast<size_t>(desc.activation));
+    seed = hash_combine(seed, desc.alpha);
+    seed = hash_combine(seed, desc.beta);
+    // Combined hash for gated mlp desc
+    return seed;
+}
+
+size_t get_desc_hash(const matmul_topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_values_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_indices_desc));
+    // Combined hash for matmul top-k desc
+    return seed;
+}
+
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sin_desc));
+    seed = hash_combine(seed, get_md_hash(desc.pos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Layout of the rotated pairs and the number of rotated elements
+    seed = hash_combine(seed, static_cast<size_t>(desc.layout));
+    seed = hash_combine(seed, desc.rotary_dims);
+    // Combined hash for RoPE desc
+    return seed;
+}
+
 size_t get_desc_hash(const sdpa_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -753,6 +835,10 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, desc.kv_head_number);
     seed = hash_combine(seed, static_cast<size_t>(desc.mask_type));
     seed = hash_combine(seed, static_cast<size_t>(desc.softmax_alg));
+    // Paged KV cache
+    seed = hash_combine(seed, desc.kv_page_size);
+    seed = hash_combine(seed, get_md_hash(desc.block_table_desc));
+    seed = hash_combine(seed, get_md_hash(desc.seq_lens_desc));
     // Combined hash for sdpa desc
     return seed;
 }
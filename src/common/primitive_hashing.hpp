@@ -85,6 +85,9 @@ size_t get_desc_hash(const reduction_desc_t &desc);
 size_t get_desc_hash(const reorder_desc_t &desc);
 size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
+size_t get_desc_hash(const rope_desc_t &desc);
+size_t get_desc_hash(const gated_mlp_desc_t &desc);
+size_t get_desc_hash(const matmul_topk_desc_t &desc);
 size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
@@ -170,18 +173,21 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(matmul_topk)
             CASE(pooling)
             CASE(prelu)
             CASE(reduction)
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
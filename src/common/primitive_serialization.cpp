@@ -35,18 +35,21 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(gated_mlp)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
         CASE(layer_normalization)
         CASE(lrn)
         CASE(matmul)
+        CASE(matmul_topk)
         CASE(pooling)
         CASE(prelu)
         CASE(reduction)
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
         CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
@@ -146,7 +149,7 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
     // post_ops: entry[:]
     for (int i = 0; i < post_ops.len(); i++) {
         const auto &entry = post_ops.entry_[i];
-        switch (entry.kind) {
+        switch ((int)entry.kind) {
             case primitive_kind::eltwise:
                 sstream.append(entry.eltwise.alg);
                 sstream.append(entry.eltwise.scale);
@@ -171,6 +174,17 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
                 serialize(sstream, entry.binary.user_src1_desc);
                 break;
             case primitive_kind::prelu: sstream.append(entry.prelu.mask); break;
+            case primitive_kind::rope:
+                sstream.append(entry.rope.layout);
+                sstream.append(entry.rope.head_size);
+                sstream.append(entry.rope.rotary_dims);
+                break;
+            case primitive_kind::pooling:
+                sstream.append(entry.pooling.alg);
+                sstream.append(entry.pooling.kernel);
+                sstream.append(entry.pooling.stride);
+                sstream.append(entry.pooling.padding);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -184,6 +198,8 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.append(attr.deterministic_);
+    // constant_weights
+    sstream.append(attr.constant_weights_);
     // acc_mode
     sstream.append(attr.acc_mode_);
 
@@ -217,6 +233,28 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
         serialize(sstream, attr.dropout_.user_dropout_desc_);
     }
 
+    if (!attr.src_norm_.has_default_values()) {
+        sstream.append('n');
+        sstream.append(attr.src_norm_.flags_);
+        sstream.append(attr.src_norm_.epsilon_);
+    }
+
+    if (!attr.lora_.has_default_values()) {
+        sstream.append('l');
+        sstream.append(attr.lora_.rank_);
+        sstream.append(attr.lora_.num_adapters_);
+        sstream.append(attr.lora_.alpha_);
+    }
+
+    if (!attr.dst_split_.has_default_values()) {
+        sstream.append('t');
+        sstream.append(attr.dst_split_.ndsts());
+        for (const auto &md : attr.dst_split_.dsts_)
+            serialize(sstream, md);
+    }
+
+    if (!attr.batch_stats_.has_default_values()) sstream.append('b');
+
     serialize(sstream, attr.post_ops_);
 
     // rnn_data_qparams: scale, shift
@@ -578,6 +616,41 @@ void serialize(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize(sstream, *desc.src_mds[i]);
 }
 
+void serialize(serialization_stream_t &sstream, const gated_mlp_desc_t &desc) {
+    // Kind
+    sstream.append(desc.primitive_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.w_gate_desc);
+    serialize(sstream, desc.w_up_desc);
+    serialize(sstream, desc.w_down_desc);
+    serialize(sstream, desc.dst_desc);
+    sstream.append(desc.activation);
+    sstream.append(desc.alpha);
+    sstream.append(desc.beta);
+}
+
+void serialize(
+        serialization_stream_t &sstream, const matmul_topk_desc_t &desc) {
+    // Kind
+    sstream.append(desc.primitive_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_values_desc);
+    serialize(sstream, desc.dst_indices_desc);
+}
+
+void serialize(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kind
+    sstream.append(desc.primitive_kind);
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.cos_desc);
+    serialize(sstream, desc.sin_desc);
+    serialize(sstream, desc.pos_desc);
+    serialize(sstream, desc.dst_desc);
+    sstream.append(desc.layout);
+    sstream.append(desc.rotary_dims);
+}
+
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -597,6 +670,9 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     sstream.append(desc.kv_head_number);
     sstream.append(desc.mask_type);
     sstream.append(desc.softmax_alg);
+    sstream.append(desc.kv_page_size);
+    serialize(sstream, desc.block_table_desc);
+    serialize(sstream, desc.seq_lens_desc);
 }
 
 } // namespace impl
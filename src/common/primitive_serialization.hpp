@@ -49,6 +49,10 @@ void serialize(serialization_stream_t &sstream, const reduction_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const reorder_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const resampling_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const rnn_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const rope_desc_t &desc);
+void serialize(serialization_stream_t &sstream, const gated_mlp_desc_t &desc);
+void serialize(
+        serialization_stream_t &sstream, const matmul_topk_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize(serialization_stream_t &sstream, const softmax_desc_t &desc);
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_PD_HPP
+#define COMMON_ROPE_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/rope_utils.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_ROPE(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, rope, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_ROPE_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, rope, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+// NOLINTBEGIN(google-default-arguments)
+struct rope_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::rope;
+
+    using base_class = rope_pd_t;
+    using hint_class = rope_pd_t;
+
+    const rope_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_SRC, DNNL_ARG_ROPE_COS, DNNL_ARG_ROPE_SIN))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ROPE_POSITIONS)
+            return with_positions() ? arg_usage_t::input
+                                    : arg_usage_t::unused;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_ROPE_COS: return src_md(1);
+            case DNNL_ARG_ROPE_SIN: return src_md(2);
+            case DNNL_ARG_ROPE_POSITIONS: return src_md(3);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.cos_desc;
+            case 2: return &desc_.sin_desc;
+            case 3: return &desc_.pos_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *cos_md() const { return &desc_.cos_desc; }
+    const memory_desc_t *sin_md() const { return &desc_.sin_desc; }
+    const memory_desc_t *pos_md() const { return &desc_.pos_desc; }
+
+    int n_inputs() const override { return 3 + with_positions(); }
+    int n_outputs() const override { return 1; }
+
+    bool with_positions() const { return desc_.with_positions(); }
+    rope_layout_t layout() const { return desc_.layout; }
+    dim_t rotary_dims() const { return desc_.rotary_dims; }
+
+    dim_t MB() const { return desc_.batch(); }
+    dim_t H() const { return desc_.heads(); }
+    dim_t S() const { return desc_.seq_len(); }
+    dim_t D() const { return desc_.head_size(); }
+    dim_t max_positions() const { return desc_.max_positions(); }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim();
+    }
+
+protected:
+    rope_desc_t desc_;
+
+    rope_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<rope_desc_t>(adesc)) {}
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto md : {&desc_.src_desc, &desc_.dst_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok
+                        && memory_desc_init_by_tag(*md, format_tag::abcd)
+                                == status::success;
+        }
+        for (auto md : {&desc_.cos_desc, &desc_.sin_desc, &desc_.pos_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                ok = ok
+                        && memory_desc_init_by_tag(*md, format_tag::ab)
+                                == status::success;
+        }
+        return ok;
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
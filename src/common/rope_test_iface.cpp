@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/rope_pd.hpp"
+#include "common/rope_types.hpp"
+#include "common/rope_utils.hpp"
+#include "opdesc.hpp"
+
+using dnnl::impl::status_t;
+using namespace dnnl::impl;
+
+dnnl_status_t DNNL_API rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t cos_desc,
+        const_dnnl_memory_desc_t sin_desc, const_dnnl_memory_desc_t pos_desc,
+        const_dnnl_memory_desc_t dst_desc, int layout, dnnl_dim_t rotary_dims,
+        const_dnnl_primitive_attr_t attr) {
+    CHECK(rope_desc_check(src_desc, cos_desc, sin_desc, pos_desc, dst_desc,
+            (rope_layout_t)layout, rotary_dims));
+
+    dnnl::impl::rope_desc_t rope_desc = dnnl::impl::create_rope_desc(src_desc,
+            cos_desc, sin_desc, pos_desc, dst_desc, (rope_layout_t)layout,
+            rotary_dims);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&rope_desc, nullptr, attr);
+}
+
+dnnl_status_t DNNL_API rope_post_ops_append(dnnl_post_ops_t post_ops,
+        int layout, dnnl_dim_t head_size, dnnl_dim_t rotary_dims) {
+    if (post_ops == nullptr) return status::invalid_arguments;
+
+    return post_ops->append_rope(
+            (rope_layout_t)layout, head_size, rotary_dims);
+}
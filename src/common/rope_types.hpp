@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_TYPES_HPP
+#define COMMON_ROPE_TYPES_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/opdesc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_ROPE_COS DNNL_ARG_SRC_1
+#define DNNL_ARG_ROPE_SIN DNNL_ARG_SRC_2
+#define DNNL_ARG_ROPE_POSITIONS DNNL_ARG_SRC_3
+
+// NOLINTBEGIN(modernize-use-using)
+/// Ways the rotated elements of a head are paired
+typedef enum {
+    dnnl_rope_layout_undef = 0,
+    /// element 2i is rotated together with element 2i + 1 (GPT-J style)
+    dnnl_rope_interleaved = 1,
+    /// element i is rotated together with element i + rotary_dims / 2
+    /// (GPT-NeoX and LLaMA style)
+    dnnl_rope_half_split = 2,
+} dnnl_rope_layout_t;
+// NOLINTEND(modernize-use-using)
+
+using rope_layout_t = dnnl_rope_layout_t;
+namespace rope_layout {
+const rope_layout_t undef = dnnl_rope_layout_undef;
+const rope_layout_t interleaved = dnnl_rope_interleaved;
+const rope_layout_t half_split = dnnl_rope_half_split;
+} // namespace rope_layout
+
+// A descriptor for a rotary position embedding (RoPE) operation:
+//   dst[b, h, s, :] = rotate(src[b, h, s, :], pos[b, s])
+// The first `rotary_dims` elements of every head are rotated in pairs, pair i
+// by the angle with the cosine cos[pos, i] and the sine sin[pos, i]; the rest
+// of the head is copied. Without the positions tensor token s has position s.
+struct rope_desc_t : public op_desc_t {
+    rope_desc_t() : op_desc_t(primitive_kind::rope) {}
+
+    std::unique_ptr<op_desc_t> clone() const override {
+        return utils::make_unique<rope_desc_t>(*this);
+    }
+
+    memory_desc_t src_desc; /* [batch, heads, seq_len, head_size] */
+    memory_desc_t cos_desc; /* [max_positions, rotary_dims / 2], f32 */
+    memory_desc_t sin_desc; /* [max_positions, rotary_dims / 2], f32 */
+    memory_desc_t pos_desc; /* [batch, seq_len], s32, optional */
+    memory_desc_t dst_desc; /* [batch, heads, seq_len, head_size] */
+
+    rope_layout_t layout = rope_layout::undef;
+    dim_t rotary_dims {};
+
+    bool with_positions() const { return pos_desc.ndims != 0; }
+
+    dnnl_dim_t batch() const { return src_desc.dims[0]; }
+    dnnl_dim_t heads() const { return src_desc.dims[1]; }
+    dnnl_dim_t seq_len() const { return src_desc.dims[2]; }
+    dnnl_dim_t head_size() const { return src_desc.dims[3]; }
+    // Number of rows of the cosine and sine tables.
+    dnnl_dim_t max_positions() const { return cos_desc.dims[0]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif // COMMON_ROPE_TYPES_HPP
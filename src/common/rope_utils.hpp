@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_UTILS_HPP
+#define COMMON_ROPE_UTILS_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/rope_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VCHECK_ROPE(f, msg, ...) \
+    VCHECK(primitive, create, check, rope, (f), msg, ##__VA_ARGS__);
+
+#define VCHECK_ROPE_COND(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, rope, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+static inline status_t rope_desc_check(const memory_desc_t *src_desc,
+        const memory_desc_t *cos_desc, const memory_desc_t *sin_desc,
+        const memory_desc_t *pos_desc, const memory_desc_t *dst_desc,
+        rope_layout_t layout, dim_t rotary_dims) {
+    VCHECK_ROPE_COND(!utils::any_null(src_desc, cos_desc, sin_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_ROPE_COND(utils::everyone_is(4, src_desc->ndims, dst_desc->ndims),
+            VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+    VCHECK_ROPE_COND(utils::everyone_is(2, cos_desc->ndims, sin_desc->ndims),
+            VERBOSE_BAD_NDIMS, "cos", cos_desc->ndims);
+    VCHECK_ROPE_COND(utils::array_cmp(src_desc->dims, dst_desc->dims, 4),
+            VERBOSE_INCONSISTENT_DIM, "src", 3, "dst", 3);
+    VCHECK_ROPE_COND(
+            utils::one_of(layout, rope_layout::interleaved,
+                    rope_layout::half_split),
+            VERBOSE_BAD_PARAM, "layout");
+
+    const dim_t head_size = src_desc->dims[3];
+    VCHECK_ROPE_COND(rotary_dims > 0 && rotary_dims % 2 == 0
+                    && rotary_dims <= head_size,
+            VERBOSE_BAD_PARAM, "rotary_dims");
+    VCHECK_ROPE_COND(utils::array_cmp(cos_desc->dims, sin_desc->dims, 2),
+            VERBOSE_INCONSISTENT_DIM, "cos", 0, "sin", 0);
+    VCHECK_ROPE_COND(cos_desc->dims[0] > 0, VERBOSE_BAD_DIM, "cos", 0);
+    VCHECK_ROPE_COND(cos_desc->dims[1] == rotary_dims / 2, VERBOSE_BAD_DIM,
+            "cos", 1);
+    VCHECK_ROPE_COND(utils::everyone_is(data_type::f32, cos_desc->data_type,
+                             sin_desc->data_type),
+            VERBOSE_INVALID_DATATYPE, "cos");
+
+    const bool with_positions = pos_desc && pos_desc->ndims != 0;
+    if (with_positions) {
+        VCHECK_ROPE_COND(pos_desc->ndims == 2, VERBOSE_BAD_NDIMS, "pos",
+                pos_desc->ndims);
+        VCHECK_ROPE_COND(pos_desc->dims[0] == src_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "pos", 0, "src", 0);
+        VCHECK_ROPE_COND(pos_desc->dims[1] == src_desc->dims[2],
+                VERBOSE_INCONSISTENT_DIM, "pos", 1, "src", 2);
+        VCHECK_ROPE_COND(pos_desc->data_type == data_type::s32,
+                VERBOSE_INVALID_DATATYPE, "pos");
+    } else {
+        // Token s has position s, so all of them must be in the tables.
+        VCHECK_ROPE_COND(src_desc->dims[2] <= cos_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "src", 2, "cos", 0);
+    }
+
+    VCHECK_ROPE_COND(!any_memory_desc_host_scalar(src_desc, cos_desc,
+                             sin_desc, pos_desc, dst_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    return status::success;
+}
+
+static inline rope_desc_t create_rope_desc(const memory_desc_t *src_md,
+        const memory_desc_t *cos_md, const memory_desc_t *sin_md,
+        const memory_desc_t *pos_md, const memory_desc_t *dst_md,
+        rope_layout_t layout, dim_t rotary_dims) {
+    auto rope_desc = rope_desc_t();
+    rope_desc.primitive_kind = primitive_kind::rope;
+    rope_desc.src_desc = *src_md;
+    rope_desc.cos_desc = *cos_md;
+    rope_desc.sin_desc = *sin_md;
+    if (pos_md) rope_desc.pos_desc = *pos_md;
+    rope_desc.dst_desc = *dst_md;
+    rope_desc.layout = layout;
+    rope_desc.rotary_dims = rotary_dims;
+    return rope_desc;
+}
+
+static inline status_t create_rope_pd(
+        std::shared_ptr<primitive_desc_t> &rope_pd_, engine_t *engine,
+        const memory_desc_t *src_md, const memory_desc_t *cos_md,
+        const memory_desc_t *sin_md, const memory_desc_t *pos_md,
+        const memory_desc_t *dst_md, rope_layout_t layout, dim_t rotary_dims,
+        const primitive_attr_t *attr) {
+    CHECK(rope_desc_check(
+            src_md, cos_md, sin_md, pos_md, dst_md, layout, rotary_dims));
+
+    auto rope_desc = create_rope_desc(
+            src_md, cos_md, sin_md, pos_md, dst_md, layout, rotary_dims);
+
+    primitive_attr_t rope_attr = attr ? *attr : default_attr();
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)&rope_desc, &rope_attr, nullptr);
+
+    rope_pd_ = *(++it);
+    VCHECK_ROPE_COND(rope_pd_, "failed to create the RoPE primitive");
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
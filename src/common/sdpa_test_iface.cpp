@@ -45,3 +45,30 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
     return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
             (const dnnl::impl::op_desc_t *)&sdpa_desc, nullptr, attr);
 }
+
+dnnl_status_t DNNL_API sdpa_paged_kv_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t mask_desc, const_dnnl_memory_desc_t scale_desc,
+        bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, dnnl_dim_t kv_page_size,
+        const_dnnl_memory_desc_t block_table_desc,
+        const_dnnl_memory_desc_t seq_lens_desc,
+        const_dnnl_primitive_attr_t attr) {
+    CHECK(sdpa_desc_check(query_desc, key_desc, value_desc, dst_desc, mask_desc,
+            engine, attr, nullptr, nullptr));
+    CHECK(sdpa_paged_kv_desc_check(query_desc, key_desc, value_desc,
+            kv_page_size, block_table_desc, seq_lens_desc));
+    CHECK(sdpa_attr_check(
+            query_desc, key_desc, value_desc, engine, attr, nullptr, nullptr));
+
+    dnnl::impl::sdpa_desc_t sdpa_desc = dnnl::impl::create_sdpa_desc(query_desc,
+            key_desc, value_desc, dst_desc, mask_desc, scale_desc, invert_scale,
+            kv_head_number, static_cast<attn_mask_type_t>(attn_mask_type),
+            softmax_alg, nullptr, nullptr);
+    sdpa_desc_set_paged_kv(
+            sdpa_desc, kv_page_size, block_table_desc, seq_lens_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&sdpa_desc, nullptr, attr);
+}
@@ -32,6 +32,8 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_BLOCK_TABLE DNNL_ARG_SRC_3
+#define DNNL_ARG_SEQ_LENS DNNL_ARG_WEIGHTS_0
 
 // NOLINTBEGIN(modernize-use-using)
 /// Types of attention mask
@@ -90,12 +92,27 @@ struct sdpa_desc_t : public op_desc_t {
     attn_mask_type_t mask_type = attn_mask_type::undef;
     alg_kind_t softmax_alg = alg_kind::softmax_accurate;
 
+    // Paged KV cache. When `kv_page_size` is not zero, K and V are pools of
+    // pages of `kv_page_size` tokens each: [pages, kv_heads, D, page] and
+    // [pages, kv_heads, page, Dv]. The s32 block table [batch, max_pages]
+    // maps the logical pages of every sequence to the pool, the s32 sequence
+    // lengths [batch] hold the number of valid keys of every sequence. The
+    // queries are the last tokens of the respective sequences.
+    dim_t kv_page_size {};
+    memory_desc_t block_table_desc;
+    memory_desc_t seq_lens_desc;
+
+    bool with_paged_kv() const { return kv_page_size > 0; }
+
     // Number of queries.
     dnnl_dim_t queries() const { return q_desc.dims[q_desc.ndims - 2]; }
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
-    // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    // Number of keys, the maximum one for the paged KV cache.
+    dnnl_dim_t keys() const {
+        if (with_paged_kv()) return block_table_desc.dims[1] * kv_page_size;
+        return k_desc.dims[k_desc.ndims - 1];
+    }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     // Total batch size.
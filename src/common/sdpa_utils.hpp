@@ -81,6 +81,43 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_paged_kv_desc_check(const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        dim_t kv_page_size, const memory_desc_t *block_table_desc,
+        const memory_desc_t *seq_lens_desc) {
+    using namespace dnnl::impl::data_type;
+    int ndims = q_desc->ndims;
+    int r = ndims - 2, c = ndims - 1;
+    VCHECK_SDPA_COND(kv_page_size > 0, VERBOSE_BAD_PARAM, "kv_page_size");
+    VCHECK_SDPA_COND(k_desc->dims[c] == kv_page_size
+                    && v_desc->dims[r] == kv_page_size,
+            "k_desc->dims[%d](%s) and v_desc->dims[%d](%s) must match the "
+            "page size %s",
+            c, md2dim_str(k_desc).c_str(), r, md2dim_str(v_desc).c_str(),
+            std::to_string(kv_page_size).c_str());
+    VCHECK_SDPA_COND(k_desc->dims[0] == v_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "k", 0, "v", 0);
+
+    VCHECK_SDPA_COND(block_table_desc->ndims == 2, VERBOSE_BAD_NDIMS,
+            "block_table", block_table_desc->ndims);
+    VCHECK_SDPA_COND(block_table_desc->data_type == s32,
+            VERBOSE_INVALID_DATATYPE, "block_table");
+    VCHECK_SDPA_COND(block_table_desc->dims[0] == q_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "block_table", 0, "q", 0);
+    VCHECK_SDPA_COND(seq_lens_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "seq_lens", seq_lens_desc->ndims);
+    VCHECK_SDPA_COND(seq_lens_desc->data_type == s32,
+            VERBOSE_INVALID_DATATYPE, "seq_lens");
+    VCHECK_SDPA_COND(seq_lens_desc->dims[0] == q_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "seq_lens", 0, "q", 0);
+
+    VCHECK_SDPA_COND(!any_memory_desc_host_scalar(
+                             block_table_desc, seq_lens_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    return status::success;
+}
+
 static inline status_t sdpa_attr_check(const memory_desc_t *q_desc,
         const memory_desc_t *k_desc, const memory_desc_t *v_desc,
         const engine_t *engine, const primitive_attr_t *attr,
@@ -185,6 +222,15 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     return sdpa_desc;
 }
 
+// Turns K and V of an SDPA descriptor into the pools of a paged KV cache.
+static inline void sdpa_desc_set_paged_kv(sdpa_desc_t &sdpa_desc,
+        dim_t kv_page_size, const memory_desc_t *block_table_md,
+        const memory_desc_t *seq_lens_md) {
+    sdpa_desc.kv_page_size = kv_page_size;
+    sdpa_desc.block_table_desc = *block_table_md;
+    sdpa_desc.seq_lens_desc = *seq_lens_md;
+}
+
 static inline status_t create_sdpa_pd(
         std::shared_ptr<primitive_desc_t> &sdpa_pd_, engine_t *engine,
         const memory_desc_t *q_md, const memory_desc_t *k_md,
@@ -30,6 +30,9 @@
 #include "memory_desc.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
+#include "gated_mlp_types.hpp"
+#include "matmul_topk_types.hpp"
+#include "rope_types.hpp"
 #include "sdpa_types.hpp"
 #include "utils.hpp"
 
@@ -366,8 +369,8 @@ inline bool blocking_desc_is_equal(const memory_desc_t &lhs_md,
 
     auto is_sparse_packed_desc = [](const memory_desc_t &md) {
         return md.format_kind == format_kind::sparse
-                && md.format_desc.sparse_desc.encoding
-                == sparse_encoding::packed;
+                && utils::one_of(md.format_desc.sparse_desc.encoding,
+                        sparse_encoding::packed, sparse_encoding::structured);
     };
 
     const bool lhs_is_sparse_packed_desc = is_sparse_packed_desc(lhs_md);
@@ -431,7 +434,11 @@ inline bool rnn_packed_desc_is_equal(
 
 inline bool sparse_desc_is_equal(
         const sparse_desc_t &lhs, const sparse_desc_t &rhs) {
-    bool ok = lhs.encoding == rhs.encoding && lhs.nnz == rhs.nnz;
+    bool ok = lhs.encoding == rhs.encoding && lhs.nnz == rhs.nnz
+            && lhs.structured_n == rhs.structured_n
+            && lhs.structured_m == rhs.structured_m
+            && lhs.bsr_block_dims[0] == rhs.bsr_block_dims[0]
+            && lhs.bsr_block_dims[1] == rhs.bsr_block_dims[1];
     if (!ok) return false;
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
@@ -1005,6 +1012,41 @@ inline bool operator==(const zero_pad_desc_t &lhs, const zero_pad_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(
+        const gated_mlp_desc_t &lhs, const gated_mlp_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(w_gate_desc)
+            && COMPARE_DESC_MEMBERS(w_up_desc)
+            && COMPARE_DESC_MEMBERS(w_down_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(activation)
+            && COMPARE_FLOAT_DESC_MEMBERS(alpha)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta);
+    return ret;
+}
+
+inline bool operator==(
+        const matmul_topk_desc_t &lhs, const matmul_topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_values_desc)
+            && COMPARE_DESC_MEMBERS(dst_indices_desc);
+    return ret;
+}
+
+inline bool operator==(const rope_desc_t &lhs, const rope_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(cos_desc)
+            && COMPARE_DESC_MEMBERS(sin_desc)
+            && COMPARE_DESC_MEMBERS(pos_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc) && COMPARE_DESC_MEMBERS(layout)
+            && COMPARE_DESC_MEMBERS(rotary_dims);
+    return ret;
+}
+
 inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(q_desc)
@@ -1022,7 +1064,10 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(invert_scale)
             && COMPARE_DESC_MEMBERS(kv_head_number)
             && COMPARE_DESC_MEMBERS(mask_type)
-            && COMPARE_DESC_MEMBERS(softmax_alg);
+            && COMPARE_DESC_MEMBERS(softmax_alg)
+            && COMPARE_DESC_MEMBERS(kv_page_size)
+            && COMPARE_DESC_MEMBERS(block_table_desc)
+            && COMPARE_DESC_MEMBERS(seq_lens_desc);
     return ret;
 }
 
@@ -1054,11 +1099,33 @@ inline memory_desc_t cvt_blocked2sparse_packed(
     return sparse_packed_md;
 }
 
+// Unlike the packed encoding, the number of non-zero entries for the
+// structured encoding is defined by the blocked layout: each block keeps
+// exactly `n / m` of its (padded) elements.
+inline memory_desc_t cvt_blocked2sparse_structured(
+        const memory_desc_t &blocked_md, dim_t n, dim_t m) {
+    if (blocked_md.format_kind != format_kind::blocked) return glob_zero_md;
+
+    dim_t padded_nelems = 1;
+    for (int d = 0; d < blocked_md.ndims; d++)
+        padded_nelems *= blocked_md.padded_dims[d];
+
+    auto sparse_md = blocked_md;
+    sparse_md.format_kind = format_kind::sparse;
+    auto &sparse_desc = sparse_md.format_desc.sparse_desc;
+    sparse_desc.encoding = sparse_encoding::structured;
+    sparse_desc.nnz = padded_nelems / m * n;
+    sparse_desc.structured_n = n;
+    sparse_desc.structured_m = m;
+    sparse_desc.packed_desc = blocked_md.format_desc.blocking;
+    return sparse_md;
+}
+
 inline memory_desc_t cvt_sparse_packed2blocked(
         const memory_desc_t &sparse_packed_md) {
     if (sparse_packed_md.format_kind != format_kind::sparse
-            || sparse_packed_md.format_desc.sparse_desc.encoding
-                    != sparse_encoding::packed)
+            || !utils::one_of(sparse_packed_md.format_desc.sparse_desc.encoding,
+                    sparse_encoding::packed, sparse_encoding::structured))
         return glob_zero_md;
 
     const blocking_desc_t &blk_desc
@@ -1151,10 +1218,15 @@ inline status_t memory_desc_init_by_tag(
         return status::invalid_arguments;
 
     if (is_sparse) {
-        if (md.format_desc.sparse_desc.encoding != sparse_encoding::packed
+        const auto &sparse_desc = md.format_desc.sparse_desc;
+        if (!utils::one_of(sparse_desc.encoding, sparse_encoding::packed,
+                    sparse_encoding::structured)
                 || md.offset0 != 0)
             return status::invalid_arguments;
-        md = cvt_blocked2sparse_packed(md_tmp, md.format_desc.sparse_desc.nnz);
+        md = sparse_desc.encoding == sparse_encoding::structured
+                ? cvt_blocked2sparse_structured(md_tmp,
+                        sparse_desc.structured_n, sparse_desc.structured_m)
+                : cvt_blocked2sparse_packed(md_tmp, sparse_desc.nnz);
     } else {
         md = md_tmp;
     }
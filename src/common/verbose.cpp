@@ -41,6 +41,9 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "gated_mlp_pd.hpp"
+#include "matmul_topk_pd.hpp"
+#include "rope_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -634,6 +637,7 @@ int get_runtime_mask(const memory_desc_t *md) {
 
 int get_arg_index(int arg) {
     if (arg & DNNL_ARG_MULTIPLE_SRC) return arg - DNNL_ARG_MULTIPLE_SRC;
+    if (arg & DNNL_ARG_MULTIPLE_DST) return arg - DNNL_ARG_MULTIPLE_DST;
     switch (arg) {
         case DNNL_ARG_SRC_0: return 0;
         case DNNL_ARG_SRC_1: return 1;
@@ -645,6 +649,7 @@ int get_arg_index(int arg) {
 
 std::string get_arg(int arg) {
     if (arg & DNNL_ARG_MULTIPLE_SRC) return "msrc";
+    if (arg & DNNL_ARG_MULTIPLE_DST) return "mdst";
 
     std::string s;
     switch (arg) {
@@ -727,6 +732,11 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    const bool constant_weights = attr->constant_weights_;
+    if (constant_weights) {
+        ss << field_delim() << "attr-constant-weights:" << constant_weights;
+    }
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -752,7 +762,7 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-post-ops:";
         for (int i = 0; i < po.len(); ++i) {
             const post_ops_t::entry_t &e = po.entry_[i];
-            switch (e.kind) {
+            switch ((int)e.kind) {
                 case primitive_kind::sum: {
                     const auto &s = e.sum;
                     ss << delim << "sum";
@@ -801,6 +811,18 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     ss << delim << "prelu"
                        << ":" << ep.mask;
                 } break;
+                case primitive_kind::rope: {
+                    const auto &er = e.rope;
+                    ss << delim << "rope:"
+                       << (er.layout == rope_layout::interleaved ? "interleaved"
+                                                                 : "half_split")
+                       << ":" << er.head_size << ":" << er.rotary_dims;
+                } break;
+                case primitive_kind::pooling: {
+                    const auto &ep = e.pooling;
+                    ss << delim << ep.alg << ":" << ep.kernel << ":"
+                       << ep.stride << ":" << ep.padding;
+                } break;
                 default: assert(!"unsupported post op primitive kind!"); break;
             }
             delim = attr_delim;
@@ -825,6 +847,33 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             default: assert(!"unsupported format_kind");
         }
     }
+
+    const src_norm_t &src_norm = attr->src_norm_;
+    if (!src_norm.has_default_values()) {
+        ss << field_delim() << "attr-src-norm:"
+           << normalization_flags2str(src_norm.flags_) << ":"
+           << src_norm.epsilon_;
+    }
+
+    const lora_t &lora = attr->lora_;
+    if (!lora.has_default_values()) {
+        ss << field_delim() << "attr-lora:" << lora.rank_ << ":"
+           << lora.num_adapters_ << ":" << lora.alpha_;
+    }
+
+    const dst_split_t &dst_split = attr->dst_split_;
+    if (!dst_split.has_default_values()) {
+        ss << field_delim() << "attr-dst-split:";
+        std::string delim = empty_delim;
+        for (const auto &md : dst_split.dsts_) {
+            ss << delim << md.data_type << ":" << md2dim_str(&md) << ":"
+               << md2fmt_tag_str(&md);
+            delim = attr_delim;
+        }
+    }
+
+    if (!attr->batch_stats_.has_default_values())
+        ss << field_delim() << "attr-batch-stats:1";
     return ss;
 }
 
@@ -1638,6 +1687,8 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         else
             ss << "device";
     }
+    if (desc->with_paged_kv())
+        ss << delimiter << "kv:paged:" << desc->kv_page_size;
 
     ss << "," << md2dim_str(pd->qry_md()) << ":" << md2dim_str(pd->key_md())
        << ":" << md2dim_str(pd->val_md());
@@ -1645,6 +1696,91 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_gated_mlp(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    const gated_mlp_desc_t *desc = pd->desc();
+    ss << md2fmt_str("src", pd->src_md(), pd->invariant_src_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str(
+            "wei_gate", pd->w_gate_md(), pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str(
+            "wei_up", pd->w_up_md(), pd->invariant_src_user_format_kind(2))
+       << " ";
+    ss << md2fmt_str(
+            "wei_down", pd->w_down_md(), pd->invariant_src_user_format_kind(3))
+       << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
+       << ",";
+
+    ss << pd->attr() << ",alg:" << desc->activation << " alpha:" << desc->alpha
+       << " beta:" << desc->beta;
+
+    ss << "," << md2dim_str(pd->src_md()) << ":" << md2dim_str(pd->w_gate_md())
+       << ":" << md2dim_str(pd->w_down_md());
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_matmul_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), pd->invariant_src_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str(
+            "wei", pd->weights_md(), pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str("dst_values", pd->dst_values_md(),
+            pd->invariant_dst_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str("dst_indices", pd->dst_indices_md(),
+            pd->invariant_dst_user_format_kind(1))
+       << ",";
+
+    ss << pd->attr() << ",topk:" << pd->TOPK();
+
+    ss << "," << md2dim_str(pd->src_md()) << ":"
+       << md2dim_str(pd->weights_md());
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->src_md(), pd->invariant_src_user_format_kind(0))
+       << " ";
+    ss << md2fmt_str("cos", pd->cos_md(), pd->invariant_src_user_format_kind(1))
+       << " ";
+    ss << md2fmt_str("sin", pd->sin_md(), pd->invariant_src_user_format_kind(2))
+       << " ";
+    if (pd->with_positions())
+        ss << md2fmt_str("pos", pd->pos_md(),
+                pd->invariant_src_user_format_kind(3))
+           << " ";
+    ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
+       << ",";
+
+    ss << pd->attr() << ",layout:"
+       << (pd->layout() == rope_layout::interleaved ? "interleaved"
+                                                    : "half_split")
+       << " rotary_dims:" << pd->rotary_dims();
+
+    ss << "," << md2dim_str(pd->src_md());
+
+    return ss.str();
+}
+
 } // namespace
 
 std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
@@ -1793,6 +1929,9 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(softmax);
             CASE(sum);
             CASE(sdpa);
+            CASE(gated_mlp);
+            CASE(matmul_topk);
+            CASE(rope);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -45,10 +45,14 @@
 #include "cpu/x64/jit_avx512_core_x8s8s32x_convolution.hpp"
 #include "cpu/x64/jit_brdgmm_dw_conv.hpp"
 #include "cpu/x64/jit_brgemm_1x1_conv.hpp"
+#include "cpu/x64/jit_brgemm_1x1_dw_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/x64/jit_brgemm_conv_pool.hpp"
+#include "cpu/x64/jit_brgemm_group_conv.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -123,6 +127,10 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, f32, f32, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t)
+            CPU_INSTANCE_AVX2(brgemm_1x1_dw_convolution_fwd_t)
+            CPU_INSTANCE_AVX2(brgemm_group_convolution_fwd_t)
+            CPU_INSTANCE_AVX2(brgemm_conv_pool_fwd_t)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx10_2_512_amx_2>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx10_2_512_amx_2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
@@ -25,7 +25,11 @@
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
+#include "common/gated_mlp_types.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/matmul_topk_types.hpp"
+#include "common/rope_types.hpp"
+#include "common/sdpa_types.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -61,16 +65,20 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(gated_mlp);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(matmul);
+DECLARE_IMPL_LIST(matmul_topk);
 DECLARE_IMPL_LIST(pooling);
 DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(rope);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
 
@@ -97,19 +105,22 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gated_mlp);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
             CASE(matmul);
+            CASE(matmul_topk);
             CASE(pooling);
             CASE(prelu);
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
-            case primitive_kind::sdpa: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
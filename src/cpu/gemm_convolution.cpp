@@ -91,8 +91,7 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const exec_ctx_t &ctx,
     const bool is_problem_3d = pd()->ndims() == 5;
 
     assert(IMPLICATION(is_problem_3d,
-            jcp.oh_block == jcp.oh && jcp.ow_block == jcp.ow
-                    && jcp.ic_block == jcp.ic));
+            jcp.ow_block == jcp.ow && jcp.ic_block == jcp.ic));
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
 
     const dim_t nb_oh = div_up(jcp.oh, jcp.oh_block);
@@ -102,13 +101,6 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const exec_ctx_t &ctx,
     balance211(work_amount, nthr, ithr, start, end);
     nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ohb, nb_oh, owb, nb_ow);
 
-    if (jcp.im2col_sz && is_problem_3d) {
-        // jit_gemm_convolution_utils::im2col_dt_3d() requires external
-        // data initialization by zeroes
-        PRAGMA_OMP_SIMD()
-        for (ptrdiff_t i = 0; i < jcp.im2col_sz; i++)
-            col[i] = 0.0f;
-    }
     for (dim_t iwork = start; iwork < end; ++iwork) {
         dim_t oh = ohb * jcp.oh_block;
         dim_t ow = owb * jcp.ow_block;
@@ -118,7 +110,9 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const exec_ctx_t &ctx,
 
         const int h_step = nstl::min(jcp.oh_block, jcp.oh - oh);
         const int w_step = nstl::min(jcp.ow_block, jcp.ow - ow);
-        if (jcp.im2col_sz && is_problem_3d) {
+        // The transposed source is reused by all blocks of rows of an image.
+        if (jcp.im2col_sz && is_problem_3d
+                && (iwork == start || (ohb == 0 && owb == 0))) {
             jit_gemm_convolution_utils::transpose_dt(jcp, src, imtr);
         }
 
@@ -129,7 +123,7 @@ status_t gemm_convolution_fwd_t::execute_forward_thr_nspc(const exec_ctx_t &ctx,
             if (jcp.im2col_sz) {
                 if (is_problem_3d)
                     jit_gemm_convolution_utils::im2col_dt_3d<data_t, data_t>(
-                            jcp, imtr, col, od);
+                            jcp, imtr, col, od, oh, h_step);
                 else
                     jit_gemm_convolution_utils::im2col_dt<data_t, data_t>(
                             jcp, src, imtr, col, oh, h_step, ow, w_step);
@@ -687,7 +681,7 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
                         if (jcp.im2col_sz) {
                             if (is_problem_3d)
                                 jit_gemm_convolution_utils::im2col_dt_3d<data_t,
-                                        data_t>(jcp, imtr, _col, od);
+                                        data_t>(jcp, imtr, _col, od, 0, jcp.oh);
                             else
                                 jit_gemm_convolution_utils::im2col_dt<data_t,
                                         data_t>(jcp, _src, imtr, _col, 0,
@@ -274,10 +274,10 @@ template void transpose_dt(const conv_gemm_conf_t &jcp,
 template void transpose_dt(const conv_gemm_conf_t &jcp,
         const bfloat16_t *__restrict im, bfloat16_t *__restrict imtr);
 
-/* col[kd][kh][kw][g][ic][od][oh][ow] <-- im2col_dt_3d(im[id][ih][iw][g][ic]) */
+/* col[kd][kh][kw][ic][hb][ow] <-- im2col_dt_3d(imtr[ic][id][ih][iw]) */
 template <typename orig_im_dt, typename orig_col_dt>
 void im2col_dt_3d(const conv_gemm_conf_t &jcp, const void *__restrict _imtr,
-        orig_col_dt *__restrict _col, dim_t od) {
+        orig_col_dt *__restrict _col, dim_t od, dim_t hs, dim_t hb) {
     // For performance reasons, use uint16_t as a proxy for bfloat16_t
     using im_dt =
             typename utils::conditional<data_traits_t<orig_im_dt>::data_type
@@ -301,12 +301,20 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp, const void *__restrict _imtr,
     const dim_t fp = jcp.f_pad;
     const dim_t tp = jcp.t_pad;
     const dim_t lp = jcp.l_pad;
-    const dim_t col_ic_s = jcp.oh * jcp.ow;
+    const dim_t he = hs + hb;
+    const dim_t col_ic_s = hb * jcp.ow;
     const dim_t col_kw_s = jcp.ic * col_ic_s;
     const dim_t col_kh_s = jcp.kw * col_kw_s;
     const dim_t col_kd_s = jcp.kh * col_kh_s;
     const dim_t IHW = jcp.ih * jcp.iw;
-    const dim_t OHW = jcp.oh * jcp.ow;
+
+    // Only the rows [hs, hs + hb) of the output plane are written. Padded
+    // points are filled explicitly since the same buffer is reused for
+    // different blocks of rows.
+    auto fill = [&](col_dt *__restrict c, dim_t len) {
+        for (dim_t i = 0; i < len; i++)
+            c[i] = shift;
+    };
 
     if (sd == 1 && sh == 1 && sw == 1 && dd == 1 && dh == 1 && dw == 1)
         parallel_nd(jcp.kd, jcp.kh, jcp.kw, jcp.ic,
@@ -315,27 +323,31 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp, const void *__restrict _imtr,
                             + kh * col_kh_s + kw * col_kw_s + ic * col_ic_s;
                     const dim_t id = od - fp + kd;
                     if (id < 0 || id >= jcp.id) {
-                        for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                        fill(col_loc, col_ic_s);
                         return;
                     }
                     const im_dt *__restrict imtr_loc
                             = imtr + (ic * jcp.id + id) * IHW;
-                    const dim_t oh_start = saturate(dim_t(0), jcp.oh, tp - kh);
-                    const dim_t oh_end
-                            = saturate(dim_t(0), jcp.oh, jcp.ih + tp - kh);
+                    const dim_t oh_start = saturate(hs, he, tp - kh);
+                    const dim_t oh_end = saturate(hs, he, jcp.ih + tp - kh);
                     const dim_t ow_start = saturate(dim_t(0), jcp.ow, lp - kw);
                     const dim_t ow_end
                             = saturate(dim_t(0), jcp.ow, jcp.iw + lp - kw);
+                    fill(col_loc, (oh_start - hs) * jcp.ow);
                     for (dim_t oh = oh_start, ih = oh_start - tp + kh;
                             oh < oh_end; oh++, ih++) {
-                        col_dt *__restrict col_h = col_loc + oh * jcp.ow;
+                        col_dt *__restrict col_h
+                                = col_loc + (oh - hs) * jcp.ow;
                         const im_dt *__restrict imtr_h = imtr_loc + ih * jcp.iw;
+                        fill(col_h, ow_start);
                         for (dim_t ow = ow_start, iw = ow_start - lp + kw;
                                 ow < ow_end; ow++, iw++) {
                             col_h[ow] = imtr_h[iw];
                         }
+                        fill(col_h + ow_end, jcp.ow - ow_end);
                     }
+                    fill(col_loc + (oh_end - hs) * jcp.ow,
+                            (he - oh_end) * jcp.ow);
                 });
     else if (sd == 2 && sh == 2 && sw == 2 && dd == 1 && dh == 1 && dw == 1)
         parallel_nd(jcp.kd, jcp.kh, jcp.kw, jcp.ic,
@@ -344,29 +356,34 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp, const void *__restrict _imtr,
                             + kh * col_kh_s + kw * col_kw_s + ic * col_ic_s;
                     const dim_t id = od * 2 - fp + kd;
                     if (id < 0 || id >= jcp.id) {
-                        for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                        fill(col_loc, col_ic_s);
                         return;
                     }
                     const im_dt *__restrict imtr_loc
                             = imtr + (ic * jcp.id + id) * IHW;
                     const dim_t oh_start
-                            = saturate(dim_t(0), jcp.oh, div_up(tp - kh, 2));
-                    const dim_t oh_end = saturate(
-                            dim_t(0), jcp.oh, div_up(jcp.ih + tp - kh, 2));
+                            = saturate(hs, he, div_up(tp - kh, 2));
+                    const dim_t oh_end
+                            = saturate(hs, he, div_up(jcp.ih + tp - kh, 2));
                     const dim_t ow_start
                             = saturate(dim_t(0), jcp.ow, div_up(lp - kw, 2));
                     const dim_t ow_end = saturate(
                             dim_t(0), jcp.ow, div_up(jcp.iw + lp - kw, 2));
+                    fill(col_loc, (oh_start - hs) * jcp.ow);
                     for (dim_t oh = oh_start, ih = oh_start * 2 - tp + kh;
                             oh < oh_end; ++oh, ih += 2) {
-                        col_dt *__restrict col_h = col_loc + oh * jcp.ow;
+                        col_dt *__restrict col_h
+                                = col_loc + (oh - hs) * jcp.ow;
                         const im_dt *__restrict imtr_h = imtr_loc + ih * jcp.iw;
+                        fill(col_h, ow_start);
                         for (dim_t ow = ow_start, iw = ow_start * 2 - lp + kw;
                                 ow < ow_end; ++ow, iw += 2) {
                             col_h[ow] = imtr_h[iw];
                         }
+                        fill(col_h + ow_end, jcp.ow - ow_end);
                     }
+                    fill(col_loc + (oh_end - hs) * jcp.ow,
+                            (he - oh_end) * jcp.ow);
                 });
     else
         parallel_nd(jcp.kd, jcp.kh, jcp.kw, jcp.ic,
@@ -375,41 +392,50 @@ void im2col_dt_3d(const conv_gemm_conf_t &jcp, const void *__restrict _imtr,
                             + kh * col_kh_s + kw * col_kw_s + ic * col_ic_s;
                     const dim_t id = od * sd - fp + kd * dd;
                     if (id < 0 || id >= jcp.id) {
-                        for (ptrdiff_t i = 0; i < OHW; i++)
-                            col_loc[i] = shift;
+                        fill(col_loc, col_ic_s);
                         return;
                     }
                     const im_dt *__restrict imtr_loc
                             = imtr + (ic * jcp.id + id) * IHW;
-                    const dim_t oh_start = saturate(
-                            dim_t(0), jcp.oh, div_up(tp - kh * dh, sh));
-                    const dim_t oh_end = saturate(dim_t(0), jcp.oh,
-                            div_up(jcp.ih + tp - kh * dh, sh));
+                    const dim_t oh_start
+                            = saturate(hs, he, div_up(tp - kh * dh, sh));
+                    const dim_t oh_end = saturate(
+                            hs, he, div_up(jcp.ih + tp - kh * dh, sh));
                     const dim_t ow_start = saturate(
                             dim_t(0), jcp.ow, div_up(lp - kw * dw, sw));
                     const dim_t ow_end = saturate(dim_t(0), jcp.ow,
                             div_up(jcp.iw + lp - kw * dw, sw));
+                    fill(col_loc, (oh_start - hs) * jcp.ow);
                     for (dim_t oh = oh_start, ih = oh_start * sh - tp + kh * dh;
                             oh < oh_end; ++oh, ih += sh) {
-                        col_dt *__restrict col_h = col_loc + oh * jcp.ow;
+                        col_dt *__restrict col_h
+                                = col_loc + (oh - hs) * jcp.ow;
                         const im_dt *__restrict imtr_h = imtr_loc + ih * jcp.iw;
+                        fill(col_h, ow_start);
                         for (dim_t ow = ow_start,
                                    iw = ow_start * sw - lp + kw * dw;
                                 ow < ow_end; ++ow, iw += sw) {
                             col_h[ow] = imtr_h[iw];
                         }
+                        fill(col_h + ow_end, jcp.ow - ow_end);
                     }
+                    fill(col_loc + (oh_end - hs) * jcp.ow,
+                            (he - oh_end) * jcp.ow);
                 });
 }
 
 template void im2col_dt_3d<int8_t, uint8_t>(const conv_gemm_conf_t &jcp,
-        const void *__restrict im, uint8_t *__restrict col, dim_t od);
+        const void *__restrict im, uint8_t *__restrict col, dim_t od, dim_t hs,
+        dim_t hb);
 template void im2col_dt_3d<uint8_t, uint8_t>(const conv_gemm_conf_t &jcp,
-        const void *__restrict im, uint8_t *__restrict col, dim_t od);
+        const void *__restrict im, uint8_t *__restrict col, dim_t od, dim_t hs,
+        dim_t hb);
 template void im2col_dt_3d<float, float>(const conv_gemm_conf_t &jcp,
-        const void *__restrict im, float *__restrict col, dim_t od);
+        const void *__restrict im, float *__restrict col, dim_t od, dim_t hs,
+        dim_t hb);
 template void im2col_dt_3d<bfloat16_t, bfloat16_t>(const conv_gemm_conf_t &jcp,
-        const void *__restrict im, bfloat16_t *__restrict col, dim_t od);
+        const void *__restrict im, bfloat16_t *__restrict col, dim_t od,
+        dim_t hs, dim_t hb);
 
 /* col[ic][kh][kw][oh][ow] <-- im2col(im[ic][ih][iw]) */
 template <typename data_type_t>
@@ -994,6 +1020,26 @@ void col2im(const conv_gemm_conf_t &jcp, const float *col, float *im,
         parallel_nd(jcp.ic, ker);
 }
 
+namespace {
+// Streaming im2col for nspc forward convolution: if the im2col buffer for a
+// whole output plane does not fit into L2, it is built and consumed by gemm
+// by blocks of output rows instead. `L2` is in elements of the source.
+void init_streaming_im2col(conv_gemm_conf_t &jcp, dim_t L2, int simd_w) {
+    if (!jcp.im2col_sz || jcp.oh_block != jcp.oh || jcp.ow_block != jcp.ow)
+        return;
+
+    const dim_t row_size = static_cast<dim_t>(jcp.ic) * jcp.ks * jcp.ow;
+    if (row_size * jcp.oh <= L2) return;
+
+    // Too narrow blocks make gemm spend more time on packing the weights
+    // than on the computations.
+    const dim_t min_rows = nstl::min<dim_t>(jcp.oh, div_up(4 * simd_w, jcp.ow));
+    jcp.oh_block = static_cast<int>(
+            saturate<dim_t>(min_rows, jcp.oh, L2 / row_size));
+    jcp.im2col_sz = static_cast<ptrdiff_t>(row_size) * jcp.oh_block;
+}
+} // namespace
+
 status_t init_conf(conv_gemm_conf_t &jcp,
         memory_tracking::registrar_t &scratchpad, const convolution_desc_t &cd,
         memory_desc_t &src_md, memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -1347,6 +1393,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                 jcp.im2col_sz
                         = (ptrdiff_t)ic * jcp.ks * jcp.oh_block * jcp.ow_block;
             }
+            init_streaming_im2col(jcp, L2, simd_w);
             //  For threading selection in bwd_d we do:
             //  1. Rough estimation of efficiency for inner and outer threading.
             //  2. Gemm size estimation in assumption that it does not work
@@ -1518,6 +1565,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                 jcp.im2col_sz
                         = (ptrdiff_t)ic * jcp.ks * jcp.oh_block * jcp.ow_block;
             }
+            init_streaming_im2col(jcp, L2, simd_w);
             //  For threading selection in fwd_d we do:
             //  1. Rough estimation of efficiency for inner and outer threading.
             //  2. Gemm size estimation in assumption that it does not work
@@ -214,8 +214,7 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward_thr(const int ithr,
 
     const bool is_problem_3d = pd()->ndims() == 5;
     assert(IMPLICATION(is_problem_3d,
-            jcp.oh_block == jcp.oh && jcp.ow_block == jcp.ow
-                    && jcp.ic_block == jcp.ic));
+            jcp.ow_block == jcp.ow && jcp.ic_block == jcp.ic));
 
     const dim_t nb_oh = div_up(jcp.oh, jcp.oh_block);
     const dim_t nb_ow = div_up(jcp.ow, jcp.ow_block);
@@ -237,7 +236,9 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward_thr(const int ithr,
                 = _wei_comp ? _wei_comp + g * jcp.oc : nullptr;
         const int h_step = nstl::min(jcp.oh_block, jcp.oh - oh);
         const int w_step = nstl::min(jcp.ow_block, jcp.ow - ow);
-        if (jcp.im2col_sz && is_problem_3d)
+        // The transposed source is reused by all blocks of rows of an image.
+        if (jcp.im2col_sz && is_problem_3d
+                && (iwork == start || (ohb == 0 && owb == 0)))
             jit_gemm_convolution_utils::transpose_dt<char>(jcp, src, imtr);
 
         for (int od = 0; od < jcp.od; od++) {
@@ -250,7 +251,7 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward_thr(const int ithr,
                     case data_type::s8: {
                         if (is_problem_3d)
                             jit_gemm_convolution_utils::im2col_dt_3d<int8_t,
-                                    uint8_t>(jcp, imtr, col, od);
+                                    uint8_t>(jcp, imtr, col, od, oh, h_step);
                         else
                             jit_gemm_convolution_utils::im2col_dt<int8_t,
                                     uint8_t>(jcp, src, imtr, col, oh, h_step,
@@ -259,7 +260,7 @@ status_t gemm_x8s8s32x_convolution_fwd_t::execute_forward_thr(const int ithr,
                     case data_type::u8: {
                         if (is_problem_3d)
                             jit_gemm_convolution_utils::im2col_dt_3d<uint8_t,
-                                    uint8_t>(jcp, imtr, col, od);
+                                    uint8_t>(jcp, imtr, col, od, oh, h_step);
                         else
                             jit_gemm_convolution_utils::im2col_dt<uint8_t,
                                     uint8_t>(jcp, src, imtr, col, oh, h_step,
@@ -26,6 +26,7 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -85,6 +86,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(gemm_x8s8s32x_matmul_t)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE_X64(brgemm_bsr_matmul_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         /* eol */
@@ -40,7 +40,7 @@ void ref_matmul_t::pd_t::init_scratchpad() {
     nthr_ = dnnl_get_max_threads();
     ntasks_ = nthr_;
     auto dst_scales = attr()->scales_.get(DNNL_ARG_DST);
-    if (dst_scales.is_mx()) {
+    if (dst_scales.is_dynamic()) {
         auto scratchpad = scratchpad_registry().registrar();
         const memory_desc_wrapper dst_d(dst_md());
         dim_t group_size = dst_scales.get_group_size();
@@ -296,7 +296,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                             args.dst_md = pd()->dst_md();
                             ref_post_ops->execute(d, args);
                         }
-                        if (attr_scales.get(DNNL_ARG_DST).is_mx()) {
+                        if (attr_scales.get(DNNL_ARG_DST).is_dynamic()) {
                             max_dst_group = std::max(max_dst_group, ::fabsf(d));
                             auto temp_dst_off
                                     = (ithr * dst_scale_group_m + m_gidx)
@@ -320,14 +320,21 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                         }
                     }
 
-                    if (attr_scales.get(DNNL_ARG_DST).is_mx()) {
+                    if (attr_scales.get(DNNL_ARG_DST).is_dynamic()) {
                         // MXSPEC does round_down_pow2(dst_d.data_type() /
                         // round_down_pow2(max_dst_group) so the rounding
                         // to a power of two happens before the division,
                         // and not after.
-                        float dst_group_scale = types::round_to_dt(dst_scale_dt,
-                                                        max_dst_group)
-                                / types::max_value<float>(dst_d.data_type());
+                        float dst_group_scale = attr_scales.get(DNNL_ARG_DST)
+                                                        .is_mx()
+                                ? types::round_to_dt(
+                                          dst_scale_dt, max_dst_group)
+                                        / types::max_value<float>(
+                                                dst_d.data_type())
+                                : types::round_to_dt(dst_scale_dt,
+                                        max_dst_group
+                                                / types::max_value<float>(
+                                                        dst_d.data_type()));
 
                         dims_t dst_dims_idx;
                         const size_t offset = mb * M * N + m_ * N + n_;
@@ -343,7 +350,12 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                         io::store_float_value(dst_scale_dt, dst_group_scale,
                                 dst_dynamic_scales, dst_scale_off);
                         // we pre-invert the scale to apply it as multiply for the group
-                        dst_group_scale = 1.f / dst_group_scale;
+                        // (an all-zero group has a zero scale for dynamic_fp)
+                        dst_group_scale = dst_group_scale == 0.f
+                                        && !attr_scales.get(DNNL_ARG_DST)
+                                                    .is_mx()
+                                ? 0.f
+                                : 1.f / dst_group_scale;
 
                         for_(dim_t m_gidx = 0; m_gidx < dst_scale_group_m;
                                 m_gidx++)
@@ -48,7 +48,17 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         io::store_float_value(dst_d.data_type(), 0.0f, dst, dst_idx);
     });
 
-    if (weights_d.is_sparse_desc()) {
+    if (weights_d.is_sparse_desc()
+            && weights_d.encoding() == sparse_encoding::bsr) {
+        const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+        const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+        auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+        auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+        const auto &block_dims = weights_d.sparse_desc().bsr_block_dims;
+        run_bsr_kernel(src, wei_values, wei_indices, wei_pointers, dst, M, N,
+                K, block_dims[0], block_dims[1], mm_dt);
+    } else if (weights_d.is_sparse_desc()) {
 
         const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
         const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
@@ -197,6 +207,35 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const void *src, const void *values,
+        const int32_t *indices, const int32_t *pointers, void *res,
+        const dim_t M, const dim_t N, const dim_t K, const dim_t bk,
+        const dim_t bn, const data_type_t mm_dt) const {
+    const dim_t KB = K / bk;
+    // Each row of the destination is owned by a single thread, the blocks of
+    // the weights are traversed in the storage order.
+    parallel_nd(M, [&](dim_t m) {
+        for (dim_t kb = 0; kb < KB; kb++) {
+            for (dim_t blk = pointers[kb]; blk < pointers[kb + 1]; blk++) {
+                const dim_t n0 = indices[blk] * bn;
+                const dim_t blk_off = blk * bk * bn;
+                for (dim_t k = 0; k < bk; k++) {
+                    const dim_t a_idx = m * K + kb * bk + k;
+                    const float a_val = io::load_float_value(mm_dt, src, a_idx);
+                    for (dim_t n = 0; n < bn; n++) {
+                        const dim_t c_idx = m * N + n0 + n;
+                        const float b_val = io::load_float_value(
+                                mm_dt, values, blk_off + k * bn + n);
+                        float c_val = io::load_float_value(mm_dt, res, c_idx);
+                        c_val += a_val * b_val;
+                        io::store_float_value(mm_dt, c_val, res, c_idx);
+                    }
+                }
+            }
+        }
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -57,13 +57,21 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
                     utils::everyone_is(f16, src_type, wei_type, dst_type)
                             || utils::everyone_is(
-                                    f32, src_type, wei_type, dst_type),
+                                    f32, src_type, wei_type, dst_type)
+                            || utils::everyone_is(
+                                    bf16, src_type, wei_type, dst_type),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            // With sparse weights the destination is accumulated in place,
+            // which is too lossy for bf16.
+            VDISPATCH_MATMUL(
+                    IMPLICATION(src_type == bf16, src_d.is_sparse_desc()),
                     VERBOSE_UNSUPPORTED_DT_CFG);
 
             if (src_d.is_sparse_desc()) {
@@ -86,7 +94,9 @@ struct ref_sparse_matmul_t : public primitive_t {
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
+                        IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                            sparse_encoding::csr,
+                                            sparse_encoding::bsr),
                                 utils::everyone_is(s32, wei_d.metadata_type(0),
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -148,6 +158,13 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Executes the matrix multiplication, C = A x B for BSR encoded
+    // weights. Each non-zero block of B is multiplied densely.
+    void run_bsr_kernel(const void *src, const void *values,
+            const int32_t *indices, const int32_t *pointers, void *res,
+            const dim_t M, const dim_t N, const dim_t K, const dim_t bk,
+            const dim_t bn, const data_type_t mm_dt) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
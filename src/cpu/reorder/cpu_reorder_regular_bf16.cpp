@@ -62,6 +62,8 @@ const impl_list_map_t &regular_bf16_impl_list_map() {
             REG_SR(bf16, any, f8_e5m2, any, fmt_order::any, spec::reference)
             REG_SR(bf16, any, f8_e4m3, any, fmt_order::any, spec::reference)
 
+            CPU_REORDER_INSTANCE(simple_sparse_reorder_t<bf16, impl::format_tag_t, any, bf16, impl::format_tag_t, any>)
+
             nullptr,
         }},
     });
@@ -42,6 +42,8 @@ const impl_list_map_t &regular_f16_impl_list_map() {
             REG_SR(f16, any, s8, any, fmt_order::any, spec::reference)
             REG_SR(f16, any, u8, any, fmt_order::any, spec::reference)
 
+            CPU_REORDER_INSTANCE(simple_sparse_reorder_t<f16, impl::format_tag_t, any, f16, impl::format_tag_t, any>)
+
             nullptr,
         }},
     });
@@ -42,6 +42,8 @@ const impl_list_map_t &regular_f32_f32_impl_list_map() {
 
             REG_SR(f32, any, f32, any, fmt_order::any, spec::reference)
 
+            CPU_REORDER_INSTANCE(simple_sparse_reorder_t<f32, impl::format_tag_t, any, f32, impl::format_tag_t, any>)
+
             nullptr,
         }},
         {{f32, f32, 3}, {
@@ -80,6 +82,8 @@ const impl_list_map_t &regular_f32_f32_impl_list_map() {
         {{f32, f32, 4}, {
             CPU_REORDER_INSTANCE(rnn_weights_reorder_t<f32, f32>)
 
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::wino_reorder_t))
+
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_direct_copy_t))
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_blk_reorder_t))
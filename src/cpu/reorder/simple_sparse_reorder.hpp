@@ -86,15 +86,50 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
                 input_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
         VDISPATCH_REORDER_IC(
                 output_d.is_sparse_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
-        VDISPATCH_REORDER_IC(
-                output_d.sparse_desc().encoding == sparse_encoding::packed,
+
+        if (output_d.encoding() == sparse_encoding::bsr) {
+            VDISPATCH_REORDER_IC(type_i == type_o, VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_REORDER_IC(output_d.ndims() == 2, VERBOSE_BAD_NDIMS,
+                    "dst", output_d.ndims());
+            VDISPATCH_REORDER_IC(
+                    utils::everyone_is(data_type::s32,
+                            output_d.metadata_type(0),
+                            output_d.metadata_type(1)),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(attr->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            return status::success;
+        }
+
+        // The packed and structured encodings are only consumed by int8
+        // matmul.
+        VDISPATCH_REORDER_IC(type_o == data_type::s8, VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_REORDER_IC(utils::one_of(output_d.encoding(),
+                                     sparse_encoding::packed,
+                                     sparse_encoding::structured),
                 VERBOSE_UNSUPPORTED_FEATURE,
-                "only sparse_encoding::packed is supported for dst");
+                "only sparse_encoding::packed, sparse_encoding::structured "
+                "and sparse_encoding::bsr are supported for dst");
         VDISPATCH_REORDER_IC(output_d.blocking_desc().inner_nblks > 0,
                 VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
         VDISPATCH_REORDER_IC(output_d.blk_size() % 64 == 0,
                 VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
 
+        if (output_d.is_sparse_structured_desc()) {
+            // Each group must reside within a single block so that every
+            // block keeps the same number of elements.
+            const auto &bd = output_d.blocking_desc();
+            const int k_idx = output_d.ndims() - 2;
+            dim_t k_blk = 1;
+            for (int iblk = 0; iblk < bd.inner_nblks; iblk++)
+                if (bd.inner_idxs[iblk] == k_idx) k_blk *= bd.inner_blks[iblk];
+            const dim_t m = output_d.sparse_desc().structured_m;
+            VDISPATCH_REORDER_IC(m <= max_structured_m,
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(k_blk % m == 0,
+                    VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+        }
+
         return status::success;
     }
 
@@ -102,6 +137,7 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
             const memory_desc_wrapper &output_d) {
         const auto nelems = output_d.nelems(true);
         const auto tmp_output_sz = nelems * output_d.data_type_size();
+        if (output_d.encoding() == sparse_encoding::bsr) return tmp_output_sz;
         const auto nnz_per_blocks_sz
                 = nelems / output_d.blk_size() * sizeof(dim_t);
         return tmp_output_sz + nnz_per_blocks_sz;
@@ -109,9 +145,7 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
 
     static status_t execute(const cpu_reorder_pd_t *pd, const exec_ctx_t &ctx,
             const std::shared_ptr<primitive_t> &reorder) {
-        auto output_values = CTX_OUT_MEM(data_t<type_o> *, DNNL_ARG_TO, 0);
-        auto output_offsets = CTX_OUT_MEM(int64_t *, DNNL_ARG_TO, 1);
-        auto output_bitmask = CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 2);
+        const auto output_d = ctx.memory_mdw(DNNL_ARG_TO, pd->dst_md());
 
         engine_t *engine = ctx.stream()->engine();
         const auto scratchpad = ctx.get_scratchpad_grantor();
@@ -136,7 +170,27 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
         auto *wspace = scratchpad.template get<data_t<type_o>>(
                 memory_tracking::names::key_reorder_space);
 
-        const auto output_d = ctx.memory_mdw(DNNL_ARG_TO, pd->dst_md());
+        auto output_values = CTX_OUT_MEM(data_t<type_o> *, DNNL_ARG_TO, 0);
+        if (output_d.encoding() == sparse_encoding::bsr) {
+            auto output_indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 1);
+            auto output_pointers = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 2);
+            return execute_bsr(output_d, wspace, output_values,
+                    output_indices, output_pointers);
+        }
+
+        // The structured encoding doesn't have offsets.
+        const bool is_structured = output_d.is_sparse_structured_desc();
+        auto output_offsets = is_structured
+                ? nullptr
+                : CTX_OUT_MEM(int64_t *, DNNL_ARG_TO, 1);
+        auto output_bitmask = is_structured
+                ? CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 1)
+                : CTX_OUT_MEM(uint64_t *, DNNL_ARG_TO, 2);
+
+        if (is_structured)
+            return execute_structured(
+                    output_d, wspace, output_values, output_bitmask);
+
         const auto nelems = output_d.nelems(true);
         const auto blk_sz = output_d.blk_size();
         const auto nblks = nelems / blk_sz;
@@ -188,6 +242,172 @@ struct simple_sparse_reorder_impl_t<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
             }
         });
 
+        return status::success;
+    }
+
+private:
+    static constexpr dim_t max_structured_m = 64;
+
+    // The `wspace` holds the tensor reordered to the plain `ab` layout.
+    static status_t execute_bsr(const memory_desc_wrapper &output_d,
+            const data_t<type_o> *wspace, data_t<type_o> *output_values,
+            int32_t *output_indices, int32_t *output_pointers) {
+        const dim_t rows = output_d.dims()[0];
+        const dim_t cols = output_d.dims()[1];
+        const dim_t bh = output_d.sparse_desc().bsr_block_dims[0];
+        const dim_t bw = output_d.sparse_desc().bsr_block_dims[1];
+        const dim_t nbr = rows / bh;
+        const dim_t nbc = cols / bw;
+        const dim_t blk_sz = bh * bw;
+        const dim_t max_nnz_blocks = output_d.bsr_nnz_blocks();
+
+        auto is_zero_block = [&](dim_t br, dim_t bc) {
+            const data_t<type_o> *blk = wspace + br * bh * cols + bc * bw;
+            for (dim_t i = 0; i < bh; i++)
+                for (dim_t j = 0; j < bw; j++)
+                    if (static_cast<float>(blk[i * cols + j]) != 0.f)
+                        return false;
+            return true;
+        };
+
+        // Count the non-zero blocks of each block row and turn the counts
+        // into the block row pointers.
+        output_pointers[0] = 0;
+        parallel_nd(nbr, [&](dim_t br) {
+            int32_t nnz_blocks = 0;
+            for (dim_t bc = 0; bc < nbc; bc++)
+                nnz_blocks += !is_zero_block(br, bc);
+            output_pointers[br + 1] = nnz_blocks;
+        });
+        for (dim_t br = 0; br < nbr; br++)
+            output_pointers[br + 1] += output_pointers[br];
+
+        // The tensor doesn't fit into the memory described by the user.
+        const dim_t nnz_blocks = output_pointers[nbr];
+        if (nnz_blocks > max_nnz_blocks) return status::invalid_arguments;
+
+        parallel_nd(nbr, [&](dim_t br) {
+            dim_t blk = output_pointers[br];
+            for (dim_t bc = 0; bc < nbc; bc++) {
+                if (is_zero_block(br, bc)) continue;
+                output_indices[blk] = static_cast<int32_t>(bc);
+                const data_t<type_o> *src = wspace + br * bh * cols + bc * bw;
+                data_t<type_o> *dst = output_values + blk * blk_sz;
+                for (dim_t i = 0; i < bh; i++)
+                    for (dim_t j = 0; j < bw; j++)
+                        dst[i * bw + j] = src[i * cols + j];
+                blk++;
+            }
+        });
+
+        // The storage past the last non-zero block is not referenced by the
+        // pointers; zero it so that the output is fully defined.
+        parallel_nd(max_nnz_blocks - nnz_blocks, [&](dim_t b) {
+            const dim_t blk = nnz_blocks + b;
+            output_indices[blk] = 0;
+            for (dim_t i = 0; i < blk_sz; i++)
+                output_values[blk * blk_sz + i] = data_t<type_o>(0);
+        });
+
+        return status::success;
+    }
+
+    // The `wspace` holds the tensor reordered to the blocked layout of the
+    // structured encoding.
+    static status_t execute_structured(const memory_desc_wrapper &output_d,
+            data_t<type_o> *wspace, data_t<type_o> *output_values,
+            uint64_t *output_bitmask) {
+        const int ndims = output_d.ndims();
+        const int k_idx = ndims - 2;
+        const dim_t n = output_d.sparse_desc().structured_n;
+        const dim_t m = output_d.sparse_desc().structured_m;
+        const dim_t K = output_d.dims()[k_idx];
+        const dim_t nk_groups = utils::div_up(K, m);
+
+        dims_t outer_dims;
+        utils::array_copy(outer_dims, output_d.dims(), ndims);
+        outer_dims[k_idx] = 1;
+        const dim_t nouter = utils::array_product(outer_dims, ndims);
+
+        // Enforce the N:M pattern by keeping the `n` elements with the
+        // largest magnitude in each group of `m` elements along K. Ties are
+        // resolved in favor of the element with the smaller index.
+        parallel_nd(nouter, nk_groups, [&](dim_t o, dim_t g) {
+            dims_t pos;
+            utils::l_dims_by_l_offset(pos, o, outer_dims, ndims);
+
+            const dim_t k_start = g * m;
+            const dim_t group_sz = nstl::min(m, K - k_start);
+            if (group_sz <= n) return;
+
+            dim_t offs[max_structured_m];
+            bool keep[max_structured_m] = {false};
+            assert(group_sz <= max_structured_m);
+            for (dim_t i = 0; i < group_sz; i++) {
+                pos[k_idx] = k_start + i;
+                offs[i] = output_d.off_v(pos);
+            }
+            for (dim_t j = 0; j < n; j++) {
+                dim_t max_i = -1;
+                float max_v = 0.f;
+                for (dim_t i = 0; i < group_sz; i++) {
+                    const float v = nstl::abs(
+                            static_cast<float>(wspace[offs[i]]));
+                    if (!keep[i] && v > max_v) {
+                        max_v = v;
+                        max_i = i;
+                    }
+                }
+                if (max_i < 0) break;
+                keep[max_i] = true;
+            }
+            for (dim_t i = 0; i < group_sz; i++)
+                if (!keep[i]) wspace[offs[i]] = data_t<type_o>(0);
+        });
+
+        const auto nelems = output_d.nelems(true);
+        const auto blk_sz = output_d.blk_size();
+        const auto nblks = nelems / blk_sz;
+        const dim_t blk_nnz = blk_sz / m * n;
+
+        static constexpr int bitmask_step = sizeof(uint64_t) * CHAR_BIT;
+        // After pruning each block has at most `blk_nnz` non-zero elements.
+        // Keep all of them and then keep the first zeroes of the block until
+        // the block has exactly `blk_nnz` elements, which makes the offset of
+        // each block in the values implied.
+        parallel_nd(nblks, [&](dim_t b) {
+            const data_t<type_o> *blk = wspace + b * blk_sz;
+            uint64_t *blk_bitmask = output_bitmask + b * blk_sz / bitmask_step;
+
+            dim_t nnz_per_blk = 0;
+            for (dim_t i = 0; i < blk_sz / bitmask_step; i++) {
+                uint64_t &bm = blk_bitmask[i];
+                bm = 0;
+                for (dim_t j = 0; j < bitmask_step; j++) {
+                    if (blk[bitmask_step * i + j] != 0) {
+                        bm |= (uint64_t(1) << j);
+                        nnz_per_blk++;
+                    }
+                }
+            }
+            for (dim_t i = 0; i < blk_sz && nnz_per_blk < blk_nnz; i++) {
+                uint64_t &bm = blk_bitmask[i / bitmask_step];
+                const uint64_t bit = uint64_t(1) << (i % bitmask_step);
+                if (bm & bit) continue;
+                bm |= bit;
+                nnz_per_blk++;
+            }
+
+            data_t<type_o> *blk_values = output_values + b * blk_nnz;
+            dim_t off = 0;
+            for (dim_t i = 0; i < blk_sz; i++) {
+                const uint64_t bm = blk_bitmask[i / bitmask_step];
+                if (bm & (uint64_t(1) << (i % bitmask_step)))
+                    blk_values[off++] = blk[i];
+            }
+            assert(off == blk_nnz);
+        });
+
         return status::success;
     }
 };
@@ -225,8 +445,17 @@ struct simple_sparse_reorder_t : public primitive_t {
 
         status_t init(
                 engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
-            // Convert sparse packed desc to blocking desc.
-            auto converted_dst_md = cvt_sparse_packed2blocked(*this->dst_md());
+            // Convert sparse packed or structured desc to blocking desc. The
+            // BSR encoding is built from the plain layout.
+            memory_desc_t converted_dst_md;
+            if (memory_desc_wrapper(dst_md()).encoding()
+                    == sparse_encoding::bsr) {
+                CHECK(memory_desc_init_by_tag(converted_dst_md,
+                        dst_md()->ndims, dst_md()->dims,
+                        dst_md()->data_type, format_tag::ab));
+            } else {
+                converted_dst_md = cvt_sparse_packed2blocked(*this->dst_md());
+            }
             CHECK(reorder_primitive_desc_create(
                     reorder_pd_, engine, src_md(), &converted_dst_md, attr()));
 
@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/simple_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t simple_rope_fwd_t::pd_t::init(engine_t *engine) {
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+
+    VDISPATCH_ROPE(one_of(src_dt, f32, bf16, f16)
+                    && one_of(dst_dt, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_ROPE(platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ROPE(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_ROPE(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper cos_d(cos_md());
+    const memory_desc_wrapper sin_d(sin_md());
+    const memory_desc_wrapper pos_d(pos_md());
+    VDISPATCH_ROPE(!src_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides()
+                    && !cos_d.has_runtime_dims_or_strides()
+                    && !pos_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // Every head is a contiguous row, the heads themselves may be laid out
+    // arbitrarily, e.g. as a slice of a fused QKV tensor.
+    const auto head_is_row = [](const memory_desc_wrapper &mdw) {
+        return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0
+                && mdw.blocking_desc().strides[3] == 1;
+    };
+    VDISPATCH_ROPE(head_is_row(src_d) && head_is_row(dst_d),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(cos_d.matches_one_of_tag(format_tag::ab)
+                    && sin_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(IMPLICATION(with_positions(),
+                           pos_d.is_blocking_desc()
+                                   && pos_d.blocking_desc().inner_nblks == 0),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_scratchpad();
+    return status::success;
+}
+
+void simple_rope_fwd_t::pd_t::init_scratchpad() {
+    // An f32 destination serves as the row buffer itself.
+    if (dst_md()->data_type == f32) return;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_rope_row, static_cast<size_t>(dnnl_get_max_threads()) * D());
+}
+
+status_t simple_rope_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto cos = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_COS);
+    const auto sin = CTX_IN_MEM(const float *, DNNL_ARG_ROPE_SIN);
+    const auto pos = CTX_IN_MEM(const int32_t *, DNNL_ARG_ROPE_POSITIONS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper pos_d(pd()->pos_md());
+    const memory_desc_wrapper cos_d(pd()->cos_md());
+
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+    const size_t src_dt_sz = src_d.data_type_size();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+
+    const dim_t MB = pd()->MB();
+    const dim_t H = pd()->H();
+    const dim_t S = pd()->S();
+    const dim_t D = pd()->D();
+    const dim_t R = pd()->rotary_dims();
+    const dim_t max_positions = pd()->max_positions();
+    const rope_layout_t layout = pd()->layout();
+    const bool with_positions = pd()->with_positions();
+
+    float *rows = dst_dt == f32
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<float>(key_rope_row);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(MB * H * S, nthr, ithr, start, end);
+
+        dim_t mb {0}, h {0}, s {0};
+        nd_iterator_init(start, mb, MB, h, H, s, S);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t p = with_positions ? pos[pos_d.off(mb, s)] : s;
+            assert(p >= 0 && p < max_positions);
+            MAYBE_UNUSED(max_positions);
+
+            const char *src_row = src + src_d.blk_off(mb, h, s) * src_dt_sz;
+            char *dst_row = dst + dst_d.blk_off(mb, h, s) * dst_dt_sz;
+            float *x = rows ? rows + ithr * D
+                            : reinterpret_cast<float *>(dst_row);
+
+            rope_utils::load_row(x, src_row, src_dt, D);
+            rope_utils::rotate(x, cos + cos_d.off(p, 0), sin + cos_d.off(p, 0),
+                    R, layout);
+            rope_utils::store_row(dst_row, x, dst_dt, D);
+
+            nd_iterator_step(mb, MB, h, H, s, S);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
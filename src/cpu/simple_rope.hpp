@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_ROPE_HPP
+#define CPU_SIMPLE_ROPE_HPP
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/primitive.hpp"
+#include "common/rope_pd.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace rope_utils {
+
+// Converts `n` elements of type `dt` at `src` to f32.
+inline void load_row(float *dst, const void *src, data_type_t dt, dim_t n) {
+    switch (dt) {
+        case data_type::f32:
+            if (dst != src)
+                utils::array_copy(dst, static_cast<const float *>(src), n);
+            break;
+        case data_type::bf16:
+            cvt_bfloat16_to_float(
+                    dst, static_cast<const bfloat16_t *>(src), n);
+            break;
+        case data_type::f16:
+            cvt_float16_to_float(dst, static_cast<const float16_t *>(src), n);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Converts `n` f32 elements at `src` to type `dt`.
+inline void store_row(void *dst, const float *src, data_type_t dt, dim_t n) {
+    switch (dt) {
+        case data_type::f32:
+            if (dst != src)
+                utils::array_copy(static_cast<float *>(dst), src, n);
+            break;
+        case data_type::bf16:
+            cvt_float_to_bfloat16(static_cast<bfloat16_t *>(dst), src, n);
+            break;
+        case data_type::f16:
+            cvt_float_to_float16(static_cast<float16_t *>(dst), src, n);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Rotates the first `rotary_dims` elements of the head `x` in place. Pair i
+// is rotated by the angle with the cosine `cos[i]` and the sine `sin[i]`.
+inline void rotate(float *x, const float *cos, const float *sin,
+        dim_t rotary_dims, rope_layout_t layout) {
+    const dim_t half = rotary_dims / 2;
+    if (layout == rope_layout::interleaved) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = x[2 * i];
+            const float x1 = x[2 * i + 1];
+            x[2 * i] = x0 * cos[i] - x1 * sin[i];
+            x[2 * i + 1] = x1 * cos[i] + x0 * sin[i];
+        }
+    } else {
+        float *x_hi = x + half;
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = x[i];
+            const float x1 = x_hi[i];
+            x[i] = x0 * cos[i] - x1 * sin[i];
+            x_hi[i] = x1 * cos[i] + x0 * sin[i];
+        }
+    }
+}
+
+} // namespace rope_utils
+
+// Applies the rotary position embedding head by head. Every head goes through
+// an f32 row buffer, which is the destination itself for f32 data, and is
+// rotated with vectorized loops over the pairs of elements.
+struct simple_rope_fwd_t : public primitive_t {
+    struct pd_t : public rope_pd_t {
+        using rope_pd_t::rope_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_rope_fwd_t);
+
+        status_t init(engine_t *engine);
+
+    private:
+        void init_scratchpad();
+    };
+
+    simple_rope_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -421,8 +421,7 @@ status_t gemm_bf16_convolution_fwd_t<dst_data_type>::execute_forward_thr_nspc(
 
     const bool is_problem_3d = pd()->ndims() == 5;
     assert(IMPLICATION(is_problem_3d,
-            jcp.oh_block == jcp.oh && jcp.ow_block == jcp.ow
-                    && jcp.ic_block == jcp.ic));
+            jcp.ow_block == jcp.ow && jcp.ic_block == jcp.ic));
 
     const dim_t nb_oh = div_up(jcp.oh, jcp.oh_block);
     const dim_t nb_ow = div_up(jcp.ow, jcp.ow_block);
@@ -430,18 +429,6 @@ status_t gemm_bf16_convolution_fwd_t<dst_data_type>::execute_forward_thr_nspc(
     balance211(work_amount, nthr, ithr, start, end);
     nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ohb, nb_oh, owb, nb_ow);
 
-    if (jcp.im2col_sz && is_problem_3d) {
-        // jit_gemm_convolution_utils::im2col_dt_3d() requires external
-        // data initialization by zeroes
-        // For performance reasons use uint16_t as a proxy for bfloat16_t
-        uint16_t *__restrict col_r
-                = reinterpret_cast<uint16_t *__restrict>(col);
-        constexpr uint16_t zero_val = 0;
-
-        PRAGMA_OMP_SIMD()
-        for (ptrdiff_t i = 0; i < jcp.im2col_sz; i++)
-            col_r[i] = zero_val;
-    }
     for (dim_t iwork = start; iwork < end; ++iwork) {
         int oh = ohb * jcp.oh_block;
         int ow = owb * jcp.ow_block;
@@ -451,7 +438,9 @@ status_t gemm_bf16_convolution_fwd_t<dst_data_type>::execute_forward_thr_nspc(
 
         const int h_step = nstl::min(jcp.oh_block, jcp.oh - oh);
         const int w_step = nstl::min(jcp.ow_block, jcp.ow - ow);
-        if (jcp.im2col_sz && is_problem_3d)
+        // The transposed source is reused by all blocks of rows of an image.
+        if (jcp.im2col_sz && is_problem_3d
+                && (iwork == start || (ohb == 0 && owb == 0)))
             jit_gemm_convolution_utils::transpose_dt(jcp, src, imtr);
 
         for (int od = 0; od < jcp.od; od++) {
@@ -461,7 +450,7 @@ status_t gemm_bf16_convolution_fwd_t<dst_data_type>::execute_forward_thr_nspc(
             if (jcp.im2col_sz) {
                 if (is_problem_3d)
                     jit_gemm_convolution_utils::im2col_dt_3d<src_data_t,
-                            src_data_t>(jcp, imtr, col, od);
+                            src_data_t>(jcp, imtr, col, od, oh, h_step);
                 else
                     jit_gemm_convolution_utils::im2col_dt<src_data_t,
                             src_data_t>(
@@ -1057,7 +1046,7 @@ status_t gemm_bf16_convolution_bwd_weights_t<diff_wei_data_type>::
                             if (is_problem_3d)
                                 jit_gemm_convolution_utils::im2col_dt_3d<
                                         src_data_t, src_data_t>(
-                                        jcp, imtr, _col, od);
+                                        jcp, imtr, _col, od, 0, jcp.oh);
                             else
                                 jit_gemm_convolution_utils::im2col_dt<
                                         src_data_t, src_data_t>(jcp, _src, imtr,
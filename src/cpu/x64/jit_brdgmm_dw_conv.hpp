@@ -32,7 +32,9 @@ namespace x64 {
 
 struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     struct pd_t : public cpu_convolution_fwd_pd_t {
-        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+        pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brdgmm_dw:", jcp_.isa, ""),
                 brdgmm_dw_convolution_fwd_t);
@@ -54,6 +56,26 @@ struct brdgmm_dw_convolution_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override;
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    struct exec_args_t {
+        const char *src = nullptr;
+        const char *weights = nullptr;
+        const char *bias = nullptr;
+        char *dst = nullptr;
+        const void *const *post_ops_binary_rhs_arg_vec = nullptr;
+        const void *src_scales = nullptr;
+        const void *wei_scales = nullptr;
+        const float *dst_scales_inv = nullptr;
+        const int32_t *src_zero_points = nullptr;
+        const int32_t *dst_zero_points = nullptr;
+        int32_t *s8s8_compensation = nullptr;
+        int32_t *zp_compensation = nullptr;
+    };
+
+    // Computes work items [start, end) of the `mb x od x oh x nb_ow x chb`
+    // space. Besides `execute()`, it is used by the fused 1x1 + dw
+    // convolution to process one output row at a time from a row buffer.
+    void execute_work(const exec_args_t &args, int start, int end) const;
+
 private:
     std::vector<std::unique_ptr<brgemm_kernel_t>> brdgmm_kernels_;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
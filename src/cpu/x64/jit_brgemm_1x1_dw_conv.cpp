@@ -0,0 +1,290 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_1x1_dw_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_1x1_dw_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_CONV(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Plain 1x1 convolutions are left to the regular implementations.
+    const int dw_po_idx = attr()->post_ops_.find(primitive_kind::convolution);
+    VDISPATCH_CONV(dw_po_idx != -1, VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(post_ops_ok(dw_po_idx), VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4 && !with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D convolutions without groups are supported");
+    VDISPATCH_CONV(KH() == 1 && KW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only 1x1 kernels are supported");
+    VDISPATCH_CONV(everyone_is(1, KSH(), KSW()) && everyone_is(0, KDH(), KDW()),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "only unit strides and no dilations are supported");
+    VDISPATCH_CONV(everyone_is(0, padT(), padB(), padL(), padR()),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "");
+
+    // The brgemm B matrix is the `ic x oc` weights matrix.
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_wrapper(src_md()).matches_tag(nhwc)
+                    && memory_desc_wrapper(weights_md(0)).matches_tag(hwio)
+                    && memory_desc_wrapper(dst_1x1_md()).matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_dw_conv(engine, dw_po_idx));
+
+    oc_blk_ = nstl::min(dim_t(64), rnd_up(OC(), 16));
+    CHECK(init_brgemm_descs(dw_po_idx));
+
+    // The buffer is expected to stay in L2 together with the rows of the
+    // 1x1 source. It keeps at least the depthwise kernel height of rows, and
+    // a few more to shift it less frequently.
+    const auto &jcp_dw = dw_pd()->jcp_;
+    const dim_t row_size = sizeof(float) * IW() * OC();
+    const dim_t L2 = platform::get_per_core_cache_size(2);
+    buf_rows_ = saturate<dim_t>(jcp_dw.kh, jcp_dw.kh + 4 * jcp_dw.stride_h,
+            L2 / 2 / row_size);
+
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_1x1_dw_convolution_fwd_t::pd_t::post_ops_ok(int dw_po_idx) const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++) {
+        if (i == dw_po_idx) continue;
+        if (!po.entry_[i].is_eltwise(/* require_scale_one = */ true))
+            return false;
+    }
+
+    const auto &dw = po.entry_[dw_po_idx].depthwise_conv;
+    return dw.wei_dt == f32 && dw.dst_dt == f32
+            && one_of(dw.bias_dt, data_type::undef, f32);
+}
+
+status_t brgemm_1x1_dw_convolution_fwd_t::pd_t::init_dw_conv(
+        engine_t *engine, int dw_po_idx) {
+    convolution_desc_t cd_dw;
+    primitive_attr_t attr_dw;
+    CHECK(get_depthwise_conv_desc(
+            cd_dw, dst_md_, *attr(), attr_dw, dw_po_idx));
+
+    // The depthwise part has to be done by brdgmm as its work can be split by
+    // rows, see `brdgmm_dw_convolution_fwd_t::execute_work()`.
+    std::unique_ptr<dw_pd_t> dw_pd;
+    CHECK(safe_ptr_assign(dw_pd, new dw_pd_t(&cd_dw, &attr_dw, nullptr)));
+    CHECK(dw_pd->init(engine));
+
+    VDISPATCH_CONV_IC(dnnl_memory_desc_equal(&dst_md_, dw_pd->src_md(0)),
+            VERBOSE_INCONSISTENT_MDS, "dst_md", "dw_conv_pd_->src_md");
+    VDISPATCH_CONV_IC(dw_pd->scratchpad_registry().size() == 0,
+            VERBOSE_1x1CONV_HEURISTIC_FAIL, "depthwise part needs scratchpad");
+    dw_conv_pd_.reset(dw_pd.release());
+    return status::success;
+}
+
+status_t brgemm_1x1_dw_convolution_fwd_t::pd_t::init_brgemm_descs(
+        int dw_po_idx) {
+    // Post-ops up to the depthwise convolution are applied by brgemm to the
+    // 1x1 output, the rest are applied by the depthwise part.
+    primitive_attr_t attr_1x1(*attr());
+    if (!attr_1x1.is_initialized()) return status::out_of_memory;
+    attr_1x1.post_ops_.entry_.resize(dw_po_idx);
+    need_postwork_ = with_bias() || dw_po_idx > 0;
+
+    const dim_t IC = this->IC();
+    const dim_t OC = this->OC();
+    const dim_t M = IW();
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t N = idx == 1 ? OC % oc_blk_ : oc_blk_;
+
+        brgemm_desc_t &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, IC, OC, OC, M, N, IC));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        brg_attr.hint_expected_A_size = M * IC;
+        brg_attr.hint_expected_B_size = IC * N;
+        brg_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_set_postops(&brg, &attr_1x1, dst_1x1_md(), OC,
+                with_bias() ? f32 : data_type::undef));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_1x1_dw_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_fusion_inout_buffer,
+            static_cast<size_t>(dnnl_get_max_threads()) * buf_rows_ * IW()
+                    * OC());
+}
+
+status_t brgemm_1x1_dw_convolution_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(kernels_[idx], ker));
+    }
+    CHECK(pd()->dw_conv_pd_->create_primitive(dw_conv_p_, engine));
+    return status::success;
+}
+
+void brgemm_1x1_dw_convolution_fwd_t::compute_1x1_row(const float *src,
+        const float *wei, const float *bias, float *row, dim_t n,
+        dim_t ih) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t OC = pd()->OC();
+    const dim_t oc_blk = pd()->oc_blk();
+
+    brgemm_batch_element_t batch;
+    batch.ptr.A = src + src_d.blk_off(n, 0, ih);
+    batch.vvpad.top = 0;
+    batch.vvpad.bottom = 0;
+
+    for (dim_t ocb = 0; ocb < pd()->oc_nblks(); ocb++) {
+        const dim_t oc = ocb * oc_blk;
+        const auto *ker = kernels_[OC - oc < oc_blk ? 1 : 0].get();
+        batch.ptr.B = wei + oc;
+        float *C = row + oc;
+        if (pd()->need_postwork()) {
+            brgemm_post_ops_data_t post_ops_data;
+            post_ops_data.bias = bias ? bias + oc : nullptr;
+            post_ops_data.oc_logical_off = oc;
+            post_ops_data.data_C_ptr_ = reinterpret_cast<char *>(row);
+            brgemm_kernel_execute_postops(
+                    ker, 1, &batch, C, C, post_ops_data, nullptr);
+        } else {
+            brgemm_kernel_execute(ker, 1, &batch, C);
+        }
+    }
+}
+
+status_t brgemm_1x1_dw_convolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    const auto *dw_wei = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    const auto *dw_bias = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto *dw_conv = static_cast<const brdgmm_dw_convolution_fwd_t *>(
+            dw_conv_p_.get());
+    const auto &jcp_dw = pd()->dw_pd()->jcp_;
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t MB = pd()->MB();
+    const dim_t IH = pd()->IH();
+    const dim_t buf_rows = pd()->buf_rows();
+    const dim_t row_size = pd()->IW() * pd()->OC();
+    const dim_t chb_work = div_up(jcp_dw.ngroups, jcp_dw.nb_ch_blocking);
+    const dim_t dw_row_work = jcp_dw.nb_ow * chb_work;
+
+    float *buf_base = ctx.get_scratchpad_grantor().template get<float>(
+            key_fusion_inout_buffer);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * jcp_dw.oh, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        // The buffer keeps rows [buf_ih, next_ih) of the 1x1 output.
+        float *buf = buf_base + ithr * buf_rows * row_size;
+        dim_t last_n = -1, buf_ih = 0, next_ih = 0;
+
+        brdgmm_dw_convolution_fwd_t::exec_args_t args;
+        args.weights = dw_wei;
+        args.bias = dw_bias;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t n = iwork / jcp_dw.oh;
+            const dim_t oh = iwork % jcp_dw.oh;
+            const dim_t ih_s = oh * jcp_dw.stride_h - jcp_dw.t_pad;
+            const dim_t ih_lo = nstl::max(dim_t(0), ih_s);
+            const dim_t ih_hi = nstl::min(IH, ih_s + jcp_dw.kh);
+
+            if (n != last_n) {
+                buf_ih = next_ih = ih_lo;
+                last_n = n;
+            } else if (ih_hi - buf_ih > buf_rows) {
+                const dim_t nrows_keep = nstl::max(dim_t(0), next_ih - ih_lo);
+                if (nrows_keep > 0)
+                    std::memmove(buf, buf + (ih_lo - buf_ih) * row_size,
+                            sizeof(float) * nrows_keep * row_size);
+                buf_ih = ih_lo;
+            }
+            next_ih = nstl::max(next_ih, ih_lo);
+            for (; next_ih < ih_hi; next_ih++)
+                compute_1x1_row(src, wei, bias,
+                        buf + (next_ih - buf_ih) * row_size, n, next_ih);
+
+            // The depthwise part addresses the source as a full image, so the
+            // buffer is passed as if it were the image rows starting from
+            // `buf_ih`. Padded rows are never accessed.
+            args.src = reinterpret_cast<const char *>(buf)
+                    - static_cast<ptrdiff_t>(sizeof(float) * buf_ih * row_size);
+            args.dst = dst + sizeof(float) * dst_d.blk_off(n);
+            dw_conv->execute_work(args, static_cast<int>(oh * dw_row_work),
+                    static_cast<int>((oh + 1) * dw_row_work));
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_1X1_DW_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_1X1_DW_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brdgmm_dw_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// 1x1 convolution with a fused depthwise convolution post-op. Every thread
+// owns a range of depthwise output rows and keeps a small buffer of rows of
+// the 1x1 convolution output. A 1x1 output row is computed by brgemm right
+// before the first depthwise output row that needs it, and the rows that are
+// no longer needed are dropped by shifting the buffer. The depthwise part is
+// computed by `brdgmm_dw_convolution_fwd_t` reading the source from the row
+// buffer, so the 1x1 output never leaves the cache.
+struct brgemm_1x1_dw_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_1x1_dw:", isa_, ""),
+                brgemm_1x1_dw_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        const memory_desc_t *dst_1x1_md(int index = 0) const {
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return dw_conv_pd_ ? dw_conv_pd_->dst_md(index, user_input)
+                               : cpu_convolution_fwd_pd_t::dst_md(
+                                       index, user_input);
+        }
+
+        const memory_desc_t *arg_md(
+                int arg, bool user_input = false) const override {
+            if (dw_conv_pd_) {
+                switch (arg) {
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_SRC:
+                        return cpu_convolution_fwd_pd_t::dst_md(0, user_input);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
+                        return dw_conv_pd_->weights_md(0);
+                    case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
+                        return dw_conv_pd_->weights_md(1);
+                    default: break;
+                }
+            }
+            return convolution_fwd_pd_t::arg_md(arg, user_input);
+        }
+        // NOLINTEND(google-default-arguments)
+
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                return arg_usage_t::input;
+
+            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                return attr_post_op_dw_inputs() > 1 ? arg_usage_t::input
+                                                    : arg_usage_t::unused;
+
+            return convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        // Kernel index: 0 - full OC block, 1 - OC block tail.
+        static constexpr int max_num_kernels = 2;
+        bool has_kernel(int idx) const {
+            return IMPLICATION(idx == 1, OC() % oc_blk_ > 0)
+                    && IMPLICATION(idx == 0, OC() >= oc_blk_);
+        }
+        const brgemm_desc_t &brg_desc(int idx) const { return brgs_[idx]; }
+
+        dim_t oc_blk() const { return oc_blk_; }
+        dim_t oc_nblks() const { return utils::div_up(OC(), oc_blk_); }
+        // Capacity of the per-thread buffer in rows of the 1x1 output.
+        dim_t buf_rows() const { return buf_rows_; }
+        bool need_postwork() const { return need_postwork_; }
+
+        using dw_pd_t = brdgmm_dw_convolution_fwd_t::pd_t;
+        const dw_pd_t *dw_pd() const {
+            return static_cast<const dw_pd_t *>(dw_conv_pd_.get());
+        }
+
+        std::shared_ptr<primitive_desc_t> dw_conv_pd_;
+
+    private:
+        bool post_ops_ok(int dw_po_idx) const;
+        status_t init_dw_conv(engine_t *engine, int dw_po_idx);
+        status_t init_brgemm_descs(int dw_po_idx);
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t oc_blk_ = 0;
+        dim_t buf_rows_ = 0;
+        bool need_postwork_ = false;
+        brgemm_desc_t brgs_[max_num_kernels];
+    };
+
+    brgemm_1x1_dw_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void compute_1x1_row(const float *src, const float *wei, const float *bias,
+            float *row, dim_t n, dim_t ih) const;
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_num_kernels];
+    std::shared_ptr<primitive_t> dw_conv_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
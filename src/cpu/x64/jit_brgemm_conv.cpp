@@ -362,7 +362,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
 
     using skip_mask_t = primitive_attr_t::skip_mask_t;
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
-            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
+            | skip_mask_t::zero_points | skip_mask_t::fpmath_mode
+            | skip_mask_t::batch_stats;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
@@ -678,6 +679,20 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     auto scratchpad = scratchpad_registry().registrar();
     brgemm_convolution_utils::init_scratchpad(scratchpad, jcp_);
 
+    // The batch statistics are accumulated per thread from the blocks of the
+    // destination right after they are stored: the count, the mean and the
+    // sum of squared deviations for every channel.
+    if (with_batch_stats()) {
+        using namespace format_tag;
+        VDISPATCH_CONV(dst_type == f32
+                        && memory_desc_wrapper(dst_md_).matches_one_of_tag(
+                                nwc, nhwc, ndhwc)
+                        && jcp_.oc_block <= max_stats_oc_block,
+                VERBOSE_UNSUPPORTED_ATTR);
+        scratchpad.template book<double>(key_conv_batch_stats,
+                static_cast<size_t>(jcp_.nthr) * 3 * OC());
+    }
+
     return status::success;
 }
 
@@ -1370,18 +1385,26 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto inp_p_buffer_mask = (jcp.exec_type == exec_trans)
             ? scratchpad.template get<uint8_t>(key_conv_brgemm_inp_buffer_mask)
             : nullptr;
+    // The cache is held until the end of the execution so that a concurrent
+    // execution with other weights does not free it.
+    const auto comp_cache
+            = jcp.comp_pad_cached ? get_comp_cache(wei) : nullptr;
     int32_t *src_zp_comp_base = jcp.src_zero_point
-            ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
-                       key_brgemm_primitive_zp_comp_a)
-                                    : zp_compensation)
+            ? (comp_cache ? comp_cache->src_zp_comp.data()
+                            : jcp.req_cal_comp_pad
+                            ? scratchpad.template get<int32_t>(
+                                    key_brgemm_primitive_zp_comp_a)
+                            : zp_compensation)
             : nullptr;
     int32_t *s8s8_comp_base = jcp.s8s8_compensation_required
-            ? (jcp.req_cal_comp_pad ? scratchpad.template get<int32_t>(
-                       key_brgemm_primitive_buffer_comp)
-                                    : s8s8_compensation)
+            ? (comp_cache ? comp_cache->s8s8_comp.data()
+                            : jcp.req_cal_comp_pad
+                            ? scratchpad.template get<int32_t>(
+                                    key_brgemm_primitive_buffer_comp)
+                            : s8s8_compensation)
             : nullptr;
 
-    cal_compensation(wei, src_zp_comp_base, s8s8_comp_base);
+    if (!comp_cache) cal_compensation(wei, src_zp_comp_base, s8s8_comp_base);
 
     char *const wsp_tile_global = is_amx
             ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
@@ -1389,6 +1412,15 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     maybe_conv_weights(ctx, wei, wei);
 
+    const bool with_batch_stats = _pd->with_batch_stats();
+    double *const stats_global = with_batch_stats
+            ? scratchpad.template get<double>(key_conv_batch_stats)
+            : nullptr;
+    if (with_batch_stats)
+        std::fill(stats_global,
+                stats_global + static_cast<size_t>(jcp.nthr) * 3 * _pd->OC(),
+                0.);
+
     // --------------- Parallel section ------------------------------
     const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
             * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
@@ -1445,6 +1477,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         balance211(work_amount, nthr, ithr, start, end);
 
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
+        int odt {0}, oht {0}, odbt {0}, ohbt {0};
         BRGEMM_CONV_ITERATOR_INIT;
         for (auto work = start; work < end; work++) {
             btc.g = g;
@@ -1478,27 +1511,41 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                     ? oh_begin + 1
                     : nstl::min(OH, oh_begin + jcp.oh_block);
             for_(int od = od_begin; od < od_end; od++)
-            for_(int oh = oh_begin; oh < oh_end; oh++)
-            for (int icc = 0; icc < _pd->ic_chunks; icc++) {
-                btc.od = od;
-                btc.oh = oh;
-                btc.icc = icc;
-
-                if (jcp.exec_type == exec_base) {
-                    ker_base(btc);
-                } else if (jcp.exec_type == exec_trans) {
-                    maybe_conv_inp(btc, last_btc, src);
-                    ker_trans(btc);
-                } else if (jcp.exec_type == exec_vpad) {
-                    ker_vpad(btc);
-                } else
-                    assert(!"Unknown exec type");
-                last_btc.n = n;
-                last_btc.g = g;
-                last_btc.icc = icc;
-                last_btc.odb = odb;
-                last_btc.ohb = ohb;
-                last_btc.owb = owb;
+            for (int oh = oh_begin; oh < oh_end; oh++) {
+                for (int icc = 0; icc < _pd->ic_chunks; icc++) {
+                    btc.od = od;
+                    btc.oh = oh;
+                    btc.icc = icc;
+
+                    if (jcp.exec_type == exec_base) {
+                        ker_base(btc);
+                    } else if (jcp.exec_type == exec_trans) {
+                        maybe_conv_inp(btc, last_btc, src);
+                        ker_trans(btc);
+                    } else if (jcp.exec_type == exec_vpad) {
+                        ker_vpad(btc);
+                    } else
+                        assert(!"Unknown exec type");
+                    last_btc.n = n;
+                    last_btc.g = g;
+                    last_btc.icc = icc;
+                    last_btc.odb = odb;
+                    last_btc.ohb = ohb;
+                    last_btc.owb = owb;
+                }
+                if (with_batch_stats) {
+                    // The block of the destination is complete and still in
+                    // cache.
+                    const int ow_s = owb * jcp.ow_block;
+                    accumulate_batch_stats(stats_global
+                                    + static_cast<size_t>(ithr) * 3
+                                            * _pd->OC(),
+                            brgemm_ctx.dst, n, g, ocb, od, oh,
+                            jcp.is_os_blocking
+                                    ? nstl::min(OH, oh + jcp.oh_block)
+                                    : oh + 1,
+                            ow_s, nstl::min(OW, ow_s + jcp.ow_block));
+                }
             }
             BRGEMM_CONV_ITERATOR_STEP;
         }
@@ -1507,9 +1554,120 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 
+    if (with_batch_stats)
+        reduce_batch_stats(stats_global, CTX_OUT_MEM(float *, DNNL_ARG_MEAN),
+                CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE));
+
     return status::success;
 }
 
+// Merges the statistics of two sets of points given by their counts, means
+// and sums of squared deviations from the mean, as in Chan et al. Unlike the
+// sums of values and of their squares this does not lose the variance to
+// cancellation when the mean is large.
+static inline void merge_batch_stats(double &count, double &mean, double &m2,
+        double count_b, double mean_b, double m2_b) {
+    if (count_b == 0) return;
+    const double count_ab = count + count_b;
+    const double delta = mean_b - mean;
+    mean += delta * count_b / count_ab;
+    m2 += m2_b + delta * delta * count * count_b / count_ab;
+    count = count_ab;
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_fwd_t<isa>::accumulate_batch_stats(double *stats,
+        const char *dst, int n, int g, int ocb, int od, int oh_s, int oh_e,
+        int ow_s, int ow_e) const {
+    const auto _pd = pd();
+    const auto &jcp = _pd->jcp_;
+    const auto ndims = _pd->ndims;
+    const memory_desc_wrapper dst_d(_pd->dst_md());
+
+    const int oc = ocb * jcp.oc_block;
+    const int nc = nstl::min(jcp.oc_block, jcp.oc_without_padding - oc);
+    if (nc <= 0 || oh_e <= oh_s || ow_e <= ow_s) return;
+    const dim_t c0 = static_cast<dim_t>(g) * jcp.oc_without_padding + oc;
+    const dim_t ow_stride = dst_d.blocking_desc().strides[ndims - 1];
+    const auto row = [&](int oh) {
+        const dim_t off = ndims == 5 ? dst_d.blk_off(n, c0, od, oh, ow_s)
+                : ndims == 4         ? dst_d.blk_off(n, c0, oh, ow_s)
+                                     : dst_d.blk_off(n, c0, ow_s);
+        return reinterpret_cast<const float *>(dst) + off;
+    };
+
+    // Statistics of the block: two passes over the points while they are in
+    // cache.
+    float mean[max_stats_oc_block], m2[max_stats_oc_block];
+    PRAGMA_OMP_SIMD()
+    for (int c = 0; c < nc; c++) {
+        mean[c] = 0.f;
+        m2[c] = 0.f;
+    }
+    for_(int oh = oh_s; oh < oh_e; oh++)
+    for (int ow = 0; ow < ow_e - ow_s; ow++) {
+        const float *d = row(oh) + ow * ow_stride;
+        PRAGMA_OMP_SIMD()
+        for (int c = 0; c < nc; c++)
+            mean[c] += d[c];
+    }
+    const int count = (oh_e - oh_s) * (ow_e - ow_s);
+    const float inv_count = 1.f / count;
+    PRAGMA_OMP_SIMD()
+    for (int c = 0; c < nc; c++)
+        mean[c] *= inv_count;
+    for_(int oh = oh_s; oh < oh_e; oh++)
+    for (int ow = 0; ow < ow_e - ow_s; ow++) {
+        const float *d = row(oh) + ow * ow_stride;
+        PRAGMA_OMP_SIMD()
+        for (int c = 0; c < nc; c++) {
+            const float diff = d[c] - mean[c];
+            m2[c] += diff * diff;
+        }
+    }
+
+    const dim_t C = _pd->OC();
+    for (int c = 0; c < nc; c++)
+        merge_batch_stats(stats[c0 + c], stats[C + c0 + c],
+                stats[2 * C + c0 + c], count, mean[c], m2[c]);
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_fwd_t<isa>::reduce_batch_stats(
+        const double *stats, float *mean, float *variance) const {
+    const dim_t C = pd()->OC();
+    const int nthr = pd()->jcp_.nthr;
+    parallel_nd(C, [&](dim_t c) {
+        double count = 0, m = 0, m2 = 0;
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            const double *s = stats + static_cast<size_t>(ithr) * 3 * C;
+            merge_batch_stats(count, m, m2, s[c], s[C + c], s[2 * C + c]);
+        }
+        mean[c] = static_cast<float>(m);
+        variance[c] = count > 0 ? static_cast<float>(m2 / count) : 0.f;
+    });
+}
+
+template <cpu_isa_t isa>
+std::shared_ptr<typename brgemm_convolution_fwd_t<isa>::comp_cache_t>
+brgemm_convolution_fwd_t<isa>::get_comp_cache(const char *weights) const {
+    std::lock_guard<std::mutex> guard(comp_cache_mutex_);
+    if (comp_cache_ && comp_cache_->weights == weights) return comp_cache_;
+
+    const auto &jcp = pd()->jcp_;
+    auto cache = std::make_shared<comp_cache_t>();
+    cache->weights = weights;
+    if (jcp.src_zero_point) cache->src_zp_comp.resize(jcp.comp_a_buffer_size);
+    if (jcp.s8s8_compensation_required)
+        cache->s8s8_comp.resize(jcp.s8s8_comp_buffer_size);
+    cal_compensation(weights,
+            jcp.src_zero_point ? cache->src_zp_comp.data() : nullptr,
+            jcp.s8s8_compensation_required ? cache->s8s8_comp.data()
+                                           : nullptr);
+    comp_cache_ = cache;
+    return cache;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_convolution_fwd_t<isa>::cal_compensation(
         const char *__restrict weights, int32_t *src_zp_buffer,
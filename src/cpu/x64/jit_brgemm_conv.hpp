@@ -18,7 +18,10 @@
 #define CPU_X64_JIT_BRGEMM_CONV_HPP
 
 #include <array>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -143,6 +146,9 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    // The largest OC block for which the batch statistics are computed.
+    static constexpr int max_stats_oc_block = 64;
+
 protected:
     status_t init(engine_t *engine) override;
 
@@ -209,8 +215,22 @@ private:
     void add_po_kernels(int i_N, int init_bcast_dim, int po_bcast_dim);
     status_t add_brg_kernel(int brg_idx);
 
+    void accumulate_batch_stats(double *stats, const char *dst, int n, int g,
+            int ocb, int od, int oh_s, int oh_e, int ow_s, int ow_e) const;
+    void reduce_batch_stats(
+            const double *stats, float *mean, float *variance) const;
+
     status_t cal_compensation(const char *__restrict weights,
             int32_t *src_zp_buffer, int32_t *s8s8_comp_buffer) const;
+
+    // Compensations with padding for constant weights, computed on the first
+    // execution with given weights and reused by the following ones.
+    struct comp_cache_t {
+        const char *weights = nullptr;
+        std::vector<int32_t> src_zp_comp;
+        std::vector<int32_t> s8s8_comp;
+    };
+    std::shared_ptr<comp_cache_t> get_comp_cache(const char *weights) const;
     int get_comp_oh(const int oh) const;
     int get_comp_ker_idx(const int kd_b, const int kd_e, const int kh_b,
             const int kh_e, const int kw_b, const int kw_e, const int oh) const;
@@ -234,6 +254,9 @@ private:
 
     std::unique_ptr<jit_generator_t> comp_vpad_pbuffer_;
 
+    mutable std::mutex comp_cache_mutex_;
+    mutable std::shared_ptr<comp_cache_t> comp_cache_;
+
     size_t acc_dsz, bia_dsz, src_dsz, wei_dsz, dst_dsz;
 
     const memory_desc_wrapper bias_d;
@@ -0,0 +1,345 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_conv_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_conv_pool_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_CONV(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4 && !with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D convolutions without groups are supported");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations are not supported");
+    // With padding smaller than the kernel every output point has at least
+    // one kernel point inside the source, so the batch is never empty.
+    VDISPATCH_CONV(everyone_is(true, 0 <= padT(), padT() < KH(), 0 <= padB(),
+                           padB() < KH(), 0 <= padL(), padL() < KW(),
+                           0 <= padR(), padR() < KW()),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "padding not smaller than kernel");
+
+    // The brgemm B matrix for a kernel point is the `ic x oc` weights matrix.
+    VDISPATCH_CONV(set_default_formats_common(nhwc, hwio, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_wrapper(src_md()).matches_tag(nhwc)
+                    && memory_desc_wrapper(weights_md(0)).matches_tag(hwio)
+                    && memory_desc_wrapper(dst_conv_md()).matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    oc_blk_ = nstl::min(dim_t(64), rnd_up(OC(), 16));
+
+    ow_mid_start_ = nstl::min(OW(), div_up(padL(), KSW()));
+    const dim_t last_iw_start = IW() - KW() + padL();
+    ow_mid_end_ = last_iw_start < 0
+            ? ow_mid_start_
+            : saturate(ow_mid_start_, OW(), last_iw_start / KSW() + 1);
+
+    need_postwork_ = with_bias() || attr()->post_ops_.len() > 1;
+
+    const auto &p = pool();
+    VDISPATCH_CONV(OH() + 2 * p.padding >= p.kernel
+                    && OW() + 2 * p.padding >= p.kernel,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    CHECK(init_pool_dst_md());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+    return status::success;
+}
+
+// Eltwise post-ops are applied to the convolution output, the pooling
+// post-op is the last one.
+bool brgemm_conv_pool_fwd_t::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    if (po.len() == 0 || !po.entry_.back().is_pooling()) return false;
+    for (int i = 0; i < po.len() - 1; i++)
+        if (!po.entry_[i].is_eltwise(/* require_scale_one = */ true))
+            return false;
+    return true;
+}
+
+// The destination of the primitive is the pooled convolution output. The
+// window is applied with the same padding on the left and on the right, the
+// points that do not fit a whole window on the right are dropped.
+status_t brgemm_conv_pool_fwd_t::pd_t::init_pool_dst_md() {
+    const auto &p = pool();
+    dims_t dims;
+    array_copy(dims, dst_conv_md()->dims, ndims());
+    dims[2] = (OH() + 2 * p.padding - p.kernel) / p.stride + 1;
+    dims[3] = (OW() + 2 * p.padding - p.kernel) / p.stride + 1;
+    CHECK(memory_desc_init_by_tag(
+            pool_dst_md_, ndims(), dims, f32, format_tag::nhwc));
+    with_pool_dst_ = true;
+    return status::success;
+}
+
+status_t brgemm_conv_pool_fwd_t::pd_t::init_brgemm_descs() {
+    // The kernels apply the post-ops that precede the pooling.
+    primitive_attr_t kernel_attr;
+    CHECK(kernel_attr.copy_from(*attr()));
+    kernel_attr.post_ops_.entry_.pop_back();
+
+    const dim_t IC = this->IC();
+    const dim_t OC = this->OC();
+    // Consecutive rows of the A matrix are the source points of consecutive
+    // output points, the C matrix is a row of the buffer.
+    const dim_t LDA = KSW() * IC;
+    const dim_t LDC = oc_blk_;
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t M = (idx & 1) ? 1 : ow_mid_end_ - ow_mid_start_;
+        const dim_t N = (idx & 2) ? OC % oc_blk_ : oc_blk_;
+
+        brgemm_desc_t &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, LDA, OC, LDC, M, N, IC));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = static_cast<int>(KH() * KW());
+        brg_attr.hint_expected_A_size = M * IC;
+        brg_attr.hint_expected_B_size = IC * N;
+        brg_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_set_postops(&brg, &kernel_attr, dst_conv_md(), LDC,
+                with_bias() ? f32 : data_type::undef));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_conv_pool_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t nthr = dnnl_get_max_threads();
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, nthr * KH() * KW());
+    scratchpad.template book<float>(
+            key_fusion_inout_buffer, nthr * pool().kernel * OW() * oc_blk_);
+}
+
+status_t brgemm_conv_pool_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+// Computes the output row `oh` of the OC block starting at `oc` into `row`,
+// a `OW x oc_blk` matrix.
+void brgemm_conv_pool_fwd_t::compute_conv_row(const float *src,
+        const float *wei, const float *bias, float *row,
+        brgemm_batch_element_t *batch, dim_t n, dim_t oh, dim_t oc) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OW = pd()->OW();
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+    const dim_t oc_blk = pd()->oc_blk();
+    const bool oc_tail = pd()->OC() - oc < oc_blk;
+
+    const dim_t ih = oh * pd()->KSH() - pd()->padT();
+    const dim_t kh_start = nstl::max(dim_t(0), -ih);
+    const dim_t kh_end = nstl::min(KH, IH - ih);
+
+    // Computes a single point at the border or all the points with the
+    // whole kernel width inside the source, starting from the point `ow`.
+    auto compute = [&](dim_t ow, bool border) {
+        const dim_t iw = ow * pd()->KSW() - pd()->padL();
+        const dim_t kw_start = border ? nstl::max(dim_t(0), -iw) : 0;
+        const dim_t kw_end = border ? nstl::min(KW, IW - iw) : KW;
+        int bs = 0;
+        for_(dim_t kh = kh_start; kh < kh_end; kh++)
+        for (dim_t kw = kw_start; kw < kw_end; kw++) {
+            batch[bs].ptr.A = src + src_d.blk_off(n, 0, ih + kh, iw + kw);
+            batch[bs].ptr.B = wei + wei_d.blk_off(oc, 0, kh, kw);
+            batch[bs].vvpad.top = 0;
+            batch[bs].vvpad.bottom = 0;
+            bs++;
+        }
+
+        const auto *ker = kernels_[pd_t::ker_idx(border, oc_tail)].get();
+        float *C = row + ow * oc_blk;
+        if (pd()->need_postwork()) {
+            brgemm_post_ops_data_t post_ops_data;
+            post_ops_data.bias = bias ? bias + oc : nullptr;
+            post_ops_data.oc_logical_off = oc;
+            post_ops_data.data_C_ptr_ = reinterpret_cast<char *>(row);
+            brgemm_kernel_execute_postops(
+                    ker, bs, batch, C, C, post_ops_data, nullptr);
+        } else {
+            brgemm_kernel_execute(ker, bs, batch, C);
+        }
+    };
+
+    const dim_t ow_mid_start = pd()->ow_mid_start();
+    const dim_t ow_mid_end = pd()->ow_mid_end();
+    for (dim_t ow = 0; ow < ow_mid_start; ow++)
+        compute(ow, true);
+    if (ow_mid_end > ow_mid_start) compute(ow_mid_start, false);
+    for (dim_t ow = ow_mid_end; ow < OW; ow++)
+        compute(ow, true);
+}
+
+// Reduces the buffered output rows of the pooling window of the pooled row
+// `ph` and stores the result. The output row `oh` is kept in the slot
+// `oh % kernel` of `rows`.
+void brgemm_conv_pool_fwd_t::pool_row(
+        const float *rows, float *dst, dim_t n, dim_t ph, dim_t oc) const {
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &p = pd()->pool();
+
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t oc_blk = pd()->oc_blk();
+    const dim_t nc = nstl::min(oc_blk, pd()->OC() - oc);
+    const bool is_max = p.alg == alg_kind::pooling_max;
+
+    const dim_t oh_start = ph * p.stride - p.padding;
+    const dim_t oh_s = nstl::max(dim_t(0), oh_start);
+    const dim_t oh_e = nstl::min(OH, oh_start + p.kernel);
+
+    float acc[64];
+    for (dim_t pw = 0; pw < pd()->PW(); pw++) {
+        const dim_t ow_start = pw * p.stride - p.padding;
+        const dim_t ow_s = nstl::max(dim_t(0), ow_start);
+        const dim_t ow_e = nstl::min(OW, ow_start + p.kernel);
+
+        const float init = is_max ? nstl::numeric_limits<float>::lowest() : 0.f;
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < nc; c++)
+            acc[c] = init;
+        for_(dim_t oh = oh_s; oh < oh_e; oh++)
+        for (dim_t ow = ow_s; ow < ow_e; ow++) {
+            const float *r = rows + ((oh % p.kernel) * OW + ow) * oc_blk;
+            if (is_max) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < nc; c++)
+                    acc[c] = nstl::max(acc[c], r[c]);
+            } else {
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < nc; c++)
+                    acc[c] += r[c];
+            }
+        }
+
+        float *d = dst + dst_d.blk_off(n, oc, ph, pw);
+        if (is_max) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < nc; c++)
+                d[c] = acc[c];
+        } else {
+            const dim_t num = p.alg == alg_kind::pooling_avg_include_padding
+                    ? p.kernel * p.kernel
+                    : (oh_e - oh_s) * (ow_e - ow_s);
+            const float scale = 1.f / static_cast<float>(num);
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < nc; c++)
+                d[c] = acc[c] * scale;
+        }
+    }
+}
+
+status_t brgemm_conv_pool_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t MB = pd()->MB();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t PH = pd()->PH();
+    const dim_t oc_blk = pd()->oc_blk();
+    const dim_t oc_nblks = pd()->oc_nblks();
+    const dim_t max_bs = pd()->KH() * pd()->KW();
+    const auto &p = pd()->pool();
+    const dim_t buf_size = p.kernel * OW * oc_blk;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto *buf_base = scratchpad.template get<float>(key_fusion_inout_buffer);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * oc_nblks * PH, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * max_bs;
+        float *buf = buf_base + ithr * buf_size;
+
+        // The first output row that is not in the buffer yet. The windows
+        // of consecutive pooled rows overlap by `kernel - stride` rows.
+        dim_t oh_next = 0;
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t ph = iwork % PH;
+            const dim_t ocb = (iwork / PH) % oc_nblks;
+            const dim_t n = iwork / PH / oc_nblks;
+            const dim_t oc = ocb * oc_blk;
+
+            const dim_t oh_start = ph * p.stride - p.padding;
+            const dim_t oh_s = nstl::max(dim_t(0), oh_start);
+            const dim_t oh_e = nstl::min(OH, oh_start + p.kernel);
+            if (iwork == start || ph == 0) oh_next = oh_s;
+            for (dim_t oh = nstl::max(oh_next, oh_s); oh < oh_e; oh++)
+                compute_conv_row(src, wei, bias,
+                        buf + (oh % p.kernel) * OW * oc_blk, batch, n, oh, oc);
+            oh_next = nstl::max(oh_next, oh_e);
+
+            pool_row(buf, dst, n, ph, oc);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
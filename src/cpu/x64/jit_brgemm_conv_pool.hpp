@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_CONV_POOL_HPP
+#define CPU_X64_JIT_BRGEMM_CONV_POOL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Convolution with a fused pooling post-op. Every thread owns a range of
+// pooled rows of a block of output channels and keeps a ring buffer of as
+// many convolution output rows as the pooling window has. A convolution row
+// is computed by brgemm right before the first pooled row that needs it, the
+// rows shared by consecutive pooling windows are reused, and only the pooled
+// rows are stored to the destination.
+struct brgemm_conv_pool_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_pool:", isa_, ""),
+                brgemm_conv_pool_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        const memory_desc_t *dst_conv_md(int index = 0) const {
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        // NOLINTBEGIN(google-default-arguments)
+        const memory_desc_t *dst_md(
+                int index = 0, bool user_input = false) const override {
+            return with_pool_dst_ && index == 0
+                    ? &pool_dst_md_
+                    : cpu_convolution_fwd_pd_t::dst_md(index, user_input);
+        }
+        // NOLINTEND(google-default-arguments)
+
+        // The shape of the problem, `OH()` and `OW()` among it, is the one
+        // of the convolution output.
+        const memory_desc_t *invariant_dst_md() const override {
+            return dst_conv_md();
+        }
+
+        // Kernel index: bit 0 - single output point at the left or right
+        // border, bit 1 - OC block tail.
+        static constexpr int max_num_kernels = 4;
+        static int ker_idx(bool border, bool oc_tail) {
+            return (border ? 1 : 0) + (oc_tail ? 2 : 0);
+        }
+        bool has_kernel(int idx) const {
+            return IMPLICATION(!(idx & 1), ow_mid_end_ > ow_mid_start_)
+                    && IMPLICATION(idx & 2, OC() % oc_blk_ > 0)
+                    && IMPLICATION(!(idx & 2), OC() >= oc_blk_);
+        }
+        const brgemm_desc_t &brg_desc(int idx) const { return brgs_[idx]; }
+
+        dim_t oc_blk() const { return oc_blk_; }
+        dim_t oc_nblks() const { return utils::div_up(OC(), oc_blk_); }
+        // Output points for which the whole kernel width is inside the
+        // source, they are computed by a single brgemm call per row.
+        dim_t ow_mid_start() const { return ow_mid_start_; }
+        dim_t ow_mid_end() const { return ow_mid_end_; }
+
+        const post_ops_t::entry_t::pooling_t &pool() const {
+            return attr()->post_ops_.entry_.back().pooling;
+        }
+        dim_t PH() const { return pool_dst_md_.dims[2]; }
+        dim_t PW() const { return pool_dst_md_.dims[3]; }
+        bool need_postwork() const { return need_postwork_; }
+
+    private:
+        bool post_ops_ok() const;
+        status_t init_pool_dst_md();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t oc_blk_ = 0;
+        dim_t ow_mid_start_ = 0;
+        dim_t ow_mid_end_ = 0;
+        bool need_postwork_ = false;
+        bool with_pool_dst_ = false;
+        memory_desc_t pool_dst_md_;
+        brgemm_desc_t brgs_[max_num_kernels];
+    };
+
+    brgemm_conv_pool_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void compute_conv_row(const float *src, const float *wei, const float *bias,
+            float *row, brgemm_batch_element_t *batch, dim_t n, dim_t oh,
+            dim_t oc) const;
+    void pool_row(const float *rows, float *dst, dim_t n, dim_t ph,
+            dim_t oc) const;
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1993,6 +1993,58 @@ void adjust_nthr(jit_brgemm_conv_conf_t &jcp, const memory_desc_wrapper &src_d,
     }
 }
 
+// For 3D convolutions with both the source of an image and the weights
+// larger than L2 neither order of the loops reuses the caches: loop_ngcdhw
+// streams the whole source for every oc block, loop_ndhwgc streams all the
+// weights for every row of the destination. Tiles of od and oh blocks with
+// the loop over oc blocks between the tiles and the blocks inside them keep
+// the slab of the source of a tile in L2 while the weights of an oc block are
+// reused across the rows of the tile.
+static void init_spatial_tiling(jit_brgemm_conv_conf_t &jcp) {
+    jcp.od_tile = jcp.nb_od;
+    jcp.oh_tile = jcp.nb_oh;
+    if (jcp.ndims != 5 || jcp.loop_order == loop_gcndhw || jcp.nb_oc == 1)
+        return;
+
+    const size_t L2 = brg_blocking_t::L2;
+    const size_t inp_plane_size
+            = static_cast<size_t>(jcp.iw) * jcp.ic * jcp.src_dsz;
+    const size_t src_size = inp_plane_size * jcp.id * jcp.ih;
+    const size_t ocb_wei_size = static_cast<size_t>(jcp.oc_block) * jcp.ic
+            * jcp.kd * jcp.kh * jcp.kw * jcp.wei_dsz;
+    const size_t wei_size = ocb_wei_size * jcp.nb_oc;
+    if (src_size <= L2 || wei_size <= L2) return;
+
+    // Half of L2 is left for the destination and the buffers.
+    const size_t L2_available = L2 / 2;
+    if (ocb_wei_size >= L2_available) return;
+    const auto slab_size = [&](int od_tile, int oh_tile) {
+        const int id = brg_blocking_t::get_inp_size(jcp.id,
+                od_tile * jcp.od_block, jcp.kd, jcp.stride_d, jcp.dilate_d);
+        const int ih = brg_blocking_t::get_inp_size(jcp.ih,
+                oh_tile * jcp.oh_block, jcp.kh, jcp.stride_h, jcp.dilate_h);
+        return inp_plane_size * id * ih + ocb_wei_size;
+    };
+    // The tiles evenly divide the blocks so that the iterator needs no
+    // bounds checks. Full height is preferred, the depth is reduced first.
+    int od_tile = jcp.nb_od;
+    while (od_tile > 1
+            && (jcp.nb_od % od_tile != 0
+                    || slab_size(od_tile, jcp.nb_oh) > L2_available))
+        od_tile--;
+    int oh_tile = jcp.nb_oh;
+    if (od_tile == 1)
+        while (oh_tile > 1
+                && (jcp.nb_oh % oh_tile != 0
+                        || slab_size(1, oh_tile) > L2_available))
+            oh_tile--;
+    if (od_tile == jcp.nb_od && oh_tile == jcp.nb_oh) return;
+
+    jcp.loop_order = loop_ntgcdhw;
+    jcp.od_tile = od_tile;
+    jcp.oh_tile = oh_tile;
+}
+
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -2363,6 +2415,8 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.nb_od = div_up(jcp.od, jcp.od_block);
     jcp.nb_oh = div_up(jcp.oh, jcp.oh_block);
 
+    init_spatial_tiling(jcp);
+
     if (jcp.exec_type == exec_trans) {
         // TODO: this is rough estimation of buffer for transpose input
         dim_t ds = jcp.copy_block_only
@@ -2461,6 +2515,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
             && IMPLICATION(jcp.exec_type == exec_vpad,
                     jcp.t_pad > 0 || jcp.b_pad > 0 || jcp.f_pad > 0
                             || jcp.back_pad > 0);
+    jcp.comp_pad_cached = jcp.req_cal_comp_pad && attr.constant_weights_;
 
     // enable ununroll_bd_loop for big shapes to reduce kernel sizes
     jcp.ununroll_bd_loop
@@ -2754,12 +2809,14 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_conv_amx_tile_buffer,
                 jcp.nthr * jcp.amx_buf_size_per_thread, sizeof(char), 0, P4K);
     }
-    if (jcp.s8s8_compensation_required && jcp.req_cal_comp_pad) {
+    const bool comp_pad_in_scratchpad
+            = jcp.req_cal_comp_pad && !jcp.comp_pad_cached;
+    if (jcp.s8s8_compensation_required && comp_pad_in_scratchpad) {
         scratchpad.book(key_brgemm_primitive_buffer_comp,
                 jcp.s8s8_comp_buffer_size, sizeof(int32_t), 0, P4K);
     }
 
-    if (jcp.src_zero_point && jcp.req_cal_comp_pad) {
+    if (jcp.src_zero_point && comp_pad_in_scratchpad) {
         scratchpad.book(key_brgemm_primitive_zp_comp_a, jcp.comp_a_buffer_size,
                 sizeof(int32_t), 0, P4K);
     }
@@ -2771,6 +2828,16 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
     }
 }
 
+// Limit on the total size of the buffers for the reduction of the diff
+// weights over the minibatch, in bytes. By default every thread may keep a
+// copy of L2 size, ONEDNN_CONV_BWD_W_REDUCTION_LIMIT_MB overrides it.
+static size_t bwd_w_reduction_limit(int nthr) {
+    static const int limit_mb
+            = getenv_int_user("CONV_BWD_W_REDUCTION_LIMIT_MB", 0);
+    if (limit_mb > 0) return static_cast<size_t>(limit_mb) << 20;
+    return static_cast<size_t>(nthr) * platform::get_per_core_cache_size(2);
+}
+
 void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
 
     const auto os_chunks = jcp.nthr_mb_work;
@@ -3097,6 +3164,28 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         nthr = nthr_mb * nthr_g * nthr_oc_b * nthr_ic_b;
     }
 
+    // Threads of the split over the minibatch and spatial dimensions
+    // accumulate into private copies of the whole diff weights. For wide
+    // layers and many threads the copies take gigabytes, so their number is
+    // limited and the threads taken from this split go to the splits over
+    // channels, which need no reduction.
+    const size_t wei_buf_size = sizeof(float) * jcp.ngroups * jcp.nb_oc
+            * jcp.oc_block * jcp.nb_ic * jcp.ic_block * jcp.kh * jcp.kw
+            * jcp.kd;
+    const int num_own_bufs = jcp.wei_dt == data_type::f32 ? 1 : 0;
+    const int nthr_mb_max = static_cast<int>(nstl::min<size_t>(nthr_mb,
+            bwd_w_reduction_limit(jcp.nthr) / wei_buf_size + num_own_bufs));
+    if (nthr_mb > nstl::max(1, nthr_mb_max)) {
+        nthr_mb = nstl::max(1, nthr_mb_max);
+        const int nthr_par = jcp.nthr / (nthr_mb * nthr_g);
+        nthr_oc_b = nstl::min(
+                oc_chunks, nstl::max(nthr_oc_b, nthr_par / nthr_ic_b));
+        nthr_ic_b = nstl::max(1,
+                nstl::min(jcp.nb_ic / jcp.nb_ic_blocking,
+                        nthr_par / nthr_oc_b));
+        nthr = nthr_mb * nthr_g * nthr_oc_b * nthr_ic_b;
+    }
+
     jcp.nthr = nthr;
     jcp.nthr_mb = nthr_mb;
     jcp.nthr_g = nthr_g;
@@ -81,6 +81,16 @@ void get_kw_range(const jit_brgemm_conv_conf_t &jcp, int ow, int &kw_s,
     g, jcp.ngroups, ocb, jcp.nb_oc, n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh, \
             owb, jcp.nb_ow
 
+// The tiles evenly divide the od and oh blocks, the iterator additionally
+// requires `odt`, `oht`, `odbt` and `ohbt` to be declared.
+#define BRGEMM_CONV_NTGCDHW_ORDER \
+    n, jcp.mb, odt, jcp.nb_od / jcp.od_tile, oht, jcp.nb_oh / jcp.oh_tile, g, \
+            jcp.ngroups, ocb, jcp.nb_oc, odbt, jcp.od_tile, ohbt, jcp.oh_tile, \
+            owb, jcp.nb_ow
+#define BRGEMM_CONV_NTGCDHW_BLOCKS \
+    odb = odt * jcp.od_tile + odbt; \
+    ohb = oht * jcp.oh_tile + ohbt;
+
 #define BRGEMM_CONV_ITERATOR_INIT \
     if (jcp.loop_order == loop_ndhwgc) \
         nd_iterator_init(start, BRGEMM_CONV_NDHWGC_ORDER); \
@@ -88,7 +98,10 @@ void get_kw_range(const jit_brgemm_conv_conf_t &jcp, int ow, int &kw_s,
         nd_iterator_init(start, BRGEMM_CONV_NGCDHW_ORDER); \
     else if (jcp.loop_order == loop_gcndhw) \
         nd_iterator_init(start, BRGEMM_CONV_GCNDHW_ORDER); \
-    else \
+    else if (jcp.loop_order == loop_ntgcdhw) { \
+        nd_iterator_init(start, BRGEMM_CONV_NTGCDHW_ORDER); \
+        BRGEMM_CONV_NTGCDHW_BLOCKS \
+    } else \
         assert(!"Unknown loop order");
 
 #define BRGEMM_CONV_ITERATOR_STEP \
@@ -98,7 +111,10 @@ void get_kw_range(const jit_brgemm_conv_conf_t &jcp, int ow, int &kw_s,
         nd_iterator_step(BRGEMM_CONV_NGCDHW_ORDER); \
     else if (jcp.loop_order == loop_gcndhw) \
         nd_iterator_step(BRGEMM_CONV_GCNDHW_ORDER); \
-    else \
+    else if (jcp.loop_order == loop_ntgcdhw) { \
+        nd_iterator_step(BRGEMM_CONV_NTGCDHW_ORDER); \
+        BRGEMM_CONV_NTGCDHW_BLOCKS \
+    } else \
         assert(!"Unknown loop order");
 
 } // namespace brgemm_convolution_utils
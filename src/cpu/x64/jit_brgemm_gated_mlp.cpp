@@ -0,0 +1,304 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/jit_brgemm_gated_mlp.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Aligns the parts of the per-thread workspace to a cache line.
+size_t wsp_align(size_t size) {
+    return rnd_up(size, 64);
+}
+
+void store_row(data_type_t dt, char *dst, const float *src, dim_t n) {
+    switch (dt) {
+        case f32: std::memcpy(dst, src, n * sizeof(float)); break;
+        case f16:
+            cvt_float_to_float16(reinterpret_cast<float16_t *>(dst), src, n);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
+status_t jit_brgemm_gated_mlp_fwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wg_d(w_gate_md());
+    const memory_desc_wrapper wu_d(w_up_md());
+    const memory_desc_wrapper wd_d(w_down_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const data_type_t dt = src_d.data_type();
+
+    VDISPATCH_GATED_MLP(one_of(dt, f32, f16)
+                    && everyone_is(dt, wg_d.data_type(), wu_d.data_type(),
+                            wd_d.data_type(), dst_d.data_type()),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_GATED_MLP(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GATED_MLP(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_GATED_MLP(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GATED_MLP(!src_d.has_runtime_dims_or_strides()
+                    && !wg_d.has_runtime_dims_or_strides()
+                    && !wu_d.has_runtime_dims_or_strides()
+                    && !wd_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // The weights are consumed as they are by brgemm, which expects dense
+    // row-major B matrices. The gate and the up weights share the kernels.
+    VDISPATCH_GATED_MLP(src_d.matches_one_of_tag(format_tag::ab)
+                    && wg_d.matches_one_of_tag(format_tag::ab)
+                    && wu_d.matches_one_of_tag(format_tag::ab)
+                    && wd_d.matches_one_of_tag(format_tag::ab)
+                    && dst_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    switch (dt) {
+        case f32:
+            isa_ = mayiuse(avx512_core) ? avx512_core
+                    : mayiuse(avx2)     ? avx2
+                                        : isa_undef;
+            break;
+        case f16:
+            isa_ = mayiuse(avx512_core_fp16) ? avx512_core_fp16 : isa_undef;
+            break;
+        default: isa_ = isa_undef;
+    }
+    VDISPATCH_GATED_MLP(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    // Empirical: the gate, up and hidden tiles of a thread fit L1 and the
+    // `m_blk x OC` accumulator of the down projection fits L2 for the common
+    // model sizes.
+    m_blk_ = nstl::min(MB(), dim_t(32));
+    h_blk_ = nstl::min(HIDDEN(), dim_t(64));
+
+    // Small batches (token generation) do not have enough token blocks to
+    // keep all the threads busy, so the hidden layer is split as well.
+    const dim_t nthr = dnnl_get_max_threads();
+    nsplits_ = nstl::max(dim_t(1), nstl::min(h_nblks(), nthr / m_nblks()));
+
+    CHECK(init_brgemm_descs());
+    // A VNNI layout of the weights would require repacking them on every
+    // execution, which defeats the purpose of the fusion.
+    VDISPATCH_GATED_MLP(!gate_up_descs_[0].is_b_data_layout_vnni(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_brgemm_gated_mlp_fwd_t::pd_t::init_brgemm_descs() {
+    const data_type_t dt = src_md()->data_type;
+    const dim_t IC = this->IC();
+    const dim_t OC = this->OC();
+    const dim_t H = HIDDEN();
+
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t M = (idx & 1) ? MB() % m_blk_ : m_blk_;
+        const dim_t N = (idx & 2) ? H % h_blk_ : h_blk_;
+
+        // G = src * W_gate and U = src * W_up: A is a block of tokens, B is
+        // a chunk of columns of the weights and C is a f32 tile.
+        brgemm_desc_t &gu = gate_up_descs_[idx];
+        CHECK(brgemm_desc_init(&gu, isa_, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 0.f, IC, H, h_blk_, M, N, IC));
+        brgemm_attr_t gu_attr;
+        gu_attr.max_bs = 1;
+        gu_attr.hint_expected_A_size = M * IC;
+        gu_attr.hint_expected_B_size = IC * N;
+        gu_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&gu, gu_attr));
+        CHECK(brgemm_desc_finalize(&gu));
+
+        // acc += H * W_down: A is the hidden tile, B is a chunk of rows of
+        // the weights and C is the f32 accumulator of the token block.
+        brgemm_desc_t &down = down_descs_[idx];
+        CHECK(brgemm_desc_init(&down, isa_, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 1.f, h_blk_, OC, OC, M, OC, N));
+        brgemm_attr_t down_attr;
+        down_attr.max_bs = 1;
+        down_attr.hint_expected_A_size = M * N;
+        down_attr.hint_expected_B_size = N * OC;
+        down_attr.hint_expected_C_size = M * OC;
+        CHECK(brgemm_desc_set_attr(&down, down_attr));
+        CHECK(brgemm_desc_finalize(&down));
+    }
+    return status::success;
+}
+
+void jit_brgemm_gated_mlp_fwd_t::pd_t::init_scratchpad() {
+    const size_t dt_size = types::data_type_size(src_md()->data_type);
+
+    // Gate and up tiles in f32 and the hidden tile in the source data type.
+    wsp_per_thr_ = 2 * wsp_align(sizeof(float) * m_blk_ * h_blk_)
+            + wsp_align(dt_size * m_blk_ * h_blk_);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!acc_in_dst())
+        scratchpad.template book<float>(
+                key_gated_mlp_dst_acc, nsplits_ * MB() * OC());
+    scratchpad.template book<char>(
+            key_gated_mlp_wsp, wsp_per_thr_ * dnnl_get_max_threads());
+}
+
+status_t jit_brgemm_gated_mlp_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->gate_up_desc(idx)));
+        CHECK(safe_ptr_assign(gate_up_kernels_[idx], ker));
+        CHECK(brgemm_kernel_create(&ker, pd()->down_desc(idx)));
+        CHECK(safe_ptr_assign(down_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t jit_brgemm_gated_mlp_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto *w_gate = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_GATE);
+    const auto *w_up = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_UP);
+    const auto *w_down = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_DOWN);
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const gated_mlp_desc_t *desc = pd()->desc();
+    const data_type_t dt = pd()->src_md()->data_type;
+    const size_t dt_size = types::data_type_size(dt);
+    const dim_t MB = pd()->MB();
+    const dim_t IC = pd()->IC();
+    const dim_t H = pd()->HIDDEN();
+    const dim_t OC = pd()->OC();
+    const dim_t m_blk = pd()->m_blk();
+    const dim_t h_blk = pd()->h_blk();
+    const dim_t m_nblks = pd()->m_nblks();
+    const dim_t h_nblks = pd()->h_nblks();
+    const dim_t nsplits = pd()->nsplits();
+    const bool acc_in_dst = pd()->acc_in_dst();
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *acc_base = acc_in_dst
+            ? reinterpret_cast<float *>(dst)
+            : scratchpad.template get<float>(key_gated_mlp_dst_acc);
+    char *wsp_base = scratchpad.template get<char>(key_gated_mlp_wsp);
+
+    const size_t tile_size = wsp_align(sizeof(float) * m_blk * h_blk);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(m_nblks * nsplits, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *wsp = wsp_base + ithr * pd()->wsp_per_thr();
+        float *gate = reinterpret_cast<float *>(wsp);
+        float *up = reinterpret_cast<float *>(wsp + tile_size);
+        char *hidden = wsp + 2 * tile_size;
+
+        brgemm_batch_element_t batch;
+        batch.vvpad.top = 0;
+        batch.vvpad.bottom = 0;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / nsplits;
+            const dim_t split = iwork % nsplits;
+            const dim_t m = mb * m_blk;
+            const dim_t vM = nstl::min(m_blk, MB - m);
+            const bool m_tail = vM < m_blk;
+
+            dim_t hb_start = 0, hb_end = 0;
+            balance211(h_nblks, nsplits, split, hb_start, hb_end);
+
+            float *acc = acc_base + (split * MB + m) * OC;
+            for (dim_t i = 0; i < vM * OC; i++)
+                acc[i] = 0.f;
+            if (hb_start >= hb_end) continue;
+
+            const char *A = src + m * IC * dt_size;
+            for (dim_t hb = hb_start; hb < hb_end; hb++) {
+                const dim_t h = hb * h_blk;
+                const dim_t vH = nstl::min(h_blk, H - h);
+                const int idx = pd_t::ker_idx(m_tail, vH < h_blk);
+
+                batch.ptr.A = A;
+                batch.ptr.B = w_gate + h * dt_size;
+                brgemm_kernel_execute(
+                        gate_up_kernels_[idx].get(), 1, &batch, gate);
+                batch.ptr.B = w_up + h * dt_size;
+                brgemm_kernel_execute(
+                        gate_up_kernels_[idx].get(), 1, &batch, up);
+
+                // The tiles are still in L1, apply the activation to the
+                // gate and multiply it by the up projection.
+                for (dim_t i = 0; i < vM; i++) {
+                    float *g = gate + i * h_blk;
+                    const float *u = up + i * h_blk;
+                    for (dim_t j = 0; j < vH; j++)
+                        g[j] = compute_eltwise_scalar_fwd(desc->activation,
+                                       g[j], desc->alpha, desc->beta)
+                                * u[j];
+                    store_row(dt, hidden + i * h_blk * dt_size, g, vH);
+                }
+
+                batch.ptr.A = hidden;
+                batch.ptr.B = w_down + h * OC * dt_size;
+                brgemm_kernel_execute(
+                        down_kernels_[idx].get(), 1, &batch, acc);
+                batch.ptr.A = A;
+            }
+        }
+    });
+
+    if (acc_in_dst) return status::success;
+
+    // Sum up the partial results of the hidden layer splits and convert them
+    // to the destination data type.
+    parallel_nd(MB, [&](dim_t m) {
+        float *acc = acc_base + m * OC;
+        for (dim_t split = 1; split < nsplits; split++) {
+            const float *part = acc_base + (split * MB + m) * OC;
+            for (dim_t oc = 0; oc < OC; oc++)
+                acc[oc] += part[oc];
+        }
+        store_row(pd()->dst_md()->data_type, dst + m * OC * dt_size, acc, OC);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
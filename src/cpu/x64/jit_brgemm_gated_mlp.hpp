@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_GATED_MLP_HPP
+#define CPU_X64_JIT_BRGEMM_GATED_MLP_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/gated_mlp_pd.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Fused gated MLP. Every work item is a block of `m_blk` tokens and a range of
+// the hidden layer, which is processed by chunks of `h_blk` channels:
+//   G = src * W_gate[:, chunk], U = src * W_up[:, chunk]   (brgemm, f32)
+//   H = act(G) x U                                          (per-thread tile)
+//   acc += H * W_down[chunk, :]                             (brgemm, beta = 1)
+// The hidden activations never leave the per-thread `m_blk x h_blk` tiles.
+// When there are fewer token blocks than threads the hidden layer is split
+// between the threads as well, and the partial results are summed up at the
+// end.
+struct jit_brgemm_gated_mlp_fwd_t : public primitive_t {
+    struct pd_t : public gated_mlp_pd_t {
+        using gated_mlp_pd_t::gated_mlp_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa_, ""),
+                jit_brgemm_gated_mlp_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: bit 0 - token block tail, bit 1 - hidden chunk tail.
+        static constexpr int max_num_kernels = 4;
+        static int ker_idx(bool m_tail, bool h_tail) {
+            return (m_tail ? 1 : 0) + (h_tail ? 2 : 0);
+        }
+        bool has_kernel(int idx) const {
+            return IMPLICATION(idx & 1, MB() % m_blk_ > 0)
+                    && IMPLICATION(idx & 2, HIDDEN() % h_blk_ > 0);
+        }
+
+        const brgemm_desc_t &gate_up_desc(int idx) const {
+            return gate_up_descs_[idx];
+        }
+        const brgemm_desc_t &down_desc(int idx) const {
+            return down_descs_[idx];
+        }
+
+        dim_t m_blk() const { return m_blk_; }
+        dim_t h_blk() const { return h_blk_; }
+        dim_t m_nblks() const { return utils::div_up(MB(), m_blk_); }
+        dim_t h_nblks() const { return utils::div_up(HIDDEN(), h_blk_); }
+        // Number of parts the hidden layer is split into.
+        dim_t nsplits() const { return nsplits_; }
+        // If true, the f32 destination is accumulated in place.
+        bool acc_in_dst() const {
+            return nsplits_ == 1 && dst_md()->data_type == data_type::f32;
+        }
+        // Size of the per-thread workspace in bytes.
+        size_t wsp_per_thr() const { return wsp_per_thr_; }
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t m_blk_ = 0;
+        dim_t h_blk_ = 0;
+        dim_t nsplits_ = 1;
+        size_t wsp_per_thr_ = 0;
+        brgemm_desc_t gate_up_descs_[max_num_kernels];
+        brgemm_desc_t down_descs_[max_num_kernels];
+    };
+
+    jit_brgemm_gated_mlp_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> gate_up_kernels_[pd_t::max_num_kernels];
+    std::unique_ptr<brgemm_kernel_t> down_kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,293 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_group_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_group_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_direct),
+            VERBOSE_BAD_ALGORITHM);
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_CONV(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4 && with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D grouped convolutions are supported");
+    // Depthwise convolutions are left to brdgmm, and groups of at least half
+    // of a vector register are left to the regular implementations, as
+    // block-diagonal weights would waste the computations there.
+    const dim_t ICg = IC() / G();
+    const dim_t OCg = OC() / G();
+    const dim_t simd_w = isa_max_vlen(isa_) / sizeof(float);
+    VDISPATCH_CONV(ICg * OCg > 1 && 2 * OCg <= simd_w,
+            VERBOSE_UNSUPPORTED_FEATURE, "groups are not narrow enough");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations are not supported");
+    // With padding smaller than the kernel every output point has at least
+    // one kernel point inside the source, so the batch is never empty.
+    VDISPATCH_CONV(everyone_is(true, 0 <= padT(), padT() < KH(), 0 <= padB(),
+                           padB() < KH(), 0 <= padL(), padL() < KW(),
+                           0 <= padR(), padR() < KW()),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "padding not smaller than kernel");
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, goihw, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.matches_tag(nhwc) && dst_d.matches_tag(nhwc)
+                    && wei_d.is_blocking_desc(),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(!src_d.has_runtime_dims_or_strides()
+                    && !wei_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // A block of groups fills a vector register of the destination.
+    g_blk_ = nstl::min(G(), simd_w / OCg);
+
+    ow_mid_start_ = nstl::min(OW(), div_up(padL(), KSW()));
+    const dim_t last_iw_start = IW() - KW() + padL();
+    ow_mid_end_ = last_iw_start < 0
+            ? ow_mid_start_
+            : saturate(ow_mid_start_, OW(), last_iw_start / KSW() + 1);
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_group_convolution_fwd_t::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise(/* require_scale_one = */ true))
+            return false;
+    return true;
+}
+
+status_t brgemm_group_convolution_fwd_t::pd_t::init_brgemm_descs() {
+    const dim_t ICg = IC() / G();
+    const dim_t OCg = OC() / G();
+    // Consecutive rows of the A matrix are the source points of consecutive
+    // output points.
+    const dim_t LDA = KSW() * IC();
+    const dim_t LDC = OC();
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t vG = (idx & 2) ? G() % g_blk_ : g_blk_;
+        const dim_t M = (idx & 1) ? 1 : ow_mid_end_ - ow_mid_start_;
+        const dim_t N = vG * OCg;
+        const dim_t K = vG * ICg;
+
+        brgemm_desc_t &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, LDA, N, LDC, M, N, K));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = static_cast<int>(KH() * KW());
+        brg_attr.hint_expected_A_size = M * K;
+        brg_attr.hint_expected_B_size = K * N;
+        brg_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_set_postops(&brg, attr(), dst_md(), LDC,
+                with_bias() ? f32 : data_type::undef));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_group_convolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_conv_permuted_weights,
+            g_nblks() * KH() * KW() * wei_blk_size());
+    scratchpad.template book<brgemm_batch_element_t>(key_brgemm_primitive_batch,
+            static_cast<size_t>(dnnl_get_max_threads()) * KH() * KW());
+}
+
+status_t brgemm_group_convolution_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+// The packed weights of a block of groups for a kernel point are a
+// `vG * ICg x vG * OCg` block-diagonal matrix, where `vG` is the number of
+// groups in the block.
+void brgemm_group_convolution_fwd_t::pack_weights(
+        const float *wei, float *wei_packed) const {
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const dim_t G = pd()->G();
+    const dim_t ICg = pd()->IC() / G;
+    const dim_t OCg = pd()->OC() / G;
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+    const dim_t g_blk = pd()->g_blk();
+    const dim_t wei_blk_size = pd()->wei_blk_size();
+
+    parallel_nd(pd()->g_nblks(), KH, KW, [&](dim_t gb, dim_t kh, dim_t kw) {
+        const dim_t g_start = gb * g_blk;
+        const dim_t vG = nstl::min(g_blk, G - g_start);
+        const dim_t N = vG * OCg;
+        float *w = wei_packed + ((gb * KH + kh) * KW + kw) * wei_blk_size;
+        for (dim_t i = 0; i < vG * ICg * N; i++)
+            w[i] = 0.f;
+        for_(dim_t g = 0; g < vG; g++)
+        for_(dim_t ic = 0; ic < ICg; ic++)
+        for (dim_t oc = 0; oc < OCg; oc++)
+            w[(g * ICg + ic) * N + g * OCg + oc]
+                    = wei[wei_d.off(g_start + g, oc, ic, kh, kw)];
+    });
+}
+
+status_t brgemm_group_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t MB = pd()->MB();
+    const dim_t G = pd()->G();
+    const dim_t ICg = pd()->IC() / G;
+    const dim_t OCg = pd()->OC() / G;
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+    const dim_t KSH = pd()->KSH();
+    const dim_t KSW = pd()->KSW();
+    const dim_t padT = pd()->padT();
+    const dim_t padL = pd()->padL();
+    const dim_t g_blk = pd()->g_blk();
+    const dim_t g_nblks = pd()->g_nblks();
+    const dim_t ow_mid_start = pd()->ow_mid_start();
+    const dim_t ow_mid_end = pd()->ow_mid_end();
+    const dim_t wei_blk_size = pd()->wei_blk_size();
+    const bool need_postwork
+            = pd()->with_bias() || pd()->attr()->post_ops_.len() > 0;
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *wei_packed
+            = scratchpad.template get<float>(key_conv_permuted_weights);
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    pack_weights(wei, wei_packed);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * OH * g_nblks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * KH * KW;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t gb = iwork % g_nblks;
+            const dim_t oh = (iwork / g_nblks) % OH;
+            const dim_t n = iwork / g_nblks / OH;
+            const dim_t g_start = gb * g_blk;
+            const bool g_tail = G - g_start < g_blk;
+            const dim_t ic = g_start * ICg;
+            const dim_t oc = g_start * OCg;
+            const float *wei_gb = wei_packed + gb * KH * KW * wei_blk_size;
+
+            const dim_t ih_start = oh * KSH - padT;
+            const dim_t kh_start = nstl::max(dim_t(0), -ih_start);
+            const dim_t kh_end = nstl::min(KH, IH - ih_start);
+
+            // Computes the output points starting from `ow`: a single point
+            // at the border or all the points with the whole kernel width
+            // inside the source.
+            auto compute = [&](dim_t ow, bool border) {
+                const dim_t iw_start = ow * KSW - padL;
+                const dim_t kw_start
+                        = border ? nstl::max(dim_t(0), -iw_start) : 0;
+                const dim_t kw_end
+                        = border ? nstl::min(KW, IW - iw_start) : KW;
+                int bs = 0;
+                for_(dim_t kh = kh_start; kh < kh_end; kh++)
+                for (dim_t kw = kw_start; kw < kw_end; kw++) {
+                    batch[bs].ptr.A = src
+                            + src_d.blk_off(
+                                    n, ic, ih_start + kh, iw_start + kw);
+                    batch[bs].ptr.B = wei_gb + (kh * KW + kw) * wei_blk_size;
+                    batch[bs].vvpad.top = 0;
+                    batch[bs].vvpad.bottom = 0;
+                    bs++;
+                }
+
+                const auto *ker
+                        = kernels_[pd_t::ker_idx(border, g_tail)].get();
+                float *C = dst + dst_d.blk_off(n, oc, oh, ow);
+                if (need_postwork) {
+                    brgemm_post_ops_data_t post_ops_data;
+                    post_ops_data.bias = bias ? bias + oc : nullptr;
+                    post_ops_data.oc_logical_off = oc;
+                    post_ops_data.data_C_ptr_ = reinterpret_cast<char *>(dst);
+                    brgemm_kernel_execute_postops(
+                            ker, bs, batch, C, C, post_ops_data, nullptr);
+                } else {
+                    brgemm_kernel_execute(ker, bs, batch, C);
+                }
+            };
+
+            for (dim_t ow = 0; ow < ow_mid_start; ow++)
+                compute(ow, true);
+            if (ow_mid_end > ow_mid_start) compute(ow_mid_start, false);
+            for (dim_t ow = ow_mid_end; ow < OW; ow++)
+                compute(ow, true);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
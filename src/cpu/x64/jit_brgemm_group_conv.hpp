@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_GROUP_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_GROUP_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Grouped convolution with groups narrower than a vector register. Several
+// groups are packed into one block and computed by a single brgemm call with
+// block-diagonal weights:
+//   dst[ow][g_blk * oc] = sum_{kh, kw} src[ow * sw + kw][g_blk * ic]
+//                                      * W[kh][kw][g_blk * ic][g_blk * oc]
+// where the blocks of W that mix different groups are zero. The batch of
+// the brgemm call runs over the kernel points.
+struct brgemm_group_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_group:", isa_, ""),
+                brgemm_group_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: bit 0 - single output point at the left or right
+        // border, bit 1 - groups block tail.
+        static constexpr int max_num_kernels = 4;
+        static int ker_idx(bool border, bool g_tail) {
+            return (border ? 1 : 0) + (g_tail ? 2 : 0);
+        }
+        bool has_kernel(int idx) const {
+            return IMPLICATION(!(idx & 1), ow_mid_end_ > ow_mid_start_)
+                    && IMPLICATION(idx & 2, G() % g_blk_ > 0);
+        }
+        const brgemm_desc_t &brg_desc(int idx) const { return brgs_[idx]; }
+
+        dim_t g_blk() const { return g_blk_; }
+        dim_t g_nblks() const { return utils::div_up(G(), g_blk_); }
+        // Output points for which the whole kernel width is inside the
+        // source, they are computed by a single brgemm call per row.
+        dim_t ow_mid_start() const { return ow_mid_start_; }
+        dim_t ow_mid_end() const { return ow_mid_end_; }
+        // Size of the packed weights of a block of groups for a single
+        // kernel point.
+        dim_t wei_blk_size() const {
+            return g_blk_ * IC() / G() * g_blk_ * OC() / G();
+        }
+
+    private:
+        bool post_ops_ok() const;
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t g_blk_ = 0;
+        dim_t ow_mid_start_ = 0;
+        dim_t ow_mid_end_ = 0;
+        brgemm_desc_t brgs_[max_num_kernels];
+    };
+
+    brgemm_group_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void pack_weights(const float *wei, float *wei_packed) const;
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
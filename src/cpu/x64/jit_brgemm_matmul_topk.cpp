@@ -0,0 +1,265 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_matmul_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+struct topk_entry_t {
+    float val;
+    int32_t idx;
+};
+
+// Returns true if `a` goes before `b` in the result: larger values first and
+// smaller indices first among equal values. Empty entries (idx < 0) go last.
+inline bool is_better(const topk_entry_t &a, const topk_entry_t &b) {
+    if (a.val != b.val) return a.val > b.val;
+    return static_cast<uint32_t>(a.idx) < static_cast<uint32_t>(b.idx);
+}
+
+} // namespace
+
+status_t jit_brgemm_matmul_topk_fwd_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper val_d(dst_values_md());
+    const memory_desc_wrapper idx_d(dst_indices_md());
+    const data_type_t dt = src_d.data_type();
+
+    VDISPATCH_MATMUL_TOPK(one_of(dt, f32, f16) && wei_d.data_type() == dt
+                    && one_of(val_d.data_type(), f32, dt)
+                    && idx_d.data_type() == s32,
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL_TOPK(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL_TOPK(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL_TOPK(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL_TOPK(!src_d.has_runtime_dims_or_strides()
+                    && !wei_d.has_runtime_dims_or_strides()
+                    && !val_d.has_runtime_dims_or_strides()
+                    && !idx_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // The weights are consumed as they are by brgemm, which expects a dense
+    // row-major B matrix.
+    VDISPATCH_MATMUL_TOPK(src_d.matches_one_of_tag(format_tag::ab)
+                    && wei_d.matches_one_of_tag(format_tag::ab)
+                    && val_d.matches_one_of_tag(format_tag::ab)
+                    && idx_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    switch (dt) {
+        case f32:
+            isa_ = mayiuse(avx512_core) ? avx512_core
+                    : mayiuse(avx2)     ? avx2
+                                        : isa_undef;
+            break;
+        case f16:
+            isa_ = mayiuse(avx512_core_fp16) ? avx512_core_fp16 : isa_undef;
+            break;
+        default: isa_ = isa_undef;
+    }
+    VDISPATCH_MATMUL_TOPK(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    // The `m_blk x n_blk` tile of logits stays in L1 while it is scanned.
+    m_blk_ = nstl::min(M(), dim_t(32));
+    n_blk_ = nstl::min(N(), dim_t(128));
+
+    // Token generation has a few rows only, so the columns are split between
+    // the threads to keep all of them busy.
+    const dim_t nthr = dnnl_get_max_threads();
+    nsplits_ = nstl::max(dim_t(1), nstl::min(n_nblks(), nthr / m_nblks()));
+
+    CHECK(init_brgemm_descs());
+    // A VNNI layout of the weights would require repacking them on every
+    // execution.
+    VDISPATCH_MATMUL_TOPK(!brg_descs_[0].is_b_data_layout_vnni(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_brgemm_matmul_topk_fwd_t::pd_t::init_brgemm_descs() {
+    const data_type_t dt = src_md()->data_type;
+    const dim_t K = this->K();
+    const dim_t N = this->N();
+
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t vM = (idx & 1) ? M() % m_blk_ : m_blk_;
+        const dim_t vN = (idx & 2) ? N % n_blk_ : n_blk_;
+
+        brgemm_desc_t &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 0.f, K, N, n_blk_, vM, vN, K));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        brg_attr.hint_expected_A_size = vM * K;
+        brg_attr.hint_expected_B_size = K * vN;
+        brg_attr.hint_expected_C_size = vM * vN;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void jit_brgemm_matmul_topk_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    // The heaps of every row and every split, the heaps of a row are
+    // contiguous to be merged in place.
+    scratchpad.template book<char>(key_matmul_topk_cand,
+            sizeof(topk_entry_t) * M() * nsplits_ * TOPK());
+    // Tiles of logits.
+    scratchpad.template book<float>(
+            key_matmul_topk_wsp, m_blk_ * n_blk_ * dnnl_get_max_threads());
+}
+
+status_t jit_brgemm_matmul_topk_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t jit_brgemm_matmul_topk_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto *dst_val = CTX_OUT_MEM(char *, DNNL_ARG_DST_VALUES);
+    auto *dst_idx = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_INDICES);
+
+    const size_t dt_size = types::data_type_size(pd()->src_md()->data_type);
+    const data_type_t val_dt = pd()->dst_values_md()->data_type;
+    const dim_t M = pd()->M();
+    const dim_t K = pd()->K();
+    const dim_t N = pd()->N();
+    const dim_t TOPK = pd()->TOPK();
+    const dim_t m_blk = pd()->m_blk();
+    const dim_t n_blk = pd()->n_blk();
+    const dim_t m_nblks = pd()->m_nblks();
+    const dim_t n_nblks = pd()->n_nblks();
+    const dim_t nsplits = pd()->nsplits();
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    auto *cand_base = reinterpret_cast<topk_entry_t *>(
+            scratchpad.template get<char>(key_matmul_topk_cand));
+    float *tile_base = scratchpad.template get<float>(key_matmul_topk_wsp);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(m_nblks * nsplits, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *tile = tile_base + ithr * m_blk * n_blk;
+
+        brgemm_batch_element_t batch;
+        batch.vvpad.top = 0;
+        batch.vvpad.bottom = 0;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / nsplits;
+            const dim_t split = iwork % nsplits;
+            const dim_t m = mb * m_blk;
+            const dim_t vM = nstl::min(m_blk, M - m);
+            const bool m_tail = vM < m_blk;
+
+            // The heaps are min-heaps with respect to `is_better`, so the
+            // front entry is the one to be replaced first.
+            const topk_entry_t empty
+                    = {-std::numeric_limits<float>::infinity(), -1};
+            for (dim_t i = 0; i < vM; i++) {
+                topk_entry_t *heap
+                        = cand_base + ((m + i) * nsplits + split) * TOPK;
+                std::fill(heap, heap + TOPK, empty);
+            }
+
+            dim_t nb_start = 0, nb_end = 0;
+            balance211(n_nblks, nsplits, split, nb_start, nb_end);
+
+            batch.ptr.A = src + m * K * dt_size;
+            for (dim_t nb = nb_start; nb < nb_end; nb++) {
+                const dim_t n = nb * n_blk;
+                const dim_t vN = nstl::min(n_blk, N - n);
+                const int idx = pd_t::ker_idx(m_tail, vN < n_blk);
+
+                batch.ptr.B = wei + n * dt_size;
+                brgemm_kernel_execute(
+                        brg_kernels_[idx].get(), 1, &batch, tile);
+
+                // The tile is still in L1, push it through the heaps. Most of
+                // the logits are rejected by the comparison with the front.
+                for (dim_t i = 0; i < vM; i++) {
+                    const float *l = tile + i * n_blk;
+                    topk_entry_t *heap
+                            = cand_base + ((m + i) * nsplits + split) * TOPK;
+                    for (dim_t j = 0; j < vN; j++) {
+                        const topk_entry_t e
+                                = {l[j], static_cast<int32_t>(n + j)};
+                        if (!is_better(e, heap[0])) continue;
+                        std::pop_heap(heap, heap + TOPK, is_better);
+                        heap[TOPK - 1] = e;
+                        std::push_heap(heap, heap + TOPK, is_better);
+                    }
+                }
+            }
+        }
+    });
+
+    // Merge the heaps of the splits of every row and sort the result.
+    parallel_nd(M, [&](dim_t m) {
+        topk_entry_t *row = cand_base + m * nsplits * TOPK;
+        std::partial_sort(row, row + TOPK, row + nsplits * TOPK, is_better);
+        for (dim_t i = 0; i < TOPK; i++) {
+            dst_idx[m * TOPK + i] = row[i].idx;
+            if (val_dt == f32)
+                reinterpret_cast<float *>(dst_val)[m * TOPK + i] = row[i].val;
+            else
+                reinterpret_cast<float16_t *>(dst_val)[m * TOPK + i]
+                        = static_cast<float16_t>(row[i].val);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
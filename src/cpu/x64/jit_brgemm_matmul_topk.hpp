@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_MATMUL_TOPK_HPP
+#define CPU_X64_JIT_BRGEMM_MATMUL_TOPK_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/matmul_topk_pd.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Matmul with a fused top-k selection, e.g. the LM head of a decoder. Every
+// work item is a block of `m_blk` rows and a range of the columns, which is
+// processed by blocks of `n_blk` columns:
+//   L = src * W[:, block]   (brgemm, f32 tile)
+//   every row of L is pushed through the top-k heap of the row
+// The logits never leave the per-thread `m_blk x n_blk` tile. When there are
+// fewer row blocks than threads the columns are split between the threads as
+// well, every split keeps its own heaps and the heaps of a row are merged at
+// the end.
+struct jit_brgemm_matmul_topk_fwd_t : public primitive_t {
+    struct pd_t : public matmul_topk_pd_t {
+        using matmul_topk_pd_t::matmul_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa_, ""),
+                jit_brgemm_matmul_topk_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: bit 0 - row block tail, bit 1 - column block tail.
+        static constexpr int max_num_kernels = 4;
+        static int ker_idx(bool m_tail, bool n_tail) {
+            return (m_tail ? 1 : 0) + (n_tail ? 2 : 0);
+        }
+        bool has_kernel(int idx) const {
+            return IMPLICATION(idx & 1, M() % m_blk_ > 0)
+                    && IMPLICATION(idx & 2, N() % n_blk_ > 0);
+        }
+
+        const brgemm_desc_t &brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+
+        dim_t m_blk() const { return m_blk_; }
+        dim_t n_blk() const { return n_blk_; }
+        dim_t m_nblks() const { return utils::div_up(M(), m_blk_); }
+        dim_t n_nblks() const { return utils::div_up(N(), n_blk_); }
+        // Number of parts the columns are split into.
+        dim_t nsplits() const { return nsplits_; }
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t m_blk_ = 0;
+        dim_t n_blk_ = 0;
+        dim_t nsplits_ = 1;
+        brgemm_desc_t brg_descs_[max_num_kernels];
+    };
+
+    jit_brgemm_matmul_topk_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,766 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Aligns the parts of the per-thread workspace to a cache line.
+size_t wsp_align(size_t size) {
+    return rnd_up(size, 64);
+}
+
+template <typename T>
+void pack_b_block(T *dst, const char *src, dim_t src_stride_r,
+        dim_t src_stride_c, dim_t nrows, dim_t ncols, dim_t ldb, dim_t vrows,
+        dim_t vcols, int vnni) {
+    // `nrows x ncols` of the source are copied to a zero padded
+    // `vrows x vcols` row-major block, `vnni` consecutive rows are
+    // interleaved.
+    for (dim_t r = 0; r < vrows; r++) {
+        for (dim_t c = 0; c < vcols; c++) {
+            const dim_t off = (r / vnni) * ldb * vnni + c * vnni + r % vnni;
+            if (r < nrows && c < ncols) {
+                const T *s = reinterpret_cast<const T *>(src)
+                        + r * src_stride_r + c * src_stride_c;
+                dst[off] = *s;
+            } else {
+                dst[off] = T(0);
+            }
+        }
+    }
+}
+
+// Same as `pack_b_block()`, the values of the source are returned by
+// `load(r, c)`.
+template <typename T, typename load_t>
+void pack_b_block_f(T *dst, const load_t &load, dim_t nrows, dim_t ncols,
+        dim_t ldb, dim_t vrows, dim_t vcols, int vnni) {
+    for (dim_t r = 0; r < vrows; r++) {
+        for (dim_t c = 0; c < vcols; c++) {
+            const dim_t off = (r / vnni) * ldb * vnni + c * vnni + r % vnni;
+            dst[off] = r < nrows && c < ncols ? T(load(r, c)) : T(0.f);
+        }
+    }
+}
+
+template <typename load_t>
+void pack_b_block_f(data_type_t dt, char *dst, const load_t &load,
+        dim_t nrows, dim_t ncols, dim_t ldb, dim_t vrows, dim_t vcols,
+        int vnni) {
+    switch (dt) {
+        case f32:
+            pack_b_block_f(reinterpret_cast<float *>(dst), load, nrows, ncols,
+                    ldb, vrows, vcols, vnni);
+            break;
+        case bf16:
+            pack_b_block_f(reinterpret_cast<bfloat16_t *>(dst), load, nrows,
+                    ncols, ldb, vrows, vcols, vnni);
+            break;
+        case f16:
+            pack_b_block_f(reinterpret_cast<float16_t *>(dst), load, nrows,
+                    ncols, ldb, vrows, vcols, vnni);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+bool quant_entry_ok(const quant_entry_t &e, const memory_desc_t &md) {
+    if (e.has_default_values()) return true;
+    if (e.is_host_scalar()) return false;
+    return md.dims[2] % e.get_group(0) == 0
+            && md.dims[3] % e.get_group(1) == 0;
+}
+
+// Scales or zero points of K or V. The parameters are a dense tensor of the
+// dimensions in the mask, the last two of them divided by the group sizes.
+struct quant_param_t {
+    quant_param_t(const quant_entry_t &e, const memory_desc_t &md,
+            const void *ptr) {
+        if (e.has_default_values() || ptr == nullptr) return;
+        memory_desc_t q_md;
+        if (e.get_md(q_md, md) != status::success) return;
+        ptr_ = ptr;
+        dt_ = e.get_data_type();
+        for (int d = 0; d < 4; d++) {
+            strides_[d] = e.get_mask() & (1 << d)
+                    ? q_md.format_desc.blocking.strides[d]
+                    : 0;
+            groups_[d] = d < 2 ? 1 : e.get_group(d - 2);
+        }
+    }
+
+    // Returns the parameter of element `(i0, i1, i2, i3)` of the tensor or
+    // `def` if there are none.
+    float load(dim_t i0, dim_t i1, dim_t i2, dim_t i3, float def) const {
+        if (ptr_ == nullptr) return def;
+        const dim_t off = i0 * strides_[0] + i1 * strides_[1]
+                + i2 / groups_[2] * strides_[2] + i3 / groups_[3] * strides_[3];
+        return io::load_float_value(dt_, ptr_, off);
+    }
+
+private:
+    const void *ptr_ = nullptr;
+    data_type_t dt_ = data_type::undef;
+    dim_t strides_[4] = {};
+    dim_t groups_[4] = {1, 1, 1, 1};
+};
+
+void store_row(data_type_t dt, char *dst, const float *src, dim_t n) {
+    switch (dt) {
+        case f32: std::memcpy(dst, src, n * sizeof(float)); break;
+        case bf16:
+            cvt_float_to_bfloat16(reinterpret_cast<bfloat16_t *>(dst), src, n);
+            break;
+        case f16:
+            cvt_float_to_float16(reinterpret_cast<float16_t *>(dst), src, n);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
+status_t jit_brgemm_sdpa_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace alg_kind;
+
+    const memory_desc_wrapper qry_d(qry_md());
+    const memory_desc_wrapper key_d(key_md());
+    const memory_desc_wrapper val_d(val_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const data_type_t dt = qry_d.data_type();
+
+    VDISPATCH_SDPA(
+            everyone_is(4, qry_d.ndims(), key_d.ndims(), val_d.ndims(),
+                    dst_d.ndims()),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(one_of(dt, f32, bf16, f16) && dst_d.data_type() == dt,
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_SDPA(one_of(key_d.data_type(), dt, s8, u8, s4, u4)
+                    && one_of(val_d.data_type(), dt, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_SDPA(everyone_is(f32, kq_acc_dt(), vs_acc_dt()),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    // The quantization parameters apply to the quantized tensors only.
+    VDISPATCH_SDPA(IMPLICATION(with_key_scales() || with_key_zp(),
+                           key_quantized())
+                    && IMPLICATION(with_value_scales() || with_value_zp(),
+                            value_quantized()),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(quant_entry_ok(desc()->kq_scales, *key_md())
+                    && quant_entry_ok(desc()->kq_zero_points, *key_md())
+                    && quant_entry_ok(desc()->vs_scales, *val_md())
+                    && quant_entry_ok(desc()->vs_zero_points, *val_md()),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(one_of(desc()->softmax_alg, softmax_accurate,
+                           softmax_accurate_inf_as_zero),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_scale(),
+                           one_of(scale_md()->data_type, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    if (with_attn_mask()) {
+        const memory_desc_wrapper msk_d(attn_mask_md());
+        VDISPATCH_SDPA(msk_d.ndims() == 4 && msk_d.is_plain()
+                        && msk_d.blocking_desc().strides[3] == 1,
+                VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(one_of(msk_d.data_type(), f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT_CFG);
+    }
+    VDISPATCH_SDPA(!qry_d.has_zero_dim() && !key_d.has_zero_dim()
+                    && !val_d.has_zero_dim() && !dst_d.has_zero_dim(),
+            VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(!qry_d.has_runtime_dims_or_strides()
+                    && !key_d.has_runtime_dims_or_strides()
+                    && !val_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // Rows of Q, V and dst are accessed by brgemm and by the softmax
+    // directly, hence the innermost dimension has to be dense. K is repacked
+    // and can be stored either way.
+    VDISPATCH_SDPA(qry_d.is_plain() && key_d.is_plain() && val_d.is_plain()
+                    && dst_d.is_plain(),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(everyone_is(1, qry_d.blocking_desc().strides[3],
+                           val_d.blocking_desc().strides[3],
+                           dst_d.blocking_desc().strides[3]),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Grouped query attention: every group of `heads / kv_heads` query heads
+    // shares a single head of K and V.
+    VDISPATCH_SDPA(IMPLICATION(!with_paged_kv(),
+                           everyone_is(batch(), key_d.dims()[0],
+                                   val_d.dims()[0])),
+            VERBOSE_INCONSISTENT_DIM, "qry", 0, "key", 0);
+    VDISPATCH_SDPA(kv_heads() == val_d.dims()[1] && heads() % kv_heads() == 0,
+            VERBOSE_INCONSISTENT_DIM, "qry", 1, "key", 1);
+
+    switch (dt) {
+        case f32:
+            isa_ = mayiuse(avx512_core) ? avx512_core
+                    : mayiuse(avx2)     ? avx2
+                                        : isa_undef;
+            break;
+        case bf16:
+            isa_ = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : isa_undef;
+            break;
+        case f16:
+            isa_ = mayiuse(avx512_core_fp16) ? avx512_core_fp16 : isa_undef;
+            break;
+        default: isa_ = isa_undef;
+    }
+    VDISPATCH_SDPA(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    if (with_paged_kv()) {
+        const memory_desc_wrapper bt_d(block_table_md());
+        const memory_desc_wrapper sl_d(seq_lens_md());
+        VDISPATCH_SDPA(bt_d.is_plain() && sl_d.is_plain()
+                        && !bt_d.has_runtime_dims_or_strides()
+                        && !sl_d.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    // Empirical: the tile of scores, the tile of probabilities and the
+    // output accumulator of a thread fit L2 for the common head sizes.
+    q_blk_ = nstl::min(queries(), dim_t(32));
+    kv_blk_ = with_paged_kv() ? kv_page_size() : 64;
+
+    // The pages are consumed in place if the keys of a page are contiguous,
+    // which is the layout of the B matrix of the KQ brgemm.
+    direct_kv_ = with_paged_kv() && key_d.blocking_desc().strides[3] == 1
+            && !key_quantized() && !value_quantized();
+    CHECK(init_brgemm_descs());
+    if (direct_kv_ && vnni_granularity_ > 1) {
+        direct_kv_ = false;
+        CHECK(init_brgemm_descs());
+    }
+    VDISPATCH_SDPA(head_size() % vnni_granularity_ == 0,
+            VERBOSE_BAD_DIM, "qry", 3);
+    VDISPATCH_SDPA(kv_blk_ % vnni_granularity_ == 0, VERBOSE_BAD_PARAM,
+            "kv_page_size");
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t jit_brgemm_sdpa_fwd_t::pd_t::init_brgemm_descs() {
+    const memory_desc_wrapper qry_d(qry_md());
+    const data_type_t dt = qry_d.data_type();
+    const dim_t ldq = qry_d.blocking_desc().strides[2];
+    const dim_t D = head_size();
+    const dim_t Dv = values();
+    const dim_t ldk
+            = direct_kv_ ? key_md()->format_desc.blocking.strides[2] : kv_blk_;
+    const dim_t ldv
+            = direct_kv_ ? val_md()->format_desc.blocking.strides[2] : Dv;
+
+    for (int idx = 0; idx < max_num_q_kernels; idx++) {
+        if (idx == 1 && !has_q_tail()) continue;
+        const dim_t M = idx == 0 ? q_blk_ : queries() % q_blk_;
+
+        // S = Q * K: A is a block of query rows, B is a block of keys and C
+        // is the f32 tile of scores.
+        brgemm_desc_t &kq = kq_descs_[idx];
+        CHECK(brgemm_desc_init(&kq, isa_, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 0.f, ldq, ldk, kv_blk_, M, kv_blk_, D));
+        brgemm_attr_t kq_attr;
+        kq_attr.max_bs = 1;
+        kq_attr.hint_expected_A_size = M * D;
+        kq_attr.hint_expected_B_size = D * kv_blk_;
+        kq_attr.hint_expected_C_size = M * kv_blk_;
+        CHECK(brgemm_desc_set_attr(&kq, kq_attr));
+        CHECK(brgemm_desc_finalize(&kq));
+
+        // O += P * V: A is the tile of probabilities, B is a block of values
+        // and C is the f32 output accumulator.
+        brgemm_desc_t &vs = vs_descs_[idx];
+        CHECK(brgemm_desc_init(&vs, isa_, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 1.f, kv_blk_, ldv, Dv, M, Dv, kv_blk_));
+        brgemm_attr_t vs_attr;
+        vs_attr.max_bs = 1;
+        vs_attr.hint_expected_A_size = M * kv_blk_;
+        vs_attr.hint_expected_B_size = kv_blk_ * Dv;
+        vs_attr.hint_expected_C_size = M * Dv;
+        CHECK(brgemm_desc_set_attr(&vs, vs_attr));
+        CHECK(brgemm_desc_finalize(&vs));
+    }
+
+    vnni_granularity_ = kq_descs_[0].is_b_data_layout_vnni()
+            ? data_type_vnni_granularity(dt)
+            : 1;
+    return status::success;
+}
+
+void jit_brgemm_sdpa_fwd_t::pd_t::init_scratchpad() {
+    const size_t dt_size = types::data_type_size(qry_md()->data_type);
+    const size_t kv_size = static_cast<size_t>(batch()) * kv_heads()
+            * kv_nblks() * kv_blk_;
+
+    // Scores and probabilities of a tile, the output accumulator, the running
+    // maximum and the running sum. The pages read in place need a copy of
+    // the last page of values of a sequence, see `execute()`.
+    wsp_per_thr_ = wsp_align(sizeof(float) * q_blk_ * kv_blk_)
+            + wsp_align(dt_size * q_blk_ * kv_blk_)
+            + wsp_align(sizeof(float) * q_blk_ * values())
+            + 2 * wsp_align(sizeof(float) * q_blk_);
+    if (direct_kv_)
+        wsp_per_thr_ += wsp_align(dt_size * kv_blk_
+                * val_md()->format_desc.blocking.strides[2]);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!direct_kv_) {
+        scratchpad.template book<char>(
+                key_sdpa_k_packed, kv_size * head_size() * dt_size);
+        scratchpad.template book<char>(
+                key_sdpa_v_packed, kv_size * values() * dt_size);
+    }
+    scratchpad.template book<char>(
+            key_sdpa_wsp, wsp_per_thr_ * dnnl_get_max_threads());
+}
+
+status_t jit_brgemm_sdpa_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_q_kernels; idx++) {
+        if (idx == 1 && !pd()->has_q_tail()) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->kq_desc(idx)));
+        CHECK(safe_ptr_assign(kq_kernels_[idx], ker));
+        CHECK(brgemm_kernel_create(&ker, pd()->vs_desc(idx)));
+        CHECK(safe_ptr_assign(vs_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+dim_t jit_brgemm_sdpa_fwd_t::seq_keys(
+        const int32_t *seq_lens, dim_t b) const {
+    if (!pd()->with_paged_kv()) return pd()->keys();
+    const memory_desc_wrapper sl_d(pd()->seq_lens_md());
+    const dim_t len = seq_lens[sl_d.off(b)];
+    return nstl::max(dim_t(0), nstl::min(len, pd()->keys()));
+}
+
+void jit_brgemm_sdpa_fwd_t::kv_block_pos(const int32_t *block_table, dim_t b,
+        dim_t kb, dim_t &i0, dim_t &key0) const {
+    if (!pd()->with_paged_kv()) {
+        i0 = b;
+        key0 = kb * pd()->kv_blk();
+        return;
+    }
+    const memory_desc_wrapper bt_d(pd()->block_table_md());
+    i0 = block_table[bt_d.off(b, kb)];
+    key0 = 0;
+}
+
+dim_t jit_brgemm_sdpa_fwd_t::kv_block_off(const memory_desc_wrapper &mdw,
+        int k_dim, const int32_t *block_table, dim_t b, dim_t h,
+        dim_t kb) const {
+    const auto &strides = mdw.blocking_desc().strides;
+    dim_t i0 = 0, key0 = 0;
+    kv_block_pos(block_table, b, kb, i0, key0);
+    return mdw.offset0() + i0 * strides[0] + h * strides[1]
+            + key0 * strides[k_dim];
+}
+
+void jit_brgemm_sdpa_fwd_t::pack_keys(const char *key, char *key_packed,
+        const void *scales, const void *zero_points,
+        const int32_t *block_table, const int32_t *seq_lens) const {
+    const memory_desc_wrapper key_d(pd()->key_md());
+    const auto &strides = key_d.blocking_desc().strides;
+    const data_type_t dt = pd()->qry_md()->data_type;
+    const size_t dt_size = types::data_type_size(dt);
+    const dim_t D = pd()->head_size();
+    const dim_t kv_blk = pd()->kv_blk();
+    const dim_t nblks = pd()->kv_nblks();
+    const int vnni = pd()->vnni_granularity();
+    const bool quantized = pd()->key_quantized();
+    const quant_param_t k_scales(pd()->desc()->kq_scales, *key_d.md_, scales);
+    const quant_param_t k_zp(
+            pd()->desc()->kq_zero_points, *key_d.md_, zero_points);
+
+    // A block of keys is the `D x kv_blk` B matrix of the KQ brgemm. Only
+    // the blocks holding keys of the sequence are packed.
+    parallel_nd(pd()->batch(), pd()->kv_heads(), nblks,
+            [&](dim_t b, dim_t h, dim_t kb) {
+                const dim_t k0 = kb * kv_blk;
+                const dim_t Sk = seq_keys(seq_lens, b);
+                if (k0 >= Sk) return;
+                const dim_t src_off
+                        = kv_block_off(key_d, 3, block_table, b, h, kb);
+                char *dst = key_packed
+                        + (((b * pd()->kv_heads() + h) * nblks + kb) * D
+                                  * kv_blk)
+                                * dt_size;
+                const dim_t nkeys = nstl::min(kv_blk, Sk - k0);
+                if (quantized) {
+                    // Element `(d, j)` of the block is channel `d` of key
+                    // `key0 + j` of the tensor.
+                    dim_t i0 = 0, key0 = 0;
+                    kv_block_pos(block_table, b, kb, i0, key0);
+                    auto load = [&](dim_t d, dim_t j) {
+                        const float v = io::load_float_value(key_d.data_type(),
+                                key, src_off + d * strides[2] + j * strides[3]);
+                        return (v - k_zp.load(i0, h, d, key0 + j, 0.f))
+                                * k_scales.load(i0, h, d, key0 + j, 1.f);
+                    };
+                    pack_b_block_f(
+                            dt, dst, load, D, nkeys, kv_blk, D, kv_blk, vnni);
+                } else if (dt_size == sizeof(float)) {
+                    pack_b_block(reinterpret_cast<uint32_t *>(dst),
+                            key + src_off * dt_size, strides[2], strides[3], D,
+                            nkeys, kv_blk, D, kv_blk, vnni);
+                } else {
+                    pack_b_block(reinterpret_cast<uint16_t *>(dst),
+                            key + src_off * dt_size, strides[2], strides[3], D,
+                            nkeys, kv_blk, D, kv_blk, vnni);
+                }
+            });
+}
+
+void jit_brgemm_sdpa_fwd_t::pack_values(const char *val, char *val_packed,
+        const void *scales, const void *zero_points,
+        const int32_t *block_table, const int32_t *seq_lens) const {
+    const memory_desc_wrapper val_d(pd()->val_md());
+    const auto &strides = val_d.blocking_desc().strides;
+    const data_type_t dt = pd()->qry_md()->data_type;
+    const size_t dt_size = types::data_type_size(dt);
+    const dim_t Dv = pd()->values();
+    const dim_t kv_blk = pd()->kv_blk();
+    const dim_t nblks = pd()->kv_nblks();
+    const int vnni = pd()->vnni_granularity();
+    const bool quantized = pd()->value_quantized();
+    const quant_param_t v_scales(pd()->desc()->vs_scales, *val_d.md_, scales);
+    const quant_param_t v_zp(
+            pd()->desc()->vs_zero_points, *val_d.md_, zero_points);
+
+    // A block of values is the `kv_blk x Dv` B matrix of the VS brgemm. The
+    // rows past the last key are zeroed: their probabilities are zero, but
+    // garbage could still turn the products into NaNs.
+    parallel_nd(pd()->batch(), pd()->kv_heads(), nblks,
+            [&](dim_t b, dim_t h, dim_t kb) {
+                const dim_t k0 = kb * kv_blk;
+                const dim_t Sk = seq_keys(seq_lens, b);
+                if (k0 >= Sk) return;
+                const dim_t src_off
+                        = kv_block_off(val_d, 2, block_table, b, h, kb);
+                char *dst = val_packed
+                        + (((b * pd()->kv_heads() + h) * nblks + kb) * kv_blk
+                                  * Dv)
+                                * dt_size;
+                const dim_t nkeys = nstl::min(kv_blk, Sk - k0);
+                if (quantized) {
+                    // Element `(j, v)` of the block is channel `v` of key
+                    // `key0 + j` of the tensor.
+                    dim_t i0 = 0, key0 = 0;
+                    kv_block_pos(block_table, b, kb, i0, key0);
+                    auto load = [&](dim_t j, dim_t v) {
+                        const float x = io::load_float_value(val_d.data_type(),
+                                val, src_off + j * strides[2] + v * strides[3]);
+                        return (x - v_zp.load(i0, h, key0 + j, v, 0.f))
+                                * v_scales.load(i0, h, key0 + j, v, 1.f);
+                    };
+                    pack_b_block_f(
+                            dt, dst, load, nkeys, Dv, Dv, kv_blk, Dv, vnni);
+                } else if (dt_size == sizeof(float)) {
+                    pack_b_block(reinterpret_cast<uint32_t *>(dst),
+                            val + src_off * dt_size, strides[2], strides[3],
+                            nkeys, Dv, Dv, kv_blk, Dv, vnni);
+                } else {
+                    pack_b_block(reinterpret_cast<uint16_t *>(dst),
+                            val + src_off * dt_size, strides[2], strides[3],
+                            nkeys, Dv, Dv, kv_blk, Dv, vnni);
+                }
+            });
+}
+
+status_t jit_brgemm_sdpa_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *qry = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const auto *key = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const auto *val = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    // The graph API passes empty memory objects for the optional arguments
+    // the primitive does not use, so those are not queried.
+    const auto *msk = pd()->with_attn_mask()
+            ? CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK)
+            : nullptr;
+    const auto *scale_ptr = pd()->with_attn_scale()
+            ? CTX_IN_MEM(const void *, DNNL_ARG_SCALE)
+            : nullptr;
+    const auto *block_table = pd()->with_paged_kv()
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_BLOCK_TABLE)
+            : nullptr;
+    const auto *seq_lens = pd()->with_paged_kv()
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENS)
+            : nullptr;
+    const auto *k_scales = pd()->with_key_scales()
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS)
+            : nullptr;
+    const auto *k_zp = pd()->with_key_zp()
+            ? CTX_IN_MEM(
+                    const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS)
+            : nullptr;
+    const auto *v_scales = pd()->with_value_scales()
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES)
+            : nullptr;
+    const auto *v_zp = pd()->with_value_zp()
+            ? CTX_IN_MEM(
+                    const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES)
+            : nullptr;
+
+    const memory_desc_wrapper qry_d(pd()->qry_md());
+    const memory_desc_wrapper key_d(pd()->key_md());
+    const memory_desc_wrapper val_d(pd()->val_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const data_type_t dt = qry_d.data_type();
+    const size_t dt_size = qry_d.data_type_size();
+
+    const dim_t B = pd()->batch();
+    const dim_t H = pd()->heads();
+    const dim_t Hkv = pd()->kv_heads();
+    const dim_t Sq = pd()->queries();
+    const dim_t D = pd()->head_size();
+    const dim_t Dv = pd()->values();
+    const dim_t q_blk = pd()->q_blk();
+    const dim_t kv_blk = pd()->kv_blk();
+    const dim_t kv_nblks = pd()->kv_nblks();
+    const dim_t q_nblks = div_up(Sq, q_blk);
+    const dim_t group_size = H / Hkv;
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(pd()->scale_md()->data_type, scale_ptr, 0);
+        if (pd()->desc()->invert_scale) scale = 1.f / scale;
+    }
+
+    // Key `k` is visible from query `q` when `k <= q + causal_shift`.
+    const bool with_causal = pd()->with_causal_mask();
+    const bool bottom_right
+            = pd()->desc()->mask_type == attn_mask_type::bottom_right;
+    const bool inf_as_zero = pd()->desc()->softmax_alg
+            == alg_kind::softmax_accurate_inf_as_zero;
+    constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *key_packed = scratchpad.template get<char>(key_sdpa_k_packed);
+    char *val_packed = scratchpad.template get<char>(key_sdpa_v_packed);
+    char *wsp_base = scratchpad.template get<char>(key_sdpa_wsp);
+
+    const bool direct_kv = pd()->direct_kv();
+    if (!direct_kv) {
+        pack_keys(key, key_packed, k_scales, k_zp, block_table, seq_lens);
+        pack_values(val, val_packed, v_scales, v_zp, block_table, seq_lens);
+    }
+
+    const auto &q_strides = qry_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(B * H * q_nblks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *wsp = wsp_base + ithr * pd()->wsp_per_thr();
+        float *s_tile = reinterpret_cast<float *>(wsp);
+        wsp += wsp_align(sizeof(float) * q_blk * kv_blk);
+        char *p_tile = wsp;
+        wsp += wsp_align(dt_size * q_blk * kv_blk);
+        float *o_acc = reinterpret_cast<float *>(wsp);
+        wsp += wsp_align(sizeof(float) * q_blk * Dv);
+        float *row_max = reinterpret_cast<float *>(wsp);
+        wsp += wsp_align(sizeof(float) * q_blk);
+        float *row_sum = reinterpret_cast<float *>(wsp);
+        wsp += wsp_align(sizeof(float) * q_blk);
+        char *v_tail = wsp;
+
+        brgemm_batch_element_t batch;
+        batch.vvpad.top = 0;
+        batch.vvpad.bottom = 0;
+
+        dim_t b = 0, h = 0, qb = 0;
+        nd_iterator_init(start, b, B, h, H, qb, q_nblks);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t q0 = qb * q_blk;
+            const dim_t M = nstl::min(q_blk, Sq - q0);
+            const int ker_idx = M == q_blk ? 0 : 1;
+            const dim_t h_kv = h / group_size;
+            const char *q_ptr = qry
+                    + (qry_d.offset0() + b * q_strides[0] + h * q_strides[1]
+                              + q0 * q_strides[2])
+                            * dt_size;
+            const dim_t kv_off = (b * Hkv + h_kv) * kv_nblks;
+            const dim_t Sk = seq_keys(seq_lens, b);
+            const dim_t causal_shift = bottom_right ? Sk - Sq : 0;
+
+            for (dim_t i = 0; i < M; i++) {
+                row_max[i] = neg_inf;
+                row_sum[i] = 0.f;
+            }
+            std::memset(o_acc, 0, sizeof(float) * M * Dv);
+
+            for (dim_t kb = 0; kb < div_up(Sk, kv_blk); kb++) {
+                const dim_t k0 = kb * kv_blk;
+                // All the keys of the block are in the future of every query
+                // of the tile, so are all the subsequent blocks.
+                if (with_causal && k0 > q0 + M - 1 + causal_shift) break;
+
+                const dim_t nkeys = nstl::min(kv_blk, Sk - k0);
+                batch.ptr.A = q_ptr;
+                batch.ptr.B = direct_kv
+                        ? key
+                                + kv_block_off(key_d, 3, block_table, b, h_kv,
+                                          kb)
+                                        * dt_size
+                        : key_packed + (kv_off + kb) * D * kv_blk * dt_size;
+                brgemm_kernel_execute(
+                        kq_kernels_[ker_idx].get(), 1, &batch, s_tile);
+
+                for (dim_t i = 0; i < M; i++) {
+                    const dim_t q = q0 + i;
+                    float *s = s_tile + i * kv_blk;
+                    const dim_t nvisible = with_causal
+                            ? nstl::max(dim_t(0),
+                                    nstl::min(nkeys, q + causal_shift + 1 - k0))
+                            : nkeys;
+
+                    float blk_max = neg_inf;
+                    if (pd()->with_attn_mask()) {
+                        const auto &ms = msk_d.blocking_desc().strides;
+                        const auto &mdims = msk_d.dims();
+                        const dim_t m_off = msk_d.offset0()
+                                + (mdims[0] == 1 ? 0 : b) * ms[0]
+                                + (mdims[1] == 1 ? 0 : h) * ms[1]
+                                + (mdims[2] == 1 ? 0 : q) * ms[2] + k0;
+                        for (dim_t j = 0; j < nvisible; j++) {
+                            s[j] = s[j] * scale
+                                    + io::load_float_value(
+                                            msk_d.data_type(), msk, m_off + j);
+                            blk_max = nstl::max(blk_max, s[j]);
+                        }
+                    } else {
+                        for (dim_t j = 0; j < nvisible; j++) {
+                            s[j] *= scale;
+                            blk_max = nstl::max(blk_max, s[j]);
+                        }
+                    }
+
+                    const float new_max = nstl::max(row_max[i], blk_max);
+                    char *p_row = p_tile + i * kv_blk * dt_size;
+                    if (new_max == neg_inf) {
+                        // Nothing is visible so far, the row stays empty.
+                        for (dim_t j = 0; j < kv_blk; j++)
+                            s[j] = 0.f;
+                        store_row(dt, p_row, s, kv_blk);
+                        continue;
+                    }
+                    float sum = 0.f;
+                    for (dim_t j = 0; j < kv_blk; j++) {
+                        s[j] = j < nvisible ? ::expf(s[j] - new_max) : 0.f;
+                        sum += s[j];
+                    }
+                    store_row(dt, p_row, s, kv_blk);
+
+                    // Rescale the previous partial results to the new
+                    // maximum.
+                    const float corr = ::expf(row_max[i] - new_max);
+                    if (corr != 1.f) {
+                        float *o = o_acc + i * Dv;
+                        for (dim_t v = 0; v < Dv; v++)
+                            o[v] *= corr;
+                    }
+                    row_sum[i] = row_sum[i] * corr + sum;
+                    row_max[i] = new_max;
+                }
+
+                batch.ptr.A = p_tile;
+                if (direct_kv) {
+                    const char *v_page = val
+                            + kv_block_off(val_d, 2, block_table, b, h_kv, kb)
+                                    * dt_size;
+                    batch.ptr.B = v_page;
+                    if (nkeys < kv_blk) {
+                        // The tail of the last page may be uninitialized,
+                        // use a copy with the rows past the last key zeroed.
+                        const dim_t ldv = val_d.blocking_desc().strides[2];
+                        for (dim_t r = 0; r < kv_blk; r++) {
+                            char *row = v_tail + r * ldv * dt_size;
+                            if (r < nkeys)
+                                std::memcpy(row, v_page + r * ldv * dt_size,
+                                        Dv * dt_size);
+                            else
+                                std::memset(row, 0, Dv * dt_size);
+                        }
+                        batch.ptr.B = v_tail;
+                    }
+                } else {
+                    batch.ptr.B = val_packed
+                            + (kv_off + kb) * kv_blk * Dv * dt_size;
+                }
+                brgemm_kernel_execute(
+                        vs_kernels_[ker_idx].get(), 1, &batch, o_acc);
+            }
+
+            for (dim_t i = 0; i < M; i++) {
+                const dim_t d_off = dst_d.offset0() + b * dst_strides[0]
+                        + h * dst_strides[1] + (q0 + i) * dst_strides[2];
+                float *o = o_acc + i * Dv;
+                // A row with every key masked out has no defined softmax.
+                if (row_sum[i] == 0.f) {
+                    for (dim_t v = 0; v < Dv; v++)
+                        o[v] = inf_as_zero ? 0.f : NAN;
+                } else {
+                    const float r_sum = 1.f / row_sum[i];
+                    for (dim_t v = 0; v < Dv; v++)
+                        o[v] *= r_sum;
+                }
+                store_row(dt, dst + d_off * dt_size, o, Dv);
+            }
+
+            nd_iterator_step(b, B, h, H, qb, q_nblks);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
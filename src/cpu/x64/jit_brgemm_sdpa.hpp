@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Flash-attention style SDPA. Every thread owns a tile of `q_blk` queries of
+// a single head and walks over the keys by blocks of `kv_blk`:
+//   S = Q * K_blk            (brgemm, f32 accumulation)
+//   P = exp(S - max), with the running maximum and the running sum of every
+//       row updated online
+//   O = O * correction + P * V_blk   (brgemm, beta = 1)
+// The scores never leave the per-thread `q_blk x kv_blk` buffer. K and V are
+// repacked once per execution into the layout brgemm expects for the B
+// matrix, padded to a multiple of `kv_blk` keys.
+//
+// With a paged KV cache a block of keys is a page. When brgemm can read the
+// pages as they are (keys are the innermost dimension of K and no VNNI
+// packing is needed), the kernels are called on the pages of the pool
+// directly and nothing is repacked. Otherwise only the pages referenced by
+// the block table are packed.
+//
+// Quantized K and V (s8, u8, s4 or u4 with optional scales and zero points)
+// are dequantized to the data type of Q while they are packed, so the brgemm
+// kernels see the same B matrices as in the floating-point case and the
+// cache is read once per execution.
+struct jit_brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public sdpa_pd_t {
+        using sdpa_pd_t::sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa_, ""),
+                jit_brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: 0 - full query block, 1 - query block tail.
+        static constexpr int max_num_q_kernels = 2;
+
+        const brgemm_desc_t &kq_desc(int idx) const { return kq_descs_[idx]; }
+        const brgemm_desc_t &vs_desc(int idx) const { return vs_descs_[idx]; }
+        bool has_q_tail() const { return queries() % q_blk_ > 0; }
+        // If true, brgemm reads the pages of the paged KV cache in place.
+        bool direct_kv() const { return direct_kv_; }
+        bool key_quantized() const {
+            return key_md()->data_type != qry_md()->data_type;
+        }
+        bool value_quantized() const {
+            return val_md()->data_type != qry_md()->data_type;
+        }
+
+        dim_t q_blk() const { return q_blk_; }
+        dim_t kv_blk() const { return kv_blk_; }
+        dim_t kv_nblks() const { return utils::div_up(keys(), kv_blk_); }
+        // Number of rows packed together in the B layout of brgemm.
+        int vnni_granularity() const { return vnni_granularity_; }
+        // Size of the per-thread workspace in bytes.
+        size_t wsp_per_thr() const { return wsp_per_thr_; }
+
+        dim_t batch() const { return qry_md()->dims[0]; }
+        dim_t heads() const { return qry_md()->dims[1]; }
+        dim_t kv_heads() const { return key_md()->dims[1]; }
+        dim_t queries() const { return desc()->queries(); }
+        dim_t keys() const { return desc()->keys(); }
+        dim_t head_size() const { return desc()->head_size(); }
+        dim_t values() const { return desc()->values(); }
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t q_blk_ = 0;
+        dim_t kv_blk_ = 0;
+        int vnni_granularity_ = 1;
+        bool direct_kv_ = false;
+        size_t wsp_per_thr_ = 0;
+        brgemm_desc_t kq_descs_[max_num_q_kernels];
+        brgemm_desc_t vs_descs_[max_num_q_kernels];
+    };
+
+    jit_brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Returns the number of keys of sequence `b`.
+    dim_t seq_keys(const int32_t *seq_lens, dim_t b) const;
+    // Returns the index along the first dimension of K and V of block `kb`
+    // of sequence `b` and the index of its first key in the keys dimension.
+    void kv_block_pos(const int32_t *block_table, dim_t b, dim_t kb,
+            dim_t &i0, dim_t &key0) const;
+    // Returns the offset of the first element of block `kb` of the keys or
+    // the values of sequence `b` and head `h`, in elements. `k_dim` is the
+    // dimension of the keys in `mdw`.
+    dim_t kv_block_off(const memory_desc_wrapper &mdw, int k_dim,
+            const int32_t *block_table, dim_t b, dim_t h, dim_t kb) const;
+
+    // `scales` and `zero_points` are used with quantized K and V only.
+    void pack_keys(const char *key, char *key_packed, const void *scales,
+            const void *zero_points, const int32_t *block_table,
+            const int32_t *seq_lens) const;
+    void pack_values(const char *val, char *val_packed, const void *scales,
+            const void *zero_points, const int32_t *block_table,
+            const int32_t *seq_lens) const;
+
+    std::unique_ptr<brgemm_kernel_t> kq_kernels_[pd_t::max_num_q_kernels];
+    std::unique_ptr<brgemm_kernel_t> vs_kernels_[pd_t::max_num_q_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_subpixel_deconv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_subpixel_deconvolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_DECONVOLUTION(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_DECONVOLUTION(
+            desc()->alg_kind == alg_kind::deconvolution_direct,
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_DECONVOLUTION(expect_data_types(f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_DECONVOLUTION(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_DECONVOLUTION(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_DECONVOLUTION(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_DECONVOLUTION(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_DECONVOLUTION(ndims() == 4 && !with_groups(),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D deconvolutions without groups are supported");
+    // Unit strides have no zeros to skip.
+    VDISPATCH_DECONVOLUTION(KSH() > 1 || KSW() > 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only strided deconvolutions are supported");
+    VDISPATCH_DECONVOLUTION(KSH() <= max_stride && KSW() <= max_stride,
+            VERBOSE_UNSUPPORTED_FEATURE, "strides are too large");
+    VDISPATCH_DECONVOLUTION(desc()->dilates[0] == 0 && desc()->dilates[1] == 0,
+            VERBOSE_UNSUPPORTED_FEATURE, "dilations are not supported");
+    // With a kernel not smaller than the stride and no negative padding
+    // every destination point has at least one kernel point inside the
+    // source, so the batch is never empty.
+    VDISPATCH_DECONVOLUTION(KH() >= KSH() && KW() >= KSW(),
+            VERBOSE_UNSUPPORTED_FEATURE, "kernel is smaller than stride");
+    VDISPATCH_DECONVOLUTION(everyone_is(true, padT() >= 0, padB() >= 0,
+                                    padL() >= 0, padR() >= 0),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "negative padding");
+
+    // The brgemm B matrix for a kernel point is the `ic x oc` weights matrix.
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, nhwc));
+    if (weights_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(weights_md_, hwio));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, nhwc));
+    if (bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, x));
+    VDISPATCH_DECONVOLUTION(memory_desc_wrapper(src_md()).matches_tag(nhwc)
+                    && memory_desc_wrapper(weights_md(0)).matches_tag(hwio)
+                    && memory_desc_wrapper(dst_md()).matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    oc_blk_ = nstl::min(dim_t(64), rnd_up(OC(), 16));
+
+    const dim_t SW = KSW();
+    for (dim_t p = 0; p < SW; p++) {
+        phase_t &ph = phases_[p];
+        ph.ow_first = ((p - padL()) % SW + SW) % SW;
+        if (ph.ow_first >= OW()) continue;
+        ph.npoints = div_up(OW() - ph.ow_first, SW);
+        ph.iw_first = (ph.ow_first + padL() - p) / SW;
+        const dim_t njw = div_up(KW() - p, SW);
+        ph.mid_start = saturate(dim_t(0), ph.npoints, njw - 1 - ph.iw_first);
+        ph.mid_end
+                = saturate(ph.mid_start, ph.npoints, IW() - ph.iw_first);
+    }
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_subpixel_deconvolution_fwd_t::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise(/* require_scale_one = */ true))
+            return false;
+    return true;
+}
+
+bool brgemm_subpixel_deconvolution_fwd_t::pd_t::has_kernel(int idx) const {
+    if ((idx & 1) && OC() % oc_blk_ == 0) return false;
+    if (!(idx & 1) && OC() < oc_blk_) return false;
+    const dim_t p = idx / 2;
+    if (p < max_stride)
+        return p < KSW() && phases_[p].mid_end > phases_[p].mid_start;
+    for (dim_t q = 0; q < KSW(); q++) {
+        const phase_t &ph = phases_[q];
+        if (ph.npoints > ph.mid_end - ph.mid_start) return true;
+    }
+    return false;
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::pd_t::init_brgemm_descs() {
+    const dim_t IC = this->IC();
+    const dim_t OC = this->OC();
+    // Consecutive rows of the C matrix are the points of the same phase.
+    const dim_t LDC = KSW() * OC;
+    const int max_bs
+            = static_cast<int>(div_up(KH(), KSH()) * div_up(KW(), KSW()));
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t p = idx / 2;
+        const dim_t M = p < max_stride
+                ? phases_[p].mid_end - phases_[p].mid_start
+                : 1;
+        const dim_t N = (idx & 1) ? OC % oc_blk_ : oc_blk_;
+
+        brgemm_desc_t &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, IC, OC, LDC, M, N, IC));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = max_bs;
+        brg_attr.hint_expected_A_size = M * IC;
+        brg_attr.hint_expected_B_size = IC * N;
+        brg_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_set_postops(&brg, attr(), dst_md(), LDC,
+                with_bias() ? f32 : data_type::undef));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_subpixel_deconvolution_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<brgemm_batch_element_t>(key_brgemm_primitive_batch,
+            static_cast<size_t>(dnnl_get_max_threads()) * div_up(KH(), KSH())
+                    * div_up(KW(), KSW()));
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t brgemm_subpixel_deconvolution_fwd_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t MB = pd()->MB();
+    const dim_t OC = pd()->OC();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OH = pd()->OH();
+    const dim_t KH = pd()->KH();
+    const dim_t KW = pd()->KW();
+    const dim_t SH = pd()->KSH();
+    const dim_t SW = pd()->KSW();
+    const dim_t padT = pd()->padT();
+    const dim_t oc_blk = pd()->oc_blk();
+    const dim_t oc_nblks = pd()->oc_nblks();
+    const bool need_postwork
+            = pd()->with_bias() || pd()->attr()->post_ops_.len() > 0;
+    const dim_t max_bs = div_up(KH, SH) * div_up(KW, SW);
+
+    auto *batch_base = ctx.get_scratchpad_grantor()
+                               .template get<brgemm_batch_element_t>(
+                                       key_brgemm_primitive_batch);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * OH * SW * oc_nblks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * max_bs;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t ocb = iwork % oc_nblks;
+            const dim_t p = (iwork / oc_nblks) % SW;
+            const dim_t oh = (iwork / oc_nblks / SW) % OH;
+            const dim_t n = iwork / oc_nblks / SW / OH;
+            const auto &ph = pd()->phase(p);
+            if (ph.npoints == 0) continue;
+
+            const dim_t oc = ocb * oc_blk;
+            const bool oc_tail = OC - oc < oc_blk;
+
+            // Source rows `ih = q - j` contribute to the row `oh` through the
+            // kernel rows `kh = p_h + j * SH`.
+            const dim_t p_h = (oh + padT) % SH;
+            const dim_t q = (oh + padT) / SH;
+            const dim_t j_start = nstl::max(dim_t(0), q - IH + 1);
+            const dim_t j_end = nstl::min(div_up(KH - p_h, SH), q + 1);
+            const dim_t njw = div_up(KW - p, SW);
+
+            // Computes the points of the phase starting from the point `t`:
+            // a single point at the border or all the points with all the
+            // kernel points inside the source.
+            auto compute = [&](dim_t t, bool border) {
+                const dim_t iw = ph.iw_first + t;
+                const dim_t jw_start
+                        = border ? nstl::max(dim_t(0), iw - IW + 1) : 0;
+                const dim_t jw_end = border ? nstl::min(njw, iw + 1) : njw;
+                int bs = 0;
+                for_(dim_t j = j_start; j < j_end; j++)
+                for (dim_t jw = jw_start; jw < jw_end; jw++) {
+                    const dim_t kh = p_h + j * SH;
+                    const dim_t kw = p + jw * SW;
+                    batch[bs].ptr.A
+                            = src + src_d.blk_off(n, 0, q - j, iw - jw);
+                    batch[bs].ptr.B = wei + wei_d.blk_off(oc, 0, kh, kw);
+                    batch[bs].vvpad.top = 0;
+                    batch[bs].vvpad.bottom = 0;
+                    bs++;
+                }
+
+                const auto *ker
+                        = kernels_[pd_t::ker_idx(p, border, oc_tail)].get();
+                float *C = dst
+                        + dst_d.blk_off(n, oc, oh, ph.ow_first + t * SW);
+                if (need_postwork) {
+                    brgemm_post_ops_data_t post_ops_data;
+                    post_ops_data.bias = bias ? bias + oc : nullptr;
+                    post_ops_data.oc_logical_off = oc;
+                    post_ops_data.data_C_ptr_ = reinterpret_cast<char *>(dst);
+                    brgemm_kernel_execute_postops(
+                            ker, bs, batch, C, C, post_ops_data, nullptr);
+                } else {
+                    brgemm_kernel_execute(ker, bs, batch, C);
+                }
+            };
+
+            for (dim_t t = 0; t < ph.mid_start; t++)
+                compute(t, true);
+            if (ph.mid_end > ph.mid_start) compute(ph.mid_start, false);
+            for (dim_t t = ph.mid_end; t < ph.npoints; t++)
+                compute(t, true);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
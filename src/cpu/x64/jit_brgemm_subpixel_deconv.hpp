@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SUBPIXEL_DECONV_HPP
+#define CPU_X64_JIT_BRGEMM_SUBPIXEL_DECONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Strided deconvolution computed as a set of stride-1 convolutions, one per
+// phase of the destination. For the destination points with
+// `(ow + padL) % SW == p` only the kernel points `kw = p + jw * SW` have
+// non-zero contributions, and consecutive points of the phase read
+// consecutive source points:
+//   dst[r * SW + p - padL] = sum_{jw} src[r - jw] * wei[p + jw * SW]
+// The same holds for the height. A single brgemm call computes the points of
+// a row of the destination that belong to one phase, the batch runs over the
+// kernel points of the phase. Nothing is computed for the zeros that a
+// strided deconvolution inserts between the source points.
+struct brgemm_subpixel_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        using cpu_deconvolution_fwd_pd_t::cpu_deconvolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_subpixel:", isa_, ""),
+                brgemm_subpixel_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        static constexpr dim_t max_stride = 4;
+
+        // Kernel index: a kernel per width phase for the points with all the
+        // kernel points inside the source, and a kernel for a single point at
+        // the border. Bit 0 is OC block tail.
+        static constexpr int max_num_kernels = 2 * (max_stride + 1);
+        static int ker_idx(dim_t p, bool border, bool oc_tail) {
+            return 2 * static_cast<int>(border ? max_stride : p)
+                    + (oc_tail ? 1 : 0);
+        }
+        bool has_kernel(int idx) const;
+        const brgemm_desc_t &brg_desc(int idx) const { return brgs_[idx]; }
+
+        dim_t oc_blk() const { return oc_blk_; }
+        dim_t oc_nblks() const { return utils::div_up(OC(), oc_blk_); }
+
+        // Geometry of a width phase `p`: the first destination point, the
+        // source point it starts from, the number of points, and the range
+        // of points for which all the kernel points are inside the source.
+        struct phase_t {
+            dim_t ow_first = 0;
+            dim_t iw_first = 0;
+            dim_t npoints = 0;
+            dim_t mid_start = 0;
+            dim_t mid_end = 0;
+        };
+        const phase_t &phase(dim_t p) const { return phases_[p]; }
+
+    private:
+        bool post_ops_ok() const;
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t oc_blk_ = 0;
+        phase_t phases_[max_stride];
+        brgemm_desc_t brgs_[max_num_kernels];
+    };
+
+    brgemm_subpixel_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,451 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace brgemm_wino;
+
+namespace {
+
+// The transforms are applied to `n` channels at once: `in` and `out` point
+// to the first channel of the first point, `is` and `os` are the distances
+// between the points.
+
+// out = B^T * in, 6 points to 6 points.
+void transform_bt(const float *in, dim_t is, float *out, dim_t os, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float d0 = in[0 * is + c], d1 = in[1 * is + c],
+                    d2 = in[2 * is + c], d3 = in[3 * is + c],
+                    d4 = in[4 * is + c], d5 = in[5 * is + c];
+        out[0 * os + c] = 4.f * d0 - 5.f * d2 + d4;
+        out[1 * os + c] = -4.f * (d1 + d2) + d3 + d4;
+        out[2 * os + c] = 4.f * (d1 - d2) - d3 + d4;
+        out[3 * os + c] = 2.f * (d3 - d1) - d2 + d4;
+        out[4 * os + c] = 2.f * (d1 - d3) - d2 + d4;
+        out[5 * os + c] = 4.f * d1 - 5.f * d3 + d5;
+    }
+}
+
+// out = G * in, 3 points to 6 points.
+void transform_g(const float *in, dim_t is, float *out, dim_t os, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float g0 = in[0 * is + c], g1 = in[1 * is + c],
+                    g2 = in[2 * is + c];
+        out[0 * os + c] = g0 / 4.f;
+        out[1 * os + c] = -(g0 + g1 + g2) / 6.f;
+        out[2 * os + c] = -(g0 - g1 + g2) / 6.f;
+        out[3 * os + c] = g0 / 24.f + g1 / 12.f + g2 / 6.f;
+        out[4 * os + c] = g0 / 24.f - g1 / 12.f + g2 / 6.f;
+        out[5 * os + c] = g2;
+    }
+}
+
+// out = A^T * in, 6 points to 4 points.
+void transform_at(const float *in, dim_t is, float *out, dim_t os, dim_t n) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t c = 0; c < n; c++) {
+        const float m0 = in[0 * is + c], m1 = in[1 * is + c],
+                    m2 = in[2 * is + c], m3 = in[3 * is + c],
+                    m4 = in[4 * is + c], m5 = in[5 * is + c];
+        out[0 * os + c] = m0 + m1 + m2 + m3 + m4;
+        out[1 * os + c] = m1 - m2 + 2.f * (m3 - m4);
+        out[2 * os + c] = m1 + m2 + 4.f * (m3 + m4);
+        out[3 * os + c] = m1 - m2 + 8.f * (m3 - m4) + m5;
+    }
+}
+
+// Channels are transformed by chunks that fit the stack buffers.
+constexpr dim_t max_oc_blk = 64;
+constexpr dim_t ic_chunk = 64;
+
+} // namespace
+
+namespace brgemm_wino {
+
+void init_wei_md(memory_desc_t &md, dim_t oc_block) {
+    assert(md.ndims == 4 && oc_block <= max_oc_blk);
+    const dim_t oc = md.dims[0];
+    const dim_t ic = md.dims[1];
+
+    md.format_kind = format_kind::wino;
+    wino_desc_t &wd = md.format_desc.wino_desc;
+    wd = zero<wino_desc_t>();
+    wd.wino_format = wino_memory_format_t::wino_wei_aaOio;
+    wd.r = kernel_size;
+    wd.alpha = alpha;
+    wd.ic = ic;
+    wd.oc = oc;
+    wd.ic_block = ic;
+    wd.oc_block = oc_block;
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.adj_scale = 1.f;
+    wd.size = sizeof(float) * alpha * alpha * ic * rnd_up(oc, oc_block);
+}
+
+bool is_wei_md(const memory_desc_t &md) {
+    if (md.format_kind != format_kind::wino) return false;
+    const wino_desc_t &wd = md.format_desc.wino_desc;
+    return wd.wino_format == wino_memory_format_t::wino_wei_aaOio
+            && wd.r == kernel_size && wd.alpha == alpha
+            && wd.oc_block <= max_oc_blk;
+}
+
+void transform_weights(const memory_desc_wrapper &wei_d, const float *wei,
+        float *U, dim_t oc_block) {
+    const dim_t OC = wei_d.dims()[0];
+    const dim_t IC = wei_d.dims()[1];
+    const dim_t oc_nblks = div_up(OC, oc_block);
+    const dim_t C = oc_block;
+
+    parallel_nd(oc_nblks, IC, [&](dim_t ocb, dim_t ic) {
+        float g[kernel_size * kernel_size * max_oc_blk];
+        float tmp[alpha * kernel_size * max_oc_blk];
+
+        for_(dim_t kh = 0; kh < kernel_size; kh++)
+        for_(dim_t kw = 0; kw < kernel_size; kw++)
+        for (dim_t c = 0; c < C; c++) {
+            const dim_t oc = ocb * oc_block + c;
+            g[(kh * kernel_size + kw) * C + c]
+                    = oc < OC ? wei[wei_d.off(oc, ic, kh, kw)] : 0.f;
+        }
+
+        // tmp[i][kw] = sum_kh(G[i][kh] * g[kh][kw])
+        for (dim_t kw = 0; kw < kernel_size; kw++)
+            transform_g(g + kw * C, kernel_size * C, tmp + kw * C,
+                    kernel_size * C, C);
+        // U[i][j] = sum_kw(tmp[i][kw] * G[j][kw])
+        for (dim_t i = 0; i < alpha; i++)
+            transform_g(tmp + i * kernel_size * C, C,
+                    U + ((i * alpha * oc_nblks + ocb) * IC + ic) * C,
+                    oc_nblks * IC * C, C);
+    });
+}
+
+} // namespace brgemm_wino
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(one_of(desc()->alg_kind, alg_kind::convolution_winograd,
+                           alg_kind::convolution_auto),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(expect_data_types(f32, f32, f32, f32, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    isa_ = mayiuse(avx512_core) ? avx512_core : isa_undef;
+    VDISPATCH_CONV(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(ndims() == 4 && !with_groups(), VERBOSE_UNSUPPORTED_FEATURE,
+            "only 2D convolutions without groups are supported");
+    VDISPATCH_CONV(KH() == kernel_size && KW() == kernel_size,
+            VERBOSE_UNSUPPORTED_FEATURE, "only 3x3 kernels are supported");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1 && KDH() == 0 && KDW() == 0,
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "only unit strides and no dilations are supported");
+    VDISPATCH_CONV(everyone_is(true, 0 <= padT(), padT() <= 1, 0 <= padB(),
+                           padB() <= 1, 0 <= padL(), padL() <= 1, 0 <= padR(),
+                           padR() <= 1),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "padding larger than 1");
+    if (desc()->alg_kind == alg_kind::convolution_auto)
+        VDISPATCH_CONV(is_auto_profitable(), VERBOSE_IMPL_HEURISTIC_FAIL,
+                "winograd is not expected to be faster than direct");
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, format_tag::undef, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.matches_tag(nhwc) && dst_d.matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(!src_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(weights_md(0))
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // Four vector registers of f32 per row of the brgemm B matrix.
+    oc_blk_ = nstl::min(max_oc_blk, rnd_up(OC(), 16));
+
+    // `format_tag::any` weights are reported in the transformed layout, so
+    // that the transform is done once by a reorder. The weights in a regular
+    // layout are transformed on every execution.
+    if (weights_md_.format_kind == format_kind::any)
+        init_wei_md(weights_md_, oc_blk_);
+    const memory_desc_wrapper wei_d(weights_md(0));
+    VDISPATCH_CONV(wei_d.is_blocking_desc()
+                    || (is_wei_md(weights_md_)
+                            && weights_md_.format_desc.wino_desc.oc_block
+                                    == oc_blk_),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+
+    // The transformed source of a block of tiles is expected to stay in L2
+    // while all the OC blocks are processed. The blocks are reduced when
+    // there are too few of them to keep all the threads busy.
+    nt_ = th() * tw();
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t L2 = platform::get_per_core_cache_size(2);
+    const dim_t V_size_per_tile = sizeof(float) * alpha * alpha * IC();
+    t_blk_ = nstl::max(
+            dim_t(1), nstl::min(dim_t(32), L2 / 2 / V_size_per_tile));
+    t_blk_ = nstl::min(t_blk_, div_up(MB() * nt_, nthr));
+    t_blk_ = nstl::min(t_blk_, nt_);
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_wino_convolution_fwd_t::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise(/* require_scale_one = */ true))
+            return false;
+    return true;
+}
+
+bool brgemm_wino_convolution_fwd_t::pd_t::is_auto_profitable() const {
+    // Empirical: transforms are amortized by wide enough GEMMs, and tiles of
+    // small images are mostly padding.
+    return IC() >= 64 && OC() >= 64 && OH() >= 8 && OW() >= 8;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_brgemm_descs() {
+    const dim_t IC = this->IC();
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_kernel(idx)) continue;
+        const dim_t M = (idx & 1) ? nt_ % t_blk_ : t_blk_;
+        const dim_t N = (idx & 2) ? OC() % oc_blk_ : oc_blk_;
+
+        // M[a] = V[a] * U[a]: A is the transformed block of tiles, B is a
+        // block of the transformed weights and C is a per-thread f32 buffer.
+        brgemm_desc_t &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.f, 0.f, IC, oc_blk_, oc_blk_, M, N, IC));
+        brgemm_attr_t brg_attr;
+        brg_attr.max_bs = 1;
+        brg_attr.hint_expected_A_size = M * IC;
+        brg_attr.hint_expected_B_size = IC * N;
+        brg_attr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brg_attr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    const dim_t nthr = dnnl_get_max_threads();
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_wino_V, nthr * alpha * alpha * t_blk_ * IC());
+    scratchpad.template book<float>(
+            key_wino_M, nthr * alpha * alpha * t_blk_ * oc_blk_);
+    if (!wei_is_transformed())
+        scratchpad.template book<float>(
+                key_wino_U, alpha * alpha * IC() * oc_nblks() * oc_blk_);
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(idx)));
+        CHECK(safe_ptr_assign(kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::transform_src(const float *src, float *V,
+        dim_t n, dim_t t_start, dim_t vT) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t IC = pd()->IC();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t tw = pd()->tw();
+    const dim_t t_blk = pd()->t_blk();
+
+    float d[alpha * alpha * ic_chunk];
+    float tmp[alpha * alpha * ic_chunk];
+
+    for (dim_t t = 0; t < vT; t++) {
+        const dim_t ih0 = ((t_start + t) / tw) * tile_size - pd()->padT();
+        const dim_t iw0 = ((t_start + t) % tw) * tile_size - pd()->padL();
+        for (dim_t ic = 0; ic < IC; ic += ic_chunk) {
+            const dim_t C = nstl::min(ic_chunk, IC - ic);
+            for_(dim_t i = 0; i < alpha; i++)
+            for (dim_t j = 0; j < alpha; j++) {
+                const dim_t ih = ih0 + i;
+                const dim_t iw = iw0 + j;
+                float *d_ij = d + (i * alpha + j) * C;
+                const bool is_pad = ih < 0 || ih >= IH || iw < 0 || iw >= IW;
+                const float *s
+                        = is_pad ? nullptr : src + src_d.blk_off(n, ic, ih, iw);
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < C; c++)
+                    d_ij[c] = is_pad ? 0.f : s[c];
+            }
+
+            // tmp[i][j] = sum_k(B^T[i][k] * d[k][j])
+            for (dim_t j = 0; j < alpha; j++)
+                transform_bt(d + j * C, alpha * C, tmp + j * C, alpha * C, C);
+            // V[i][j] = sum_k(tmp[i][k] * B^T[j][k])
+            for (dim_t i = 0; i < alpha; i++)
+                transform_bt(tmp + i * alpha * C, C,
+                        V + (i * alpha * t_blk + t) * IC + ic, t_blk * IC, C);
+        }
+    }
+}
+
+void brgemm_wino_convolution_fwd_t::transform_dst(const float *M,
+        const float *bias, float *dst, dim_t n, dim_t t_start, dim_t vT,
+        dim_t oc, dim_t vOC) const {
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &po = pd()->attr()->post_ops_;
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t tw = pd()->tw();
+    const dim_t t_blk = pd()->t_blk();
+    const dim_t ldc = pd()->oc_blk();
+
+    float tmp[tile_size * alpha * max_oc_blk];
+    float y[tile_size * tile_size * max_oc_blk];
+
+    for (dim_t t = 0; t < vT; t++) {
+        // tmp[i][j] = sum_k(A^T[i][k] * M[k][j])
+        for (dim_t j = 0; j < alpha; j++)
+            transform_at(M + (j * t_blk + t) * ldc, alpha * t_blk * ldc,
+                    tmp + j * vOC, alpha * vOC, vOC);
+        // y[i][j] = sum_k(tmp[i][k] * A^T[j][k])
+        for (dim_t i = 0; i < tile_size; i++)
+            transform_at(tmp + i * alpha * vOC, vOC, y + i * tile_size * vOC,
+                    vOC, vOC);
+
+        const dim_t oh0 = ((t_start + t) / tw) * tile_size;
+        const dim_t ow0 = ((t_start + t) % tw) * tile_size;
+        const dim_t vH = nstl::min(tile_size, OH - oh0);
+        const dim_t vW = nstl::min(tile_size, OW - ow0);
+        for_(dim_t i = 0; i < vH; i++)
+        for (dim_t j = 0; j < vW; j++) {
+            const float *y_ij = y + (i * tile_size + j) * vOC;
+            float *d = dst + dst_d.blk_off(n, oc, oh0 + i, ow0 + j);
+            for (dim_t c = 0; c < vOC; c++) {
+                float v = y_ij[c] + (bias ? bias[oc + c] : 0.f);
+                for (int k = 0; k < po.len(); k++) {
+                    const auto &e = po.entry_[k].eltwise;
+                    v = compute_eltwise_scalar_fwd(e.alg, v, e.alpha, e.beta);
+                }
+                d[c] = v;
+            }
+        }
+    }
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t MB = pd()->MB();
+    const dim_t IC = pd()->IC();
+    const dim_t OC = pd()->OC();
+    const dim_t nt = pd()->nt();
+    const dim_t t_blk = pd()->t_blk();
+    const dim_t t_nblks = pd()->t_nblks();
+    const dim_t oc_blk = pd()->oc_blk();
+    const dim_t oc_nblks = pd()->oc_nblks();
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *V_base = scratchpad.template get<float>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+
+    const float *U = wei;
+    if (!pd()->wei_is_transformed()) {
+        float *U_buf = scratchpad.template get<float>(key_wino_U);
+        transform_weights(
+                memory_desc_wrapper(pd()->weights_md(0)), wei, U_buf, oc_blk);
+        U = U_buf;
+    }
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * t_nblks, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *V = V_base + ithr * alpha * alpha * t_blk * IC;
+        float *M = M_base + ithr * alpha * alpha * t_blk * oc_blk;
+
+        brgemm_batch_element_t batch;
+        batch.vvpad.top = 0;
+        batch.vvpad.bottom = 0;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t n = iwork / t_nblks;
+            const dim_t t_start = (iwork % t_nblks) * t_blk;
+            const dim_t vT = nstl::min(t_blk, nt - t_start);
+
+            transform_src(src, V, n, t_start, vT);
+
+            for (dim_t ocb = 0; ocb < oc_nblks; ocb++) {
+                const dim_t oc = ocb * oc_blk;
+                const dim_t vOC = nstl::min(oc_blk, OC - oc);
+                const int idx = pd_t::ker_idx(vT < t_blk, vOC < oc_blk);
+                for (dim_t a = 0; a < alpha * alpha; a++) {
+                    batch.ptr.A = V + a * t_blk * IC;
+                    batch.ptr.B = U + ((a * oc_nblks + ocb) * IC) * oc_blk;
+                    brgemm_kernel_execute(kernels_[idx].get(), 1, &batch,
+                            M + a * t_blk * oc_blk);
+                }
+                transform_dst(M, bias, dst, n, t_start, vT, oc, vOC);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
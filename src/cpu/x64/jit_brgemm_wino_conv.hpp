@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino {
+// Winograd F(4x4, 3x3): every 4x4 tile of the destination is computed from a
+// 6x6 tile of the source.
+constexpr dim_t kernel_size = 3;
+constexpr dim_t tile_size = 4;
+constexpr dim_t alpha = tile_size + kernel_size - 1;
+
+// Turns a descriptor of `oc x ic x 3 x 3` weights into a descriptor of the
+// transformed weights. The layout is `U[alpha * alpha][OC / oc_block][IC]
+// [oc_block]`, OC is zero padded up to `oc_block`.
+void init_wei_md(memory_desc_t &md, dim_t oc_block);
+
+// Returns true if `md` describes weights created by `init_wei_md()`.
+bool is_wei_md(const memory_desc_t &md);
+
+// U = G * w * G^T for every pair of output and input channels. The weights
+// may be in any plain or blocked format.
+void transform_weights(const memory_desc_wrapper &wei_d, const float *wei,
+        float *U, dim_t oc_block);
+} // namespace brgemm_wino
+
+// Winograd F(4x4, 3x3) forward convolution. A work item is a block of
+// `t_blk` tiles of an image:
+//   V[a] = B^T * src_tile * B            (per-thread, t_blk x IC for each a)
+//   M[a] = V[a] * U[a]                   (brgemm, for every block of OC)
+//   dst_tile = A^T * M * A + bias        (straight to the destination)
+// where `a` runs over alpha x alpha points of the transformed domain. The
+// weights transform is done by a reorder to the layout reported for
+// `format_tag::any` weights or on every execution otherwise.
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", isa_, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: bit 0 - tiles block tail, bit 1 - OC block tail.
+        static constexpr int max_num_kernels = 4;
+        static int ker_idx(bool t_tail, bool oc_tail) {
+            return (t_tail ? 1 : 0) + (oc_tail ? 2 : 0);
+        }
+        bool has_kernel(int idx) const {
+            return IMPLICATION(idx & 1, nt_ % t_blk_ > 0)
+                    && IMPLICATION(idx & 2, OC() % oc_blk_ > 0);
+        }
+        const brgemm_desc_t &brg_desc(int idx) const { return brgs_[idx]; }
+
+        dim_t t_blk() const { return t_blk_; }
+        dim_t oc_blk() const { return oc_blk_; }
+        dim_t oc_nblks() const { return utils::div_up(OC(), oc_blk_); }
+        // Number of tiles along the destination height and width.
+        dim_t th() const { return utils::div_up(OH(), brgemm_wino::tile_size); }
+        dim_t tw() const { return utils::div_up(OW(), brgemm_wino::tile_size); }
+        dim_t nt() const { return nt_; }
+        dim_t t_nblks() const { return utils::div_up(nt_, t_blk_); }
+        // If false, the weights are transformed on every execution.
+        bool wei_is_transformed() const {
+            return brgemm_wino::is_wei_md(*weights_md(0));
+        }
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+        bool post_ops_ok() const;
+        bool is_auto_profitable() const;
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t nt_ = 0;
+        dim_t t_blk_ = 0;
+        dim_t oc_blk_ = 0;
+        brgemm_desc_t brgs_[max_num_kernels];
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_src(const float *src, float *V, dim_t n, dim_t t_start,
+            dim_t vT) const;
+    void transform_dst(const float *M, const float *bias, float *dst, dim_t n,
+            dim_t t_start, dim_t vT, dim_t oc, dim_t vOC) const;
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
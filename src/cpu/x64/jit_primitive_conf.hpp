@@ -708,6 +708,9 @@ enum conv_brgemm_loop_order_t {
     loop_ndhwgc,
     loop_ngcdhw,
     loop_gcndhw,
+    // Tiles of od and oh blocks, then g and oc blocks, then the blocks of
+    // the tile.
+    loop_ntgcdhw,
 };
 
 enum conv_brgemm_exec_type_t {
@@ -735,6 +738,8 @@ struct jit_brgemm_conv_conf_t {
 
     int od_block, oh_block, nb_od,
             nb_oh; // blocking  - included in parallelization
+    // spatial tiling for loop_ntgcdhw: od and oh blocks per tile
+    int od_tile, oh_tile;
     int id_block, ih_block, nb_id, nb_ih;
     dim_t inp_buffer_size, inp_buffer_mask_size, out_buffer_size;
     conv_brgemm_exec_type_t exec_type;
@@ -842,6 +847,8 @@ struct jit_brgemm_conv_conf_t {
     bool dst_zero_point;
     bool req_brg_comp_pad;
     bool req_cal_comp_pad;
+    // compensations with padding are computed once per constant weights
+    bool comp_pad_cached {false};
     bool is_bf32 {false};
     bool is_tf32 {false};
     bool is_fp8 {false};
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/jit_uni_prefetch.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+#define GET_OFF(field) offsetof(jit_uni_prefetch_t::call_params_t, field)
+
+void jit_uni_prefetch_t::generate() {
+    preamble();
+
+    mov(reg_ptr_, ptr[abi_param1 + GET_OFF(ptr)]);
+    mov(reg_nlines_, ptr[abi_param1 + GET_OFF(nlines)]);
+
+    Xbyak::Label l_loop;
+    L(l_loop);
+    {
+        prefetcht1(ptr[reg_ptr_]);
+        add(reg_ptr_, cache_line_size);
+        dec(reg_nlines_);
+        jnz(l_loop, T_NEAR);
+    }
+
+    postamble();
+}
+
+#undef GET_OFF
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_PREFETCH_HPP
+#define CPU_X64_JIT_UNI_PREFETCH_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Prefetches a range of memory into L2 with one `prefetcht1` per cache line.
+// Primitives use it to bring in the memory passed with DNNL_ARG_PREFETCH_HINT
+// while they compute.
+struct jit_uni_prefetch_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_prefetch_t)
+
+    struct call_params_t {
+        const void *ptr;
+        size_t nlines;
+    };
+
+    jit_uni_prefetch_t() : jit_generator_t(jit_name()) {}
+
+    void operator()(const void *ptr, size_t size) const {
+        if (size == 0) return;
+        call_params_t p {ptr, utils::div_up(size, cache_line_size)};
+        jit_generator_t::operator()(&p);
+    }
+
+    // Splits `size` bytes into `nparts` parts of whole cache lines and
+    // returns the bounds of part `ipart`.
+    static void get_part(const char *ptr, size_t size, int ipart, int nparts,
+            const char *&part_ptr, size_t &part_size) {
+        const size_t nlines = utils::div_up(size, cache_line_size);
+        const size_t part_nlines = utils::div_up(nlines, nparts);
+        const size_t start = nstl::min(ipart * part_nlines, nlines);
+        const size_t end = nstl::min(start + part_nlines, nlines);
+        part_ptr = ptr + start * cache_line_size;
+        part_size = (end - start) * cache_line_size;
+    }
+
+    static constexpr size_t cache_line_size = 64;
+
+private:
+    Xbyak::Reg64 reg_ptr_ = r8;
+    Xbyak::Reg64 reg_nlines_ = r9;
+
+    void generate() override;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <cmath>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -118,6 +119,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     bool with_src_scales_ = false;
     bool with_dst_scales_ = false;
     bool use_ext_aux_vmms_ = false;
+    bool axis_is_split_ = false;
 
     size_t unroll_regs_ = 4;
 
@@ -572,24 +574,6 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         axis_loop(pre_body, body, post_body);
 
         get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
-
-        if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
-            Xbyak::Label skip_div;
-            // `vptest` sets the `ZF` flag if all bits in the result are 0 of
-            // the bitwise AND of source operands.
-            // Note: using Vmm(1) is an ugly workaround EVEX versus VEX encoding
-            // as `vsum` uses index `30` on avx512_core. `Vmm(1)` is a tmp vreg
-            // used to read data just above. Should be safe.
-            uni_vmovups(Vmm(1), vsum);
-            uni_vptest(Xmm(1), Xmm(1));
-            jz(skip_div, T_NEAR); // Check if ZF is set.
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-            L(skip_div);
-        } else if (is_softmax_) {
-            uni_vdivps(vsum, vone, vsum, vtmp = vmax);
-        } else if (is_logsoftmax_) {
-            log_injector_->compute_vector(vsum.getIdx());
-        }
     }
 
     void accumulate_vsum() {
@@ -698,14 +682,17 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         axis_loop(pre_body, body, post_body);
 
         get_horizontal_op(vsum, vtmp = vmax, op_t::sum);
+    }
 
+    // Turns the accumulated sum into a value `compute_dst` applies.
+    void finalize_vsum() {
         if (pd_->alg_kind() == alg_kind::softmax_accurate_inf_as_zero) {
             Xbyak::Label skip_div;
             // `vptest` sets the `ZF` flag if all bits in the result are 0 of
             // the bitwise AND of source operands.
             // Note: using Vmm(1) is an ugly workaround EVEX versus VEX encoding
             // as `vsum` uses index `30` on avx512_core. `Vmm(1)` is a tmp vreg
-            // used to read data just above. Should be safe.
+            // used to read data in the accumulation loop. Should be safe.
             uni_vmovups(Vmm(1), vsum);
             uni_vptest(Xmm(1), Xmm(1));
             jz(skip_div, T_NEAR); // Check if ZF is set.
@@ -925,9 +912,43 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
     }
 
     void forward() {
+        if (axis_is_split_) {
+            forward_split_axis();
+            return;
+        }
+        accumulate_vmax();
+        accumulate_vsum();
+        finalize_vsum();
+        compute_dst();
+    }
+
+    // A chunk of the split axis is processed in two calls. The first one
+    // stores the chunk maximum and sum of exponents into `axis_chunk_stats`
+    // and leaves intermediate values in dst (or interim) memory, the same way
+    // the regular flow does. The second one is requested by non-null
+    // `axis_chunk_scale` and applies it on top of intermediate values, which
+    // turns them into the final result.
+    void forward_split_axis() {
+        Label normalize, end;
+
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(axis_chunk_scale)]);
+        test(reg_tmp, reg_tmp);
+        jnz(normalize, T_NEAR);
+
         accumulate_vmax();
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(axis_chunk_stats)]);
+        uni_vmovss(ptr[reg_tmp], Xmm(vmax.getIdx()));
         accumulate_vsum();
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(axis_chunk_stats)]);
+        uni_vmovss(ptr[reg_tmp + sizeof(float)], Xmm(vsum.getIdx()));
+        jmp(end, T_NEAR);
+
+        L(normalize);
+        uni_vbroadcastss(vsum, ptr[reg_tmp]);
+        io_.init_saturate_f32({dst_d_.data_type()});
         compute_dst();
+
+        L(end);
     }
 
     void backward() {
@@ -989,7 +1010,8 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
         io_.prepare_table_fp8();
     }
 
-    jit_softmax_dense_kernel_t(const softmax_pd_t *pd)
+    jit_softmax_dense_kernel_t(
+            const softmax_pd_t *pd, bool axis_is_split = false)
         : jit_softmax_kernel_base_t(pd)
         , jit_generator_t(jit_name(), isa)
         , src_d_(pd_->invariant_src_md())
@@ -1008,6 +1030,7 @@ struct jit_softmax_dense_kernel_t : jit_softmax_kernel_base_t,
                                   accumulation_mode::relaxed,
                                   accumulation_mode::any)))
         , use_ext_aux_vmms_(!is_logsoftmax_ && n_vregs > 16)
+        , axis_is_split_(axis_is_split)
         , axis_simd_full_(pd_->axis_size() / simd_w_)
         , axis_simd_tail_(pd_->axis_size() % simd_w_) {
 
@@ -1638,14 +1661,14 @@ struct jit_softmax_strided_kernel_t : jit_softmax_kernel_base_t,
 // class is easier though certain pieces are same.
 jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
         const softmax_pd_t *pd, const cpu_isa_t isa,
-        bool axis_is_plain_and_strided) {
+        bool axis_is_plain_and_strided, bool axis_is_split) {
 
 #define HANDLE_ISA(isa_) \
     if ((isa_) == isa) { \
         if (axis_is_plain_and_strided) \
             return new jit_softmax_strided_kernel_t<isa_>(pd); \
         else \
-            return new jit_softmax_dense_kernel_t<isa_>(pd); \
+            return new jit_softmax_dense_kernel_t<isa_>(pd, axis_is_split); \
     }
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
@@ -1680,13 +1703,15 @@ jit_uni_softmax_fwd_t::jit_uni_softmax_fwd_t(const pd_t *apd)
 
 status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(ker_,
-            softmax_impl::jit_softmax_kernel_base_t::create(
-                    pd(), pd()->isa_, pd()->axis_is_plain_and_strided_)));
+            softmax_impl::jit_softmax_kernel_base_t::create(pd(), pd()->isa_,
+                    pd()->axis_is_plain_and_strided_, pd()->axis_is_split())));
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
 
 status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->axis_is_split()) return execute_split_axis(ctx);
+
     const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
@@ -1803,6 +1828,113 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t jit_uni_softmax_fwd_t::execute_split_axis(
+        const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const void *dst_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *interim = scratchpad.template get<float>(
+            memory_tracking::names::key_softmax_interim_store);
+    float *stats = scratchpad.template get<float>(
+            memory_tracking::names::key_softmax_reduction);
+
+    float *dst_scales_inv_ptr = nullptr;
+    if (!pd()->attr()->scales_.has_default_values(DNNL_ARG_DST)) {
+        dst_scales_inv_ptr = scratchpad.template get<float>(
+                memory_tracking::names::key_softmax_dst_scales);
+        dst_scales_inv_ptr[0]
+                = 1.f / static_cast<const float *>(dst_scales)[0];
+    }
+
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_data_type_size = src_d.data_type_size();
+    const auto dst_data_type_size = dst_d.data_type_size();
+    const dim_t nrows = pd()->nrows_;
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t chunk_size = pd()->axis_chunk_size_;
+    const dim_t nchunks = pd()->axis_nchunks_;
+    const dim_t stats_size = pd_t::axis_chunk_stats_size;
+    const int nthr = pd()->nthr_;
+
+    VDEBUGINFO(1, primitive, softmax,
+            "%s,src=%p dst=%p nrows=%" PRId64 " chunk_size=%" PRId64
+            " nchunks=%" PRId64,
+            pd()->impl_name(), src, dst, nrows, chunk_size, nchunks);
+
+    // `scale` is nullptr for the first call over the chunk.
+    const auto ker_chunk = [&](dim_t row, dim_t ichunk, const float *scale) {
+        const dim_t offset = row * axis_size + ichunk * chunk_size;
+
+        softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
+        p.process_n_elems
+                = nstl::min(chunk_size, axis_size - ichunk * chunk_size);
+        p.src = src + offset * src_data_type_size;
+        p.dst = dst + offset * dst_data_type_size;
+        p.interim = interim ? interim + offset : nullptr;
+        p.src_scales = src_scales;
+        p.dst_scales = dst_scales_inv_ptr;
+        // post-ops
+        p.dst_orig = dst;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        // split axis
+        p.axis_chunk_stats = stats + (row * nchunks + ichunk) * stats_size;
+        p.axis_chunk_scale = scale;
+        (*ker_)(&p);
+    };
+
+    parallel_nd_ext(nthr, nrows, nchunks,
+            [&](int, int, dim_t row, dim_t ichunk) {
+                ker_chunk(row, ichunk, nullptr);
+            });
+
+    // Combine the chunks statistics of a row:
+    //   max = max_c(max_c), sum = sum_c(sum_c * exp(max_c - max)),
+    // and compute a scale for every chunk to bring its intermediate results,
+    // `exp(x - max_c)` for softmax and `x - max_c` for logsoftmax, to the
+    // final ones.
+    const bool inf_as_zero
+            = pd()->alg_kind() == alg_kind::softmax_accurate_inf_as_zero;
+    for (dim_t row = 0; row < nrows; row++) {
+        float *row_stats = stats + row * nchunks * stats_size;
+        float max = -FLT_MAX;
+        for (dim_t c = 0; c < nchunks; c++)
+            max = nstl::max(max, row_stats[c * stats_size + 0]);
+        float sum = 0.f;
+        for (dim_t c = 0; c < nchunks; c++) {
+            const float *chunk_stats = row_stats + c * stats_size;
+            sum += chunk_stats[1] * expf(chunk_stats[0] - max);
+        }
+        for (dim_t c = 0; c < nchunks; c++) {
+            float *chunk_stats = row_stats + c * stats_size;
+            if (pd()->is_logsoftmax())
+                chunk_stats[2] = max - chunk_stats[0] + logf(sum);
+            else if (inf_as_zero && sum == 0.f)
+                chunk_stats[2] = 0.f;
+            else
+                chunk_stats[2] = expf(chunk_stats[0] - max) / sum;
+        }
+    }
+
+    parallel_nd_ext(nthr, nrows, nchunks,
+            [&](int, int, dim_t row, dim_t ichunk) {
+                ker_chunk(row, ichunk,
+                        stats + (row * nchunks + ichunk) * stats_size + 2);
+            });
+
+    return status::success;
+}
+
 jit_uni_softmax_bwd_t::jit_uni_softmax_bwd_t(const pd_t *apd)
     : primitive_t(apd) {}
 
@@ -41,7 +41,8 @@ namespace softmax_impl {
 // the kernel.
 struct jit_softmax_kernel_base_t {
     static jit_softmax_kernel_base_t *create(const softmax_pd_t *pd,
-            const cpu_isa_t isa, bool axis_is_plain_and_strided);
+            const cpu_isa_t isa, bool axis_is_plain_and_strided,
+            bool axis_is_split = false);
 
     virtual ~jit_softmax_kernel_base_t() = default;
 
@@ -56,6 +57,10 @@ struct jit_softmax_kernel_base_t {
         // post ops
         const void *dst_orig;
         const void *post_ops_binary_rhs_arg_vec;
+
+        // split axis mode
+        void *axis_chunk_stats; // {max, sum of exponents} of the axis chunk
+        const void *axis_chunk_scale; // if set, the chunk is normalized
     };
 
     virtual void operator()(const call_params_t *p) const = 0;
@@ -166,6 +171,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             const memory_desc_wrapper dst_d(dst_md());
             axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
             nthr_ = dnnl_get_max_threads();
+            init_axis_split();
             init_scratchpad();
 
             return status::success;
@@ -175,8 +181,42 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
         bool axis_is_plain_and_strided_ = false;
+        // When there are fewer rows than threads, the axis is split into
+        // `axis_nchunks_` chunks of `axis_chunk_size_` elements. The chunks
+        // are processed in parallel, then their statistics are combined and
+        // the chunks are normalized, again in parallel.
+        dim_t axis_chunk_size_ = 0;
+        dim_t axis_nchunks_ = 1;
+        // Number of rows, each row is a dense axis.
+        dim_t nrows_ = 0;
+        // Each chunk keeps {max, sum of exponents, scale}.
+        static constexpr dim_t axis_chunk_stats_size = 3;
+
+        bool axis_is_split() const { return axis_nchunks_ > 1; }
 
     private:
+        void init_axis_split() {
+            const memory_desc_wrapper dst_d(dst_md());
+            if (!dst_d.is_plain() || axis_stride() != 1) return;
+
+            nrows_ = dst_d.nelems() / axis_size();
+            if (nrows_ >= nthr_) return;
+
+            // A chunk is big enough to hide the cost of extra parallel
+            // sections and is a multiple of a kernel unrolled block, so that
+            // only the last chunk in a row may have a tail.
+            static constexpr dim_t min_chunk_size = 4096;
+            static constexpr dim_t unroll_regs = 4;
+            const dim_t simd_w = isa_max_vlen(isa_) / sizeof(float);
+            const dim_t nchunks = nstl::min<dim_t>(
+                    nthr_ / nrows_, axis_size() / min_chunk_size);
+            if (nchunks < 2) return;
+
+            axis_chunk_size_ = utils::rnd_up(
+                    utils::div_up(axis_size(), nchunks), unroll_regs * simd_w);
+            axis_nchunks_ = utils::div_up(axis_size(), axis_chunk_size_);
+        }
+
         void init_scratchpad() {
             const auto src_dt = src_md()->data_type;
             const auto dst_dt = dst_md()->data_type;
@@ -189,7 +229,13 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             const bool need_f32_intermediate
                     = dst_dt != data_type::f32 && !relaxed_acc;
-            if (need_f32_intermediate) {
+            if (need_f32_intermediate && axis_is_split()) {
+                // Intermediate results of a chunk are normalized by another
+                // thread, thus, the scratchpad covers the whole tensor.
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_softmax_interim_store,
+                        nrows_ * axis_size());
+            } else if (need_f32_intermediate) {
                 // When stride != 1, then each thread operates over simd at a
                 // time, thus, increased scratchpad size.
                 dim_t elem_per_thr = 1;
@@ -207,6 +253,11 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                 scratchpad.book(memory_tracking::names::key_softmax_dst_scales,
                         static_cast<size_t>(nthr_) * sizeof(float), 64);
             }
+            if (axis_is_split()) {
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_softmax_reduction,
+                        nrows_ * axis_nchunks_ * axis_chunk_stats_size);
+            }
         }
 
         bool post_ops_ok() const {
@@ -276,6 +327,8 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_split_axis(const exec_ctx_t &ctx) const;
+
     std::unique_ptr<softmax_impl::jit_softmax_kernel_base_t> ker_;
 };
 
@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_bsr_matmul_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr
+                    && !src_d.is_sparse_desc() && !dst_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(f32, src_md()->data_type,
+                             weights_md()->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(
+            everyone_is(s32, wei_d.metadata_type(0), wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_MATMUL(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(!src_d.has_runtime_dims_or_strides()
+                    && !dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(memory_desc_wrapper(src_md()).matches_one_of_tag(
+                             format_tag::ab)
+                    && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                            format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    bk_ = wei_d.sparse_desc().bsr_block_dims[0];
+    bn_ = wei_d.sparse_desc().bsr_block_dims[1];
+
+    // Empirical: a taller tile amortizes the loads of the weights block
+    // while the source rows of a single block still fit L1.
+    const dim_t M = dst_d.dims()[0];
+    M_blk_ = nstl::min(M, dim_t(64));
+    M_tail_ = M % M_blk_;
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::pd_t::init_brgemm_descs() {
+    const dim_t K = src_md()->dims[1];
+    const dim_t N = dst_md()->dims[1];
+    const dim_t KB = K / bk_;
+
+    for (int idx = 0; idx < max_num_kernels; idx++) {
+        if (!has_brg_kernel(idx)) continue;
+        const dim_t vM = idx == 0 ? M_blk_ : M_tail_;
+
+        // A is the `vM x bk` slice of the source, B is a dense block of the
+        // weights and C is the `vM x bn` tile of the destination. Each tile
+        // is computed by a single call, hence `beta = 0`.
+        brgemm_desc_t &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32, false,
+                false, brgemm_row_major, 1.f, 0.f, K, bn_, N, vM, bn_, bk_));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = static_cast<int>(KB);
+        brgattr.hint_expected_A_size = vM * bk_;
+        brgattr.hint_expected_B_size = bk_ * bn_;
+        brgattr.hint_expected_C_size = vM * bn_;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+void brgemm_bsr_matmul_t::pd_t::init_scratchpad() {
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const dim_t K = wei_d.dims()[0];
+    const dim_t N = wei_d.dims()[1];
+
+    auto scratchpad = scratchpad_registry().registrar();
+    // Block column pointers followed by the block ids and the block row
+    // indices of the non-zero blocks sorted by block column.
+    scratchpad.template book<int32_t>(key_matmul_sparse_tmp_ptr,
+            N / bn_ + 1 + 2 * wei_d.bsr_nnz_blocks());
+    scratchpad.template book<brgemm_batch_element_t>(key_brgemm_primitive_batch,
+            static_cast<size_t>(dnnl_get_max_threads()) * (K / bk_));
+}
+
+status_t brgemm_bsr_matmul_t::init(engine_t *engine) {
+    for (int idx = 0; idx < pd_t::max_num_kernels; idx++) {
+        if (!pd()->has_brg_kernel(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+    const auto *wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto *wei_pointers
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    // Every tile of the destination is written below, no need to zero it.
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const dim_t M = pd()->dst_md()->dims[0];
+    const dim_t N = pd()->dst_md()->dims[1];
+    const dim_t K = pd()->src_md()->dims[1];
+    const dim_t bk = pd()->bk();
+    const dim_t bn = pd()->bn();
+    const dim_t KB = K / bk;
+    const dim_t NB = N / bn;
+    const dim_t M_blk = pd()->M_blk();
+    const dim_t MB = div_up(M, M_blk);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    int32_t *col_pointers
+            = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+    int32_t *col_blocks = col_pointers + NB + 1;
+    int32_t *col_block_rows = col_blocks + wei_d.bsr_nnz_blocks();
+    brgemm_batch_element_t *batch_base
+            = scratchpad.template get<brgemm_batch_element_t>(
+                    key_brgemm_primitive_batch);
+
+    // The weights are stored by block rows while a destination tile needs
+    // all the blocks of a block column. Transpose the block structure, the
+    // cost is linear in the number of non-zero blocks.
+    for (dim_t nb = 0; nb <= NB; nb++)
+        col_pointers[nb] = 0;
+    for (dim_t kb = 0; kb < KB; kb++)
+        for (int32_t blk = wei_pointers[kb]; blk < wei_pointers[kb + 1]; blk++)
+            col_pointers[wei_indices[blk] + 1]++;
+    for (dim_t nb = 0; nb < NB; nb++)
+        col_pointers[nb + 1] += col_pointers[nb];
+    for (dim_t kb = 0; kb < KB; kb++)
+        for (int32_t blk = wei_pointers[kb]; blk < wei_pointers[kb + 1];
+                blk++) {
+            const int32_t pos = col_pointers[wei_indices[blk]]++;
+            col_blocks[pos] = blk;
+            col_block_rows[pos] = static_cast<int32_t>(kb);
+        }
+    for (dim_t nb = NB; nb > 0; nb--)
+        col_pointers[nb] = col_pointers[nb - 1];
+    col_pointers[0] = 0;
+
+    // Consecutive work items of a thread share the block column so that the
+    // weights blocks stay in cache across the M blocks.
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(MB * NB, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * KB;
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t nb = iwork / MB;
+            const dim_t mb = iwork % MB;
+            const dim_t m = mb * M_blk;
+            const dim_t vM = nstl::min(M_blk, M - m);
+            float *C = dst + m * N + nb * bn;
+
+            const int32_t col_start = col_pointers[nb];
+            const int bs = static_cast<int>(col_pointers[nb + 1] - col_start);
+            if (bs == 0) {
+                for (dim_t i = 0; i < vM; i++)
+                    for (dim_t j = 0; j < bn; j++)
+                        C[i * N + j] = 0.f;
+                continue;
+            }
+
+            for (int b = 0; b < bs; b++) {
+                const dim_t blk = col_blocks[col_start + b];
+                const dim_t kb = col_block_rows[col_start + b];
+                batch[b].ptr.A = src + m * K + kb * bk;
+                batch[b].ptr.B = wei_values + blk * bk * bn;
+                batch[b].vvpad.top = 0;
+                batch[b].vvpad.bottom = 0;
+            }
+
+            const int ker_idx = vM == M_blk ? 0 : 1;
+            brgemm_kernel_execute(brg_kernels_[ker_idx].get(), bs, batch, C);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
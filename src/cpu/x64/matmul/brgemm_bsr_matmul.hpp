@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with dense source and BSR encoded weights. Every non-zero block of
+// the weights is a dense `bk x bn` row-major matrix, which is exactly the
+// layout brgemm expects for f32 B matrices. The destination is computed by
+// `M_blk x bn` tiles, one batch-reduce call per tile, with the batch built
+// only from the non-zero blocks of the respective block column.
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr:", isa_, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index: 0 - full M block, 1 - M tail.
+        static constexpr int max_num_kernels = 2;
+
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+        bool has_brg_kernel(int idx) const { return idx == 0 || M_tail_ > 0; }
+
+        dim_t M_blk() const { return M_blk_; }
+        dim_t bk() const { return bk_; }
+        dim_t bn() const { return bn_; }
+
+    private:
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        cpu_isa_t isa_ = isa_undef;
+        dim_t M_blk_ = 0;
+        dim_t M_tail_ = 0;
+        dim_t bk_ = 0;
+        dim_t bn_ = 0;
+        brgemm_desc_t brg_descs_[max_num_kernels];
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::max_num_kernels];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+#endif
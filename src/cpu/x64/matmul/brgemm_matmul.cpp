@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <cstring>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
@@ -23,7 +26,9 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
+#include "cpu/simple_rope.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
@@ -96,6 +101,17 @@ int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
     return idx;
 }
 
+// A kernel with no post-ops and no conversion to apply leaves the
+// accumulator in the C buffer, the block is copied to D as is then.
+void copy_accumulator(
+        const brgemm_desc_t &brg, const char *ptr_C, char *ptr_D) {
+    const size_t row_size = static_cast<size_t>(brg.load_dim) * brg.typesize_C;
+    for (int i = 0; i < brg.bcast_dim; i++)
+        std::memcpy(ptr_D + static_cast<size_t>(i) * brg.LDD * brg.typesize_D,
+                ptr_C + static_cast<size_t>(i) * brg.LDC * brg.typesize_C,
+                row_size);
+}
+
 } // anonymous namespace
 
 template <cpu_isa_t isa>
@@ -204,8 +220,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     };
 
     auto check_attr_scales = [&]() -> bool {
-        const std::vector<int> supported_args
+        std::vector<int> supported_args
                 = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
+        for (int i = 0; i < n_split_dsts(); i++)
+            supported_args.push_back(DNNL_ARG_MULTIPLE_DST + i);
         bool ok = attr_scales_ok(supported_args);
         const auto &asc = attr()->scales_;
         if (!asc.has_default_values(DNNL_ARG_SRC)
@@ -269,7 +287,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const bool is_sparse_ok = is_dense_format_kind()
             || (!src_d.is_sparse_desc() && !bias_d.is_sparse_desc()
                     && !dst_d.is_sparse_desc()
-                    && weights_d.is_sparse_packed_desc());
+                    && (weights_d.is_sparse_packed_desc()
+                            || weights_d.is_sparse_structured_desc()));
     // Disabling verbose dispatch messages for unsupported isa for better
     // readability.
     if (!mayiuse(isa)) return status::unimplemented;
@@ -285,7 +304,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::src_norm
+                            | primitive_attr_t::skip_mask_t::lora
+                            | primitive_attr_t::skip_mask_t::dst_split,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
@@ -304,10 +326,53 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
+    // The RoPE post-op rotates whole heads of the destination rows, so it is
+    // applied by a separate pass once the rows are complete. The kernels get
+    // the attributes without it.
+    const int rope_idx = po.find(primitive_kind::rope);
+    const bool with_rope = rope_idx != -1;
+    // The split destination tensors are stored by separate kernels, each one
+    // with the eltwise post-ops and the scale of its tensor.
+    VDISPATCH_MATMUL(IMPLICATION(with_dst_split(),
+                             po.has_default_values({primitive_kind::eltwise})),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    // With dynamic quantization the destination scales depend on the values
+    // after the post-ops, the kernels get the attributes without them.
+    const bool with_dst_dyn_quant
+            = attr()->scales_.get(DNNL_ARG_DST).get_quantization_mode()
+            == quantization_mode::dynamic_fp;
+    VDISPATCH_MATMUL(IMPLICATION(with_dst_dyn_quant,
+                             po.has_default_values({primitive_kind::eltwise})),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    const bool use_kernel_attr
+            = with_rope || with_dst_split() || with_dst_dyn_quant;
+    primitive_attr_t kernel_attr;
+    if (use_kernel_attr) CHECK(kernel_attr.copy_from(*attr()));
+    if (with_rope) {
+        VDISPATCH_MATMUL(rope_idx == po.len() - 1, VERBOSE_UNSUPPORTED_POSTOP);
+        VDISPATCH_MATMUL(one_of(dst_dt, f32, bf16, f16)
+                        && !dst_d.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_POSTOP);
+        kernel_attr.post_ops_.entry_.pop_back();
+    }
+    for (int i = 0; i < n_split_dsts(); i++)
+        CHECK(kernel_attr.scales_.set(
+                DNNL_ARG_MULTIPLE_DST + i, default_quant_entry()));
+
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_,
+            dst_md_, bias_md_, use_kernel_attr ? kernel_attr : attr_,
             [this, engine]() { return can_use_gemm_fallback(engine); }));
 
+    if (with_dst_dyn_quant)
+        CHECK(kernel_attr.scales_.set(DNNL_ARG_DST, default_quant_entry()));
+
+    if (with_rope) {
+        CHECK(attr_.set_default_formats(&dst_md_));
+        VDISPATCH_MATMUL(memory_desc_wrapper(dst_md_).matches_one_of_tag(
+                                 get_abx_tag(dst_md_.ndims)),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
     // f32:f16 configuration on AVX2 doesn't support tails with proper
     // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
     VDISPATCH_MATMUL(IMPLICATION((is_f32_f16 || is_f32_bf16) && isa == avx2,
@@ -338,7 +403,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             : isa;
 
     const int i_bs_end = bgmmc_.brgemm_batch_tail_size ? 2 : 1;
-    const int i_init_start = bgmmc_.K_blk != bgmmc_.K ? 0 : 1;
+    // With LoRA the accumulator is initialized by the update, so the main
+    // kernels always accumulate.
+    const int i_init_start
+            = bgmmc_.K_blk != bgmmc_.K || bgmmc_.with_lora ? 0 : 1;
     const int i_K_end = bgmmc_.K_tail ? 2 : 1;
 
     for_(int i_bs = 0; i_bs < i_bs_end; i_bs++)
@@ -380,8 +448,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         if (bgmmc_.with_wei_decompression && bgmmc_.has_zero_point_b)
             brg.skip_zp_b_compensation = true;
         if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
-        CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+        CHECK(brgemm_desc_set_postops(&brg,
+                use_kernel_attr ? &kernel_attr : attr(), &dst_md_, LDD,
+                bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -421,8 +490,21 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
         bgmmc_.wsp_tile_per_thr_bytes = nstl::max(
                 brg.get_wsp_buffer_size(), bgmmc_.wsp_tile_per_thr_bytes);
+
+        // The kernels storing the split destination differ from the main
+        // ones by their post-ops only.
+        if (bgmmc_.with_dst_split && i_bs == 0 && i_init == i_init_start
+                && i_K == 0 && prefetching == 0)
+            CHECK(init_dst_split_descs(kernel_isa, LDA, vM, vN, vK, brgattr,
+                    kernel_attr, i_M, i_N));
+        if (bgmmc_.with_dst_dyn_quant && i_bs == 0 && i_init == i_init_start
+                && i_K == 0 && prefetching == 0)
+            CHECK(init_dst_dyn_quant_desc(kernel_isa, LDA, vM, vN, vK, brgattr,
+                    kernel_attr, i_M, i_N));
     }
 
+    if (bgmmc_.with_lora) CHECK(init_lora_descs());
+
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
     const auto wei_scale_count = bgmmc_.is_wei_scale_per_k
@@ -430,10 +512,143 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             : N();
     book_precomputed_scales(scratchpad, attr()->scales_, wei_scale_count,
             /* scale_adjust_factor = */ 1.f, bgmmc_.req_transpose_scales);
+    if (with_rope && dst_dt != f32) {
+        const auto &rope = po.entry_[rope_idx].rope;
+        scratchpad.template book<float>(key_matmul_rope_buf,
+                static_cast<size_t>(bgmmc_.nthr) * rope.head_size);
+    }
 
     return status::success;
 }
 
+template <cpu_isa_t isa>
+int brgemm_matmul_t<isa>::pd_t::get_lora_kernel_idx(
+        int m_ker_idx, dim_t n) const {
+    if (n <= 0 || m_ker_idx > 1) return -1;
+    for (int i_N = 0; i_N < max_num_lora_kernels / 2; i_N++)
+        if (lora_n_[i_N] == n) return m_ker_idx * 3 + i_N;
+    return -1;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_lora_descs() {
+    // The update is computed in f32 whatever the data types of the main
+    // kernels are. It does not use AMX, so the tiles stay configured.
+    const cpu_isa_t lora_isa = mayiuse(avx512_core) ? avx512_core : avx2;
+
+    // With AMX the columns of the C buffer are split into panels of LDC
+    // elements placed `M_blk * LDC` elements apart.
+    const dim_t n_blk = nstl::min(bgmmc_.LDC, (dim_t)bgmmc_.N_blk);
+    lora_n_[0] = n_blk;
+    lora_n_[1] = bgmmc_.N_blk % n_blk;
+    lora_n_[2] = bgmmc_.N_tail % n_blk;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < max_num_lora_kernels / 2; i_N++) {
+        const dim_t vM = i_M ? bgmmc_.M_tail : bgmmc_.M_blk;
+        const dim_t vN = lora_n_[i_N];
+        if (vM == 0 || vN == 0) continue;
+
+        // A is the `batch * M x lora_K` matrix of the products of the source
+        // rows with the A matrices, B is the `lora_K x N` stack of the B
+        // matrices of all the adapters.
+        brgemm_desc_t &brg = lora_descs_[i_M * 3 + i_N];
+        CHECK(brgemm_desc_init(&brg, lora_isa, brgemm_addr, f32, f32, false,
+                false, brgemm_row_major, 1.f, 0.f, bgmmc_.lora_K, bgmmc_.N,
+                bgmmc_.LDC, vM, vN, bgmmc_.lora_K));
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+int brgemm_matmul_t<isa>::pd_t::get_dst_split_idx(
+        dim_t n, dim_t &n_off) const {
+    const auto &dsts = attr()->dst_split_.dsts_;
+    n_off = 0;
+    for (int i = 0; i < static_cast<int>(dsts.size()); i++) {
+        const memory_desc_t &md = dsts[i];
+        const dim_t D = md.dims[md.ndims - 1];
+        const dim_t N_i = md.ndims > ndims() ? md.dims[md.ndims - 3] * D : D;
+        if (n < n_off + N_i) return i;
+        n_off += N_i;
+    }
+    assert(!"column is out of the destination");
+    return -1;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_dst_split_descs(
+        cpu_isa_t kernel_isa, dim_t LDA, dim_t M, dim_t N, dim_t K,
+        const brgemm_attr_t &base_attr, const primitive_attr_t &kernel_attr,
+        int i_M, int i_N) {
+    const auto &dst_split = attr()->dst_split_;
+    const auto &asc = attr()->scales_;
+
+    // The accumulator is complete in the C buffer, the kernels only apply
+    // the post-ops and convert it. With the accumulation skipped it is read
+    // through beta.
+    brgemm_attr_t brgattr = base_attr;
+    brgattr.generate_skip_accumulation = true;
+
+    for (int i = 0; i < dst_split.ndsts(); i++) {
+        // Only the last tensor may hold the N tail.
+        if (i_N > 0 && i < dst_split.ndsts() - 1) continue;
+
+        primitive_attr_t dst_attr;
+        CHECK(dst_attr.copy_from(kernel_attr));
+        const int dst_arg = DNNL_ARG_MULTIPLE_DST + i;
+        if (!asc.has_default_values(dst_arg))
+            CHECK(dst_attr.scales_.set(DNNL_ARG_DST, asc.get(dst_arg)));
+
+        const memory_desc_t &md = dst_split.dsts_[i];
+        const dim_t LDD
+                = memory_desc_wrapper(md).blocking_desc().strides[md.ndims - 2];
+        brgemm_desc_t &brg
+                = dst_split_descs_[get_dst_split_kernel_idx(i, i_M, i_N)];
+        CHECK(brgemm_desc_init(&brg, kernel_isa, bgmmc_.brg_type,
+                bgmmc_.src_dt, bgmmc_.wei_dt, false, false, brgemm_row_major,
+                1.f, 1.f, LDA, bgmmc_.LDB, bgmmc_.LDC, M, N, K, nullptr,
+                bgmmc_.is_tf32));
+        if (bgmmc_.with_wei_decompression && bgmmc_.has_zero_point_b)
+            brg.skip_zp_b_compensation = true;
+        if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
+        CHECK(brgemm_desc_set_postops(
+                &brg, &dst_attr, &md, LDD, bgmmc_.bia_dt));
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_dst_dyn_quant_desc(
+        cpu_isa_t kernel_isa, dim_t LDA, dim_t M, dim_t N, dim_t K,
+        const brgemm_attr_t &base_attr, const primitive_attr_t &kernel_attr,
+        int i_M, int i_N) {
+    brgemm_attr_t brgattr = base_attr;
+    brgattr.generate_skip_accumulation = true;
+
+    // The block is stored in f32 with its rows `N_blk` elements apart.
+    memory_desc_t buf_md = dst_md_;
+    buf_md.data_type = data_type::f32;
+    brgemm_desc_t &brg
+            = dst_dyn_quant_descs_[get_dst_dyn_quant_kernel_idx(i_M, i_N)];
+    CHECK(brgemm_desc_init(&brg, kernel_isa, bgmmc_.brg_type, bgmmc_.src_dt,
+            bgmmc_.wei_dt, false, false, brgemm_row_major, 1.f, 1.f, LDA,
+            bgmmc_.LDB, bgmmc_.LDC, M, N, K, nullptr, bgmmc_.is_tf32));
+    if (bgmmc_.with_wei_decompression && bgmmc_.has_zero_point_b)
+        brg.skip_zp_b_compensation = true;
+    if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
+    CHECK(brgemm_desc_set_postops(
+            &brg, &kernel_attr, &buf_md, bgmmc_.N_blk, bgmmc_.bia_dt));
+    CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    return brgemm_desc_finalize(&brg);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
@@ -443,7 +658,7 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
             = bgmmc.is_runtime_N ? max_num_dynamic_n_tails + 1 : 2;
 
     const int i_bs_end = bgmmc.brgemm_batch_tail_size ? 2 : 1;
-    const int i_init_start = bgmmc.K_blk != bgmmc.K ? 0 : 1;
+    const int i_init_start = bgmmc.K_blk != bgmmc.K || bgmmc.with_lora ? 0 : 1;
     const int i_K_end = bgmmc.K_tail ? 2 : 1;
 
     for_(int i_bs = 0; i_bs < i_bs_end; i_bs++)
@@ -482,10 +697,39 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         }
     }
 
+    for_(int i_M = 0; i_M < 2 && bgmmc.with_lora; i_M++)
+    for (int i_N = 0; i_N < max_num_lora_kernels / 2; i_N++) {
+        const int idx = i_M * 3 + i_N;
+        // There are no kernels for the empty tails.
+        if (pd()->get_lora_desc(idx).bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_lora_desc(idx)));
+        CHECK(safe_ptr_assign(lora_kernels_[idx], ker));
+    }
+
+    for (int idx = 0; idx < max_num_dst_split_kernels && bgmmc.with_dst_split;
+            idx++) {
+        // Only the kernels of the existing tensors and tails are initialized.
+        if (pd()->get_dst_split_desc(idx).bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_dst_split_desc(idx)));
+        CHECK(safe_ptr_assign(dst_split_kernels_[idx], ker));
+    }
+
+    for (int idx = 0;
+            idx < max_num_dst_dyn_quant_kernels && bgmmc.with_dst_dyn_quant;
+            idx++) {
+        if (pd()->get_dst_dyn_quant_desc(idx).bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_dst_dyn_quant_desc(idx)));
+        CHECK(safe_ptr_assign(dst_dyn_quant_kernels_[idx], ker));
+    }
+
     if (bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
-    if (bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only)
+    if ((bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only)
+            && !bgmmc.with_src_norm)
         CHECK(create_brgemm_matmul_copy_a(copy_A_kernel_, &bgmmc));
 
     if (pd()->with_reduce() || (bgmmc.nthr_k > 1 && bgmmc.acc_dt == f32)) {
@@ -498,6 +742,9 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         CHECK(acc_ker_s32_->create_kernel());
     }
 
+    CHECK(safe_ptr_assign(prefetch_kernel_, new jit_uni_prefetch_t()));
+    CHECK(prefetch_kernel_->create_kernel());
+
     if (bgmmc.packed_sparse_weights) {
         CHECK(safe_ptr_assign(sparse_decompress_kernel_,
                 new jit_avx512_sparse_decompress_kernel_t(bgmmc)));
@@ -556,13 +803,38 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     const int N_chunks = brgmm_ctx.get_N_chunks();
     const int N_chunk_tail = brgmm_ctx.get_N_chunk_tail();
+
+    if (bgmmc.with_src_norm) compute_src_norm_stats(brgmm_ctx);
+    if (bgmmc.with_lora) compute_lora_t(brgmm_ctx);
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
+        // Every thread prefetches its part of the prefetch hint memory. The
+        // part is spread over the work items, so that the loads overlap with
+        // the computations. Threads without work prefetch it at once.
+        const char *prf_ptr = nullptr;
+        size_t prf_size = 0;
+        jit_uni_prefetch_t::get_part(brgmm_ctx.get_prefetch_hint_ptr(),
+                brgmm_ctx.get_prefetch_hint_size(), ithr, nthr, prf_ptr,
+                prf_size);
+        auto prefetch_hint = [&](size_t size) {
+            size = nstl::min(size, prf_size);
+            (*prefetch_kernel_)(prf_ptr, size);
+            prf_ptr += size;
+            prf_size -= size;
+        };
+
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
-        if (ithr_bmn < 0 || ithr_k < 0) return;
+        if (ithr_bmn < 0 || ithr_k < 0) {
+            prefetch_hint(prf_size);
+            return;
+        }
         int start {0}, end {0};
         balance211(brgmm_ctx.get_parallel_work_amount_gemm(),
                 brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
+        const size_t prf_step = rnd_up(
+                div_up(prf_size, nstl::max(end - start, 1)),
+                jit_uni_prefetch_t::cache_line_size);
         int kc_start {0}, kc_end {bgmmc.K_chunks};
         if (brgmm_ctx.parallel_reduction_is_used())
             balance211((int)bgmmc.K_chunks, brgmm_ctx.get_num_threads_for_k(),
@@ -684,17 +956,71 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             mc_prev = mc;
             b_prev = b;
 
+            prefetch_hint(prf_step);
             advance_func();
         }
+        prefetch_hint(prf_size);
         if (is_amx) { amx_tile_release(); }
     });
 
     maybe_reduce_and_convert_partial_results_A(brgmm_ctx);
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
+    if (pd()->attr()->post_ops_.find(primitive_kind::rope) != -1)
+        apply_rope_post_op(ctx);
 
     return status::success;
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::apply_rope_post_op(const exec_ctx_t &ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &po = pd()->attr()->post_ops_;
+    const int rope_idx = po.len() - 1;
+    const auto &rope = po.entry_[rope_idx].rope;
+
+    const int arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(rope_idx);
+    const auto cos = CTX_IN_MEM(const float *, arg | DNNL_ARG_SRC_1);
+    const auto sin = CTX_IN_MEM(const float *, arg | DNNL_ARG_SRC_2);
+    const auto pos = CTX_IN_MEM(const int32_t *, arg | DNNL_ARG_SRC_3);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const data_type_t dst_dt = dst_d.data_type();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+    const dim_t N = bgmmc.N;
+    const dim_t rows = dst_d.nelems() / N;
+    const dim_t D = rope.head_size;
+    const dim_t R = rope.rotary_dims;
+    const dim_t half = R / 2;
+    const dim_t heads = N / D;
+    const auto layout = static_cast<rope_layout_t>(rope.layout);
+
+    // Only the rotated part of a head goes through the f32 buffer.
+    float *buf = dst_dt == f32
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<float>(
+                    key_matmul_rope_buf);
+
+    parallel(bgmmc.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(rows, nthr, ithr, start, end);
+        for (dim_t r = start; r < end; r++) {
+            // One position per destination row, e.g. per token.
+            const dim_t p = pos[r];
+            char *row = dst + dst_d.off_l(r * N) * dst_dt_sz;
+            for (dim_t h = 0; h < heads; h++) {
+                char *head = row + h * D * dst_dt_sz;
+                float *x = buf ? buf + ithr * D
+                               : reinterpret_cast<float *>(head);
+                if (buf) rope_utils::load_row(x, head, dst_dt, R);
+                rope_utils::rotate(
+                        x, cos + p * half, sin + p * half, R, layout);
+                if (buf) rope_utils::store_row(head, x, dst_dt, R);
+            }
+        }
+    });
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::compute_kernel(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *A_data_batch_ptr,
@@ -723,8 +1049,6 @@ void brgemm_matmul_t<isa>::compute_kernel(
             = is_last_K_blk && (gemm_batch * bgmmc.K_blk) != remaining_k_blks;
 
     auto is_bs_tail = (gemm_batch != bgmmc.brgemm_batch_size);
-    const int brg_ker_idx = pd()->get_brg_kernel_idx(
-            is_bs_tail, do_init, m_ker_idx, n_ker_idx, false, prefetch);
     const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
     auto ptr_D = brgmm_ctx.get_data_C_ptr(
             b_idx, brgmm_ctx.get_M_idx(m_blk_idx, true), n);
@@ -732,6 +1056,17 @@ void brgemm_matmul_t<isa>::compute_kernel(
             ? brgmm_ctx.get_buf_C_ptr(ithr, m_blk_idx, n_blk_idx)
             : ptr_D;
 
+    // The LoRA update goes to the accumulator before the first K block, the
+    // main kernels accumulate on top of it. With the parallel reduction over
+    // K only the thread owning the first K block adds it.
+    if (bgmmc.with_lora && do_init && k_blk_idx == 0) {
+        apply_lora(brgmm_ctx, b_idx, m_blk_idx, n_blk_idx, ptr_C);
+        do_init = false;
+    }
+
+    const int brg_ker_idx = pd()->get_brg_kernel_idx(
+            is_bs_tail, do_init, m_ker_idx, n_ker_idx, false, prefetch);
+
     const auto zp_comp_a
             = brgmm_ctx.get_zp_a_compensation_ptr(ithr, b_idx, n_blk_idx);
     const auto zp_comp_b
@@ -739,8 +1074,13 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const auto zp_c_val_ptr = brgmm_ctx.get_zp_c_val_ptr();
     const auto &post_ops_binary_rhs_arg_vec
             = brgmm_ctx.get_post_ops_binary_rhs_arg_vec();
+    const bool is_K_reduction_complete
+            = brgmm_ctx.get_num_threads_for_k() <= 1 || bgmmc.K_chunks == 1;
+    // The post-ops of a split or dynamically quantized destination are
+    // applied by its store kernels.
     const bool post_ops_applicable = bgmmc.post_ops_applicable
-            && (brgmm_ctx.get_num_threads_for_k() <= 1 || bgmmc.K_chunks == 1);
+            && !bgmmc.with_dst_split && !bgmmc.with_dst_dyn_quant
+            && is_K_reduction_complete;
 
     brgemm_dynamic_values_t leading_dimensions(
             bgmmc.LDA, bgmmc.LDB, brgmm_ctx.get_LDC(), brgmm_ctx.get_LDD());
@@ -856,6 +1196,12 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 /* do_K_tail */ true);
     }
 
+    if (bgmmc.with_dst_split && is_last_K_blk && is_K_reduction_complete)
+        store_dst_split(brgmm_ctx, b_idx, m_blk_idx, n_blk_idx, ptr_C);
+    if (bgmmc.with_dst_dyn_quant && is_last_K_blk && is_K_reduction_complete)
+        store_dst_dyn_quant(
+                brgmm_ctx, ithr, b_idx, m_blk_idx, n_blk_idx, ptr_C);
+
     brgmm_ctx.maybe_restore_dst_values_from_buffer(
             ithr, b_idx, m_blk_idx, n_blk_idx);
 }
@@ -1113,6 +1459,15 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                         auto ptr_D = brgmm_ctx.get_data_C_ptr(b, m, n);
                         auto ptr_C = brgmm_ctx.get_buf_C_par_reduction_ptr(
                                 0, mb, nb);
+                        if (bgmmc.with_dst_split) {
+                            store_dst_split(brgmm_ctx, b, mb, nb, ptr_C);
+                            continue;
+                        }
+                        if (bgmmc.with_dst_dyn_quant) {
+                            store_dst_dyn_quant(
+                                    brgmm_ctx, ithr, b, mb, nb, ptr_C);
+                            continue;
+                        }
 
                         // TODO: support reduction for zp/s8s8 compensations
                         // computed in copy routines
@@ -1190,6 +1545,19 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
 
+    if (bgmmc.with_src_norm) {
+        for (int gb = 0; gb < gemm_batch_iters + is_K_tail; gb++) {
+            const int k = k_start + gb * bgmmc.K_blk;
+            copy_a_block_with_src_norm(brgmm_ctx,
+                    brgmm_ctx.get_data_A_mk_ptr(A_data_batch_ptr, m, k),
+                    brgmm_ctx.get_buf_A_ptr(ithr, m_blk_idx, k_blk_idx, gb),
+                    ctx.current_M_blk, k,
+                    gb < gemm_batch_iters ? nstl::min(bgmmc.K_blk, bgmmc.K)
+                                          : bgmmc.K % bgmmc.K_blk);
+        }
+        return;
+    }
+
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
         ctx.src = (void *)brgmm_ctx.get_data_A_mk_ptr(A_data_batch_ptr, m, k);
@@ -1213,6 +1581,247 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::compute_src_norm_stats(
+        const brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &src_norm = pd()->attr()->src_norm_;
+    const data_type_t src_dt = bgmmc.orig_src_dt;
+    const dim_t K = bgmmc.K;
+    const dim_t rows = memory_desc_wrapper(pd()->src_md()).nelems() / K;
+
+    const char *src = brgmm_ctx.get_data_A_ptr();
+    const float *mean = brgmm_ctx.get_src_norm_mean_ptr();
+    const float *variance = brgmm_ctx.get_src_norm_variance_ptr();
+    float *stats = brgmm_ctx.get_src_norm_stats_ptr();
+
+    parallel_nd(rows, [&](dim_t r) {
+        float row_mean = 0.f, row_var = 0.f;
+        if (src_norm.use_global_stats()) {
+            row_mean = src_norm.rms_norm() ? 0.f : mean[r];
+            row_var = variance[r];
+        } else {
+            const char *row = src + r * K * bgmmc.a_dt_sz;
+            if (!src_norm.rms_norm()) {
+                for (dim_t k = 0; k < K; k++)
+                    row_mean += cpu::io::load_float_value(src_dt, row, k);
+                row_mean /= K;
+            }
+            for (dim_t k = 0; k < K; k++) {
+                const float v
+                        = cpu::io::load_float_value(src_dt, row, k) - row_mean;
+                row_var += v * v;
+            }
+            row_var /= K;
+        }
+        stats[2 * r] = row_mean;
+        stats[2 * r + 1] = 1.f / sqrtf(row_var + src_norm.epsilon_);
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::copy_a_block_with_src_norm(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, const char *src, char *tr_src,
+        int M_blk, int k, int K_blk) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &src_norm = pd()->attr()->src_norm_;
+    const float *scale = brgmm_ctx.get_src_norm_scale_ptr();
+    const float *shift = brgmm_ctx.get_src_norm_shift_ptr();
+    const float *stats = brgmm_ctx.get_src_norm_stats_ptr();
+    const data_type_t src_dt = bgmmc.orig_src_dt;
+
+    // The source is dense and plain, so the position of the block in it
+    // defines the row its statistics belong to.
+    const dim_t row_sz = bgmmc.K * bgmmc.a_dt_sz;
+    const dim_t r0 = (src - brgmm_ctx.get_data_A_ptr()) / row_sz;
+
+    for (int m = 0; m < M_blk; m++) {
+        const char *row = src + m * row_sz;
+        char *tr_row = tr_src + m * bgmmc.LDA * bgmmc.tr_a_dt_sz;
+        const float mean = stats[2 * (r0 + m)];
+        const float rstd = stats[2 * (r0 + m) + 1];
+        for (int kk = 0; kk < K_blk; kk++) {
+            float v = (cpu::io::load_float_value(src_dt, row, kk) - mean)
+                    * rstd;
+            if (src_norm.use_scale()) v *= scale[k + kk];
+            if (src_norm.use_shift()) v += shift[k + kk];
+            cpu::io::store_float_value(bgmmc.src_dt, v, tr_row, kk);
+        }
+        // Zero padding of the block keeps the extra K elements from
+        // contributing to the result.
+        std::memset(tr_row + K_blk * bgmmc.tr_a_dt_sz, 0,
+                (bgmmc.LDA - K_blk) * bgmmc.tr_a_dt_sz);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::compute_lora_t(
+        const brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &lora = pd()->attr()->lora_;
+    const data_type_t src_dt = bgmmc.orig_src_dt;
+    const dim_t K = bgmmc.K;
+    const dim_t R = lora.rank_;
+    const dim_t rows = bgmmc.batch * bgmmc.M;
+
+    const char *src = brgmm_ctx.get_data_A_ptr();
+    const float *lora_a = brgmm_ctx.get_lora_a_ptr();
+    const int32_t *indices = brgmm_ctx.get_lora_indices_ptr();
+    float *lora_t = brgmm_ctx.get_lora_t_ptr();
+
+    // A row of T is zero but for the columns of the adapter of the row, so
+    // the update of a block of rows is a single GEMM with the stacked B
+    // matrices of all the adapters.
+    parallel_nd(rows, [&](dim_t r) {
+        float *t_row = lora_t + r * bgmmc.lora_K;
+        std::memset(t_row, 0, bgmmc.lora_K * sizeof(float));
+        const dim_t a = lora.with_indices() ? indices[r] : 0;
+        if (a < 0 || a >= lora.num_adapters_) return;
+
+        const char *row = src + r * K * bgmmc.a_dt_sz;
+        const float *A = lora_a + a * K * R;
+        float *t = t_row + a * R;
+        for (dim_t k = 0; k < K; k++) {
+            const float x = cpu::io::load_float_value(src_dt, row, k);
+            const float *A_k = A + k * R;
+            PRAGMA_OMP_SIMD()
+            for (dim_t j = 0; j < R; j++)
+                t[j] += x * A_k[j];
+        }
+        for (dim_t j = 0; j < R; j++)
+            t[j] *= lora.alpha_;
+    });
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::apply_lora(const brg_matmul_exec_ctx_t &brgmm_ctx,
+        int b_idx, int m_blk_idx, int n_blk_idx, char *ptr_C) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const dim_t m = brgmm_ctx.get_M_idx(m_blk_idx, true);
+    const dim_t n = brgmm_ctx.get_N_idx(n_blk_idx, true);
+    const int m_ker_idx = brgmm_ctx.get_M_kernel_idx(m_blk_idx);
+    const dim_t n_size = brgmm_ctx.get_N_kernel_size(n_blk_idx);
+    const dim_t n_blk = pd()->lora_n_blk();
+    const dim_t panel_sz = bgmmc.M_blk * bgmmc.LDC * bgmmc.acc_dt_sz;
+
+    brgemm_batch_element_t batch;
+    batch.ptr.A = brgmm_ctx.get_lora_t_ptr()
+            + (b_idx * bgmmc.M + m) * bgmmc.lora_K;
+    batch.vvpad.top = 0;
+    batch.vvpad.bottom = 0;
+    for (dim_t nn = 0; nn < n_size; nn += n_blk) {
+        const int idx = pd()->get_lora_kernel_idx(
+                m_ker_idx, nstl::min(n_blk, n_size - nn));
+        assert(idx >= 0);
+        batch.ptr.B = brgmm_ctx.get_lora_b_ptr() + n + nn;
+        brgemm_kernel_execute(lora_kernels_[idx].get(), 1, &batch,
+                ptr_C + (nn / n_blk) * panel_sz);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::store_dst_split(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int b_idx, int m_blk_idx,
+        int n_blk_idx, const char *ptr_C) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const dim_t m = brgmm_ctx.get_M_idx(m_blk_idx, true);
+    const dim_t n = brgmm_ctx.get_N_idx(n_blk_idx, true);
+    dim_t n_off = 0;
+    const int i_dst = pd()->get_dst_split_idx(n, n_off);
+    const int idx = pd()->get_dst_split_kernel_idx(i_dst,
+            brgmm_ctx.get_M_kernel_idx(m_blk_idx),
+            brgmm_ctx.get_N_kernel_idx(n_blk_idx));
+    const auto kernel = dst_split_kernels_[idx].get();
+    assert(kernel != nullptr);
+
+    // The batch indices of the tensor are those of the destination. The
+    // columns of a tensor with heads are split between the heads.
+    const memory_desc_wrapper mdw(pd()->attr()->dst_split_.dsts_[i_dst]);
+    const int ndims = mdw.ndims();
+    dims_t pos {};
+    dim_t b = b_idx;
+    for (int d = bgmmc.batch_ndims - 1; d >= 0; d--) {
+        pos[d] = b % mdw.dims()[d];
+        b /= mdw.dims()[d];
+    }
+    const dim_t D = mdw.dims()[ndims - 1];
+    if (ndims > bgmmc.ndims) pos[ndims - 3] = (n - n_off) / D;
+    pos[ndims - 2] = m;
+    pos[ndims - 1] = (n - n_off) % D;
+    char *ptr_D = brgmm_ctx.get_dst_split_ptr(i_dst)
+            + mdw.off_v(pos) * mdw.data_type_size();
+
+    const brgemm_post_ops_data_t post_ops_data {
+            static_cast<const void *>(brgmm_ctx.get_bias_ptr(n)), nullptr,
+            static_cast<size_t>(n), static_cast<size_t>(m), nullptr, 0,
+            nullptr, nullptr, nullptr, /* skip_accumulation = */ true, 1,
+            false, false, brgmm_ctx.get_src_scales_ptr(),
+            brgmm_ctx.get_wei_scales_ptr(n),
+            brgmm_ctx.get_dst_split_scales_inv_ptr(i_dst)};
+    const auto &brg = pd()->get_dst_split_desc(idx);
+    if (!brg.are_post_ops_applicable())
+        copy_accumulator(brg, ptr_C, ptr_D);
+    else
+        brgemm_kernel_execute_postops(kernel, 0, nullptr,
+                const_cast<char *>(ptr_C), ptr_D, post_ops_data);
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::store_dst_dyn_quant(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
+        int m_blk_idx, int n_blk_idx, const char *ptr_C) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const dim_t m = brgmm_ctx.get_M_idx(m_blk_idx, true);
+    const dim_t n = brgmm_ctx.get_N_idx(n_blk_idx, true);
+    const int idx = pd()->get_dst_dyn_quant_kernel_idx(
+            brgmm_ctx.get_M_kernel_idx(m_blk_idx),
+            brgmm_ctx.get_N_kernel_idx(n_blk_idx));
+    const auto kernel = dst_dyn_quant_kernels_[idx].get();
+    assert(kernel != nullptr);
+
+    float *buf = brgmm_ctx.get_dst_dyn_quant_buf_ptr(ithr);
+    const brgemm_post_ops_data_t post_ops_data {
+            static_cast<const void *>(brgmm_ctx.get_bias_ptr(n)), nullptr,
+            static_cast<size_t>(n), static_cast<size_t>(m), nullptr, 0,
+            nullptr, nullptr, nullptr, /* skip_accumulation = */ true, 1,
+            false, false, brgmm_ctx.get_src_scales_ptr(),
+            brgmm_ctx.get_wei_scales_ptr(n), nullptr};
+    const auto &brg = pd()->get_dst_dyn_quant_desc(idx);
+    if (!brg.are_post_ops_applicable())
+        copy_accumulator(brg, ptr_C, reinterpret_cast<char *>(buf));
+    else
+        brgemm_kernel_execute_postops(kernel, 0, nullptr,
+                const_cast<char *>(ptr_C), buf, post_ops_data);
+
+    // The block is hot in cache: every group is read once to find its
+    // absolute maximum and once more to be quantized.
+    const auto &dst_scales = pd()->attr()->scales_.get(DNNL_ARG_DST);
+    const dim_t G = dst_scales.get_group(-1);
+    const data_type_t scales_dt = dst_scales.get_data_type();
+    const float dst_max = types::max_value<float>(bgmmc.dst_dt);
+    const dim_t M_blk = brgmm_ctx.get_M_kernel_size(m_blk_idx);
+    const dim_t N_blk = brgmm_ctx.get_N_kernel_size(n_blk_idx);
+    for (dim_t i = 0; i < M_blk; i++) {
+        const float *row = buf + i * bgmmc.N_blk;
+        char *ptr_D = brgmm_ctx.get_data_C_ptr(b_idx, m + i, n);
+        const dim_t scales_off = ((b_idx * bgmmc.M + m + i) * bgmmc.N + n) / G;
+        for (dim_t g = 0; g < N_blk / G; g++) {
+            const float *vals = row + g * G;
+            float absmax = 0.f;
+            for (dim_t j = 0; j < G; j++)
+                absmax = nstl::max(absmax, std::fabs(vals[j]));
+            const float scale
+                    = types::round_to_dt(scales_dt, absmax / dst_max);
+            io::store_float_value(scales_dt, scale,
+                    brgmm_ctx.get_dst_dyn_scales_ptr(), scales_off + g);
+            const float scale_inv = scale > 0.f ? 1.f / scale : 0.f;
+            for (dim_t j = 0; j < G; j++)
+                io::store_float_value(
+                        bgmmc.dst_dt, vals[j] * scale_inv, ptr_D, g * G + j);
+        }
+    }
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *B_data_batch_ptr,
@@ -1359,10 +1968,22 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         const memory_desc_wrapper weights_d(pd->weights_md(0));
         if (bgmmc_.packed_sparse_weights) {
-            data_B_offsets_ptr_
-                    = CTX_IN_MEM(const int64_t *, DNNL_ARG_WEIGHTS, 1);
-            data_B_bitmask_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 2);
             B_packed_sparse_block_size_ = weights_d.blk_size();
+            if (weights_d.is_sparse_structured_desc()) {
+                // Each block keeps the same number of elements, so the
+                // offsets are implied by the block number.
+                const auto &sparse_desc = weights_d.sparse_desc();
+                data_B_offsets_ptr_ = nullptr;
+                data_B_bitmask_ptr_
+                        = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 1);
+                B_structured_sparse_block_nnz_ = B_packed_sparse_block_size_
+                        / sparse_desc.structured_m * sparse_desc.structured_n;
+            } else {
+                data_B_offsets_ptr_
+                        = CTX_IN_MEM(const int64_t *, DNNL_ARG_WEIGHTS, 1);
+                data_B_bitmask_ptr_
+                        = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 2);
+            }
         }
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
@@ -1434,6 +2055,48 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                         key_brgemm_primitive_buffer_reduce)
                 : nullptr;
 
+        src_norm_mean_
+                = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_MEAN);
+        src_norm_variance_
+                = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_VARIANCE);
+        src_norm_scale_
+                = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SCALE);
+        src_norm_shift_
+                = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SRC_NORM_SHIFT);
+        src_norm_stats_ = bgmmc.with_src_norm
+                ? scratchpad.template get<float>(key_matmul_src_norm_stats)
+                : nullptr;
+
+        lora_a_ = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_LORA_A);
+        lora_b_ = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_LORA_B);
+        lora_indices_
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_LORA_INDICES);
+        lora_t_ = bgmmc.with_lora
+                ? scratchpad.template get<float>(key_matmul_lora_t)
+                : nullptr;
+
+        prefetch_hint_ = CTX_IN_MEM(const char *, DNNL_ARG_PREFETCH_HINT);
+        prefetch_hint_size_ = prefetch_hint_
+                ? ctx.memory_mdw(DNNL_ARG_PREFETCH_HINT).size()
+                : 0;
+
+        const auto &dst_split = pd->attr()->dst_split_;
+        for (int i = 0; i < dst_split.ndsts(); i++) {
+            const int arg = DNNL_ARG_MULTIPLE_DST + i;
+            dst_split_ptrs_[i] = CTX_OUT_MEM(char *, arg);
+            const float *scales
+                    = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | arg);
+            dst_split_scales_inv_[i] = scales ? 1.f / scales[0] : 1.f;
+        }
+
+        // The destination scales of dynamic quantization are an output.
+        dst_dyn_scales_ = bgmmc.with_dst_dyn_quant
+                ? CTX_OUT_MEM(void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                : nullptr;
+        dst_dyn_quant_buf_ = bgmmc.with_dst_dyn_quant
+                ? scratchpad.template get<float>(key_matmul_dst_dyn_quant_buf)
+                : nullptr;
+
         is_amx_ = is_superset(isa, avx512_core_amx);
         wsp_tile_ptr_ = is_amx_
                 ? ctx.get_scratchpad_grantor().template get<char>(
@@ -1771,7 +2434,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (bgmmc_.packed_sparse_weights) {
             const dim_t blk_num
                     = (b_ptr - data_B_ptr_) / B_packed_sparse_block_size_;
-            const auto blk_off = data_B_offsets_ptr_[blk_num];
+            const auto blk_off = data_B_offsets_ptr_
+                    ? data_B_offsets_ptr_[blk_num]
+                    : blk_num * B_structured_sparse_block_nnz_;
             return data_B_ptr_ + blk_off;
         }
         return b_ptr;
@@ -2025,6 +2690,37 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return buf_reduce_ptr_ + _off * bgmmc_.acc_dt_sz;
     }
 
+    const char *get_data_A_ptr() const { return data_A_ptr_; }
+
+    const float *get_src_norm_mean_ptr() const { return src_norm_mean_; }
+    const float *get_src_norm_variance_ptr() const {
+        return src_norm_variance_;
+    }
+    const float *get_src_norm_scale_ptr() const { return src_norm_scale_; }
+    const float *get_src_norm_shift_ptr() const { return src_norm_shift_; }
+    // Returns per-row [mean, 1 / sqrt(variance + epsilon)] pairs.
+    float *get_src_norm_stats_ptr() const { return src_norm_stats_; }
+
+    const float *get_lora_a_ptr() const { return lora_a_; }
+    const float *get_lora_b_ptr() const { return lora_b_; }
+    const int32_t *get_lora_indices_ptr() const { return lora_indices_; }
+
+    const char *get_prefetch_hint_ptr() const { return prefetch_hint_; }
+    size_t get_prefetch_hint_size() const { return prefetch_hint_size_; }
+    // Returns the `batch * M x lora_K` f32 matrix of the LoRA A products.
+    float *get_lora_t_ptr() const { return lora_t_; }
+
+    char *get_dst_split_ptr(int i) const { return dst_split_ptrs_[i]; }
+    const float *get_dst_split_scales_inv_ptr(int i) const {
+        return &dst_split_scales_inv_[i];
+    }
+
+    void *get_dst_dyn_scales_ptr() const { return dst_dyn_scales_; }
+    // Returns the `M_blk x N_blk` f32 buffer of thread @p ithr.
+    float *get_dst_dyn_quant_buf_ptr(int ithr) const {
+        return dst_dyn_quant_buf_ + ithr * bgmmc_.M_blk * bgmmc_.N_blk;
+    }
+
     const char *get_bias_ptr(int n) const {
         if (!bgmmc_.with_bias) return nullptr;
 
@@ -2490,12 +3186,16 @@ private:
     const char *data_A_ptr_;
     const char *data_B_ptr_;
     // The offsets and bitmask pointers are only available when the weights
-    // are sparse and packed.
+    // are sparse and packed. The offsets are not available for the
+    // structured encoding.
     const dim_t *data_B_offsets_ptr_;
     const char *data_B_bitmask_ptr_;
     // The size of a packed saprse block. E.g. the block
     // for a tag 'BA16a64b4a' is 4096.
     int B_packed_sparse_block_size_;
+    // The number of packed elements in each block for the structured
+    // encoding.
+    dim_t B_structured_sparse_block_nnz_;
 
     char *data_C_ptr_;
     char *data_reduce_ptr_;
@@ -2507,6 +3207,25 @@ private:
     char *buf_D_ptr_;
     char *buf_reduce_ptr_;
 
+    const float *src_norm_mean_;
+    const float *src_norm_variance_;
+    const float *src_norm_scale_;
+    const float *src_norm_shift_;
+    float *src_norm_stats_;
+
+    const float *lora_a_;
+    const float *lora_b_;
+    const int32_t *lora_indices_;
+    const char *prefetch_hint_;
+    size_t prefetch_hint_size_;
+    float *lora_t_;
+
+    char *dst_split_ptrs_[dst_split_t::max_ndsts] = {};
+    float dst_split_scales_inv_[dst_split_t::max_ndsts] = {};
+
+    void *dst_dyn_scales_;
+    float *dst_dyn_quant_buf_;
+
     char *wsp_tile_ptr_;
     const char *bias_ptr_;
     const void *src_scales_;
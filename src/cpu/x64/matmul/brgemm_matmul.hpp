@@ -29,6 +29,7 @@
 #include "cpu/x64/cpu_reducer.hpp"
 #include "cpu/x64/jit_avx512_sparse_decompress_kernel.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
+#include "cpu/x64/jit_uni_prefetch.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 
@@ -48,6 +49,13 @@ constexpr int max_num_brg_kernels_matmul = 2 * 2 * 2
         * (max_num_dynamic_n_tails + 1 /* main kernel size */)
         * (max_num_dynamic_m_tails + 1 /* main kernel size */)
         * 2; //prefetching on/off
+// LoRA kernels: {M block, M tail} x {N panel, N block tail, N tail}.
+constexpr int max_num_lora_kernels = 2 * 3;
+// Split destination store kernels: {tensor} x {M block, M tail} x
+// {N block, N tail}.
+constexpr int max_num_dst_split_kernels = dst_split_t::max_ndsts * 2 * 2;
+// Dynamic quantization store kernels: {M block, M tail} x {N block, N tail}.
+constexpr int max_num_dst_dyn_quant_kernels = 2 * 2;
 
 template <cpu_isa_t isa>
 struct brgemm_matmul_t : public primitive_t {
@@ -58,6 +66,10 @@ struct brgemm_matmul_t : public primitive_t {
                 JIT_IMPL_NAME_HELPER("brg_matmul:", isa, ""), brgemm_matmul_t);
 
         status_t init(engine_t *engine);
+        arg_usage_t arg_usage(int arg) const override {
+            if (arg == DNNL_ARG_PREFETCH_HINT) return arg_usage_t::input;
+            return cpu_matmul_pd_t::arg_usage(arg);
+        }
         int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
                 int m_ker_idx, int n_ker_idx, bool is_K_tail,
                 bool is_prefetching) const;
@@ -67,9 +79,50 @@ struct brgemm_matmul_t : public primitive_t {
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
         }
+        // Returns the index of the LoRA kernel updating `n` columns of an M
+        // block, or -1 if there is no such kernel.
+        int get_lora_kernel_idx(int m_ker_idx, dim_t n) const;
+        const brgemm_desc_t &get_lora_desc(int idx) const {
+            return lora_descs_[idx];
+        }
+        // The LoRA kernels write the accumulator by panels of `lora_n_blk`
+        // columns, following the layout of the C buffer.
+        dim_t lora_n_blk() const { return lora_n_[0]; }
+        static int get_dst_split_kernel_idx(
+                int i_dst, int m_ker_idx, int n_ker_idx) {
+            return (i_dst * 2 + m_ker_idx) * 2 + n_ker_idx;
+        }
+        const brgemm_desc_t &get_dst_split_desc(int idx) const {
+            return dst_split_descs_[idx];
+        }
+        // Returns the split destination tensor holding column `n` and sets
+        // `n_off` to the first column of the tensor.
+        int get_dst_split_idx(dim_t n, dim_t &n_off) const;
+        static int get_dst_dyn_quant_kernel_idx(int m_ker_idx, int n_ker_idx) {
+            return m_ker_idx * 2 + n_ker_idx;
+        }
+        const brgemm_desc_t &get_dst_dyn_quant_desc(int idx) const {
+            return dst_dyn_quant_descs_[idx];
+        }
 
     private:
+        status_t init_lora_descs();
+        // Initializes the kernels storing `M x N` blocks of the accumulator to
+        // the split destination tensors.
+        status_t init_dst_split_descs(cpu_isa_t kernel_isa, dim_t LDA,
+                dim_t M, dim_t N, dim_t K, const brgemm_attr_t &base_attr,
+                const primitive_attr_t &kernel_attr, int i_M, int i_N);
+        // Initializes the kernel storing `M x N` blocks of the accumulator
+        // with the post-ops to the f32 buffer of dynamic quantization.
+        status_t init_dst_dyn_quant_desc(cpu_isa_t kernel_isa, dim_t LDA,
+                dim_t M, dim_t N, dim_t K, const brgemm_attr_t &base_attr,
+                const primitive_attr_t &kernel_attr, int i_M, int i_N);
+
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
+        brgemm_desc_t lora_descs_[max_num_lora_kernels];
+        brgemm_desc_t dst_split_descs_[max_num_dst_split_kernels];
+        brgemm_desc_t dst_dyn_quant_descs_[max_num_dst_dyn_quant_kernels];
+        dim_t lora_n_[max_num_lora_kernels / 2] = {0, 0, 0};
         brgemm_matmul_conf_t bgmmc_;
 
         /**
@@ -106,11 +159,34 @@ private:
     void copy_a_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *A_data_batch_ptr, int ithr, int m_blk_idx,
             int k_blk_idx) const;
+    // Computes the mean and the reciprocal standard deviation of every row of
+    // the source for source normalization.
+    void compute_src_norm_stats(const brg_matmul_exec_ctx_t &brgmm_ctx) const;
+    // Writes a normalized block of `M_blk x K_blk` source elements starting
+    // at `src` to the A buffer `tr_src`.
+    void copy_a_block_with_src_norm(const brg_matmul_exec_ctx_t &brgmm_ctx,
+            const char *src, char *tr_src, int M_blk, int k, int K_blk) const;
+    // Computes alpha * (src * A_i) for every source row, placed in the
+    // columns of its adapter i.
+    void compute_lora_t(const brg_matmul_exec_ctx_t &brgmm_ctx) const;
+    // Initializes the accumulator of a block with the LoRA update.
+    void apply_lora(const brg_matmul_exec_ctx_t &brgmm_ctx, int b_idx,
+            int m_blk_idx, int n_blk_idx, char *ptr_C) const;
+    // Applies the post-ops to a block of the accumulator and stores it to
+    // the split destination tensor its columns belong to.
+    void store_dst_split(const brg_matmul_exec_ctx_t &brgmm_ctx, int b_idx,
+            int m_blk_idx, int n_blk_idx, const char *ptr_C) const;
+    // Applies the post-ops to a block of the accumulator, computes the
+    // destination scales of its rows and stores the quantized values.
+    void store_dst_dyn_quant(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
+            int b_idx, int m_blk_idx, int n_blk_idx, const char *ptr_C) const;
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
+    // Rotates the heads of the destination rows by the trailing RoPE post-op.
+    void apply_rope_post_op(const exec_ctx_t &ctx) const;
     void maybe_reduce_A(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
             int gemm_batch, int m_blk_idx, int n_blk_idx, int k_chunk_idx,
             bool do_init, bool has_K_tail, bool do_K_tail) const;
@@ -120,6 +196,11 @@ private:
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
     std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    std::unique_ptr<brgemm_kernel_t> lora_kernels_[max_num_lora_kernels];
+    std::unique_ptr<brgemm_kernel_t>
+            dst_split_kernels_[max_num_dst_split_kernels];
+    std::unique_ptr<brgemm_kernel_t>
+            dst_dyn_quant_kernels_[max_num_dst_dyn_quant_kernels];
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
@@ -127,6 +208,8 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+    // Prefetches the memory passed with DNNL_ARG_PREFETCH_HINT.
+    std::unique_ptr<jit_uni_prefetch_t> prefetch_kernel_;
     std::unique_ptr<jit_avx512_sparse_decompress_kernel_t>
             sparse_decompress_kernel_;
 
@@ -416,6 +416,18 @@ bool is_gemv_applicable(const brgemm_matmul_conf_t &bgmmc,
     // Reduction is not supported for GEMV code path.
     if (bgmmc.with_reduce) return false;
 
+    // Source normalization requires the copy of A.
+    if (bgmmc.with_src_norm) return false;
+
+    // The LoRA update is accumulated by separate brgemm kernels.
+    if (bgmmc.with_lora) return false;
+
+    // The split destination is stored from the C buffer.
+    if (bgmmc.with_dst_split) return false;
+
+    // So is the dynamically quantized one.
+    if (bgmmc.with_dst_dyn_quant) return false;
+
     // BRGEMV currently supports only f32 and AVX2.
     if (utils::one_of(false, bm_conf_utils.is_f32(), bgmmc.isa == avx2))
         return false;
@@ -1293,6 +1305,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.reduce_dt
             = bgmmc.with_reduce ? mmd.reduce_desc.data_type : data_type::undef;
     bgmmc.reduce_kind = mmd.reduce_kind;
+    bgmmc.with_src_norm = !attr.src_norm_.has_default_values();
+    bgmmc.with_lora = !attr.lora_.has_default_values();
+    bgmmc.lora_K = attr.lora_.rank_ * attr.lora_.num_adapters_;
+    bgmmc.with_dst_split = !attr.dst_split_.has_default_values();
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
@@ -1304,7 +1320,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             = brgemm_kernel_hint_mem_advice_t::brgemm_hint_mem_advice_undef;
 
     const bool is_wei_any = weights_d.format_kind() == format_kind::any
-            || weights_d.is_sparse_packed_desc();
+            || weights_d.is_sparse_packed_desc()
+            || weights_d.is_sparse_structured_desc();
     brgemm_matmul_conf_utils_t bm_conf_utils(bgmmc, isa, attr,
             src_d.format_kind() == format_kind::any, is_wei_any,
             dst_d.format_kind() == format_kind::any,
@@ -1318,11 +1335,20 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
 
-    bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
+    // The structured encoding shares the storage schema with the packed one
+    // and is decompressed by the same kernel.
+    bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc()
+            || weights_d.is_sparse_structured_desc();
     if (bgmmc.packed_sparse_weights) {
         VCONDCHECK_BG(bgmmc.is_amx, VERBOSE_ISA_SPARSE_ENCODING_MISMATCH);
         VCONDCHECK_BG(bgmmc.wei_dt == s8, VERBOSE_UNSUPPORTED_DT);
     }
+    if (weights_d.is_sparse_structured_desc()) {
+        // A group must not cross the K-block of the blocked layout.
+        const dim_t m = weights_d.sparse_desc().structured_m;
+        VCONDCHECK_BG(
+                m <= 64 && 64 % m == 0, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    }
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
     bgmmc.is_tf32 = bm_conf_utils.is_tf32();
     bgmmc.is_bf16_with_int_wei = bm_conf_utils.is_bf16_with_int_wei();
@@ -1401,7 +1427,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     }
 
     const auto &dst_scales = attr.scales_.get(DNNL_ARG_DST);
-    bgmmc.with_dst_scales = !dst_scales.has_default_values();
+    bgmmc.with_dst_dyn_quant = dst_scales.get_quantization_mode()
+            == quantization_mode::dynamic_fp;
+    bgmmc.with_dst_scales
+            = !dst_scales.has_default_values() && !bgmmc.with_dst_dyn_quant;
     // only common scales are supported
     VCONDCHECK_BG(!(bgmmc.with_dst_scales && dst_scales.get_mask() > 0),
             VERBOSE_UNSUPPORTED_SCALES_CFG);
@@ -1555,6 +1584,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     const bool merge_batch_dims_into_M = bgmmc.batch > 1
             && bgmmc.bcast_B_desc.bcast_across_all_batch_dims && plain_A_layout
             && helper.is_src_dst_layout_batch_fusable()
+            && !bgmmc.with_dst_split
             && post_ops_ok(
                     bgmmc, attr, dst_d, true /* limit_bcast_strategies_set */);
     if (merge_batch_dims_into_M) {
@@ -1618,6 +1648,65 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                 VERBOSE_UNSUPPORTED_MEM_STRIDE);
     }
 
+    if (bgmmc.with_src_norm) {
+        // Rows of A are normalized by the copy routine, which expects a dense
+        // plain source with a known shape.
+        VCONDCHECK_BG(bm_conf_utils.check_is_plain(bgmmc.src_tag)
+                        && !bgmmc.transposed_A && src_d.is_dense(),
+                VERBOSE_UNSUPPORTED_TAG);
+        VCONDCHECK_BG(!bgmmc.is_runtime_M && !bgmmc.is_runtime_K,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.with_reduce, VERBOSE_UNSUPPORTED_FEATURE,
+                "reduction with source normalization");
+    }
+
+    if (bgmmc.with_lora) {
+        // The update is computed from the rows of a dense plain source, one
+        // per destination row, and is added to an f32 accumulator before
+        // anything but the weights scales applied in the B buffer.
+        VCONDCHECK_BG(bm_conf_utils.check_is_plain(bgmmc.src_tag)
+                        && !bgmmc.transposed_A && src_d.is_dense()
+                        && src_d.nelems() == bgmmc.batch * bgmmc.M * bgmmc.K,
+                VERBOSE_UNSUPPORTED_TAG);
+        VCONDCHECK_BG(!bgmmc.is_runtime_M && !bgmmc.is_runtime_N
+                        && !bgmmc.is_runtime_K,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.with_reduce, VERBOSE_UNSUPPORTED_FEATURE,
+                "reduction with LoRA");
+        VCONDCHECK_BG(bgmmc.acc_dt == f32 && !bgmmc.with_src_scales
+                        && IMPLICATION(bgmmc.with_wei_scales,
+                                bgmmc.apply_scales_in_buffer_b)
+                        && bgmmc.src_zp_type == brgemm_broadcast_t::none
+                        && IMPLICATION(
+                                bgmmc.wei_zp_type != brgemm_broadcast_t::none,
+                                bgmmc.with_wei_decompression),
+                VERBOSE_UNSUPPORTED_ATTR);
+    }
+
+    if (bgmmc.with_dst_split) {
+        // Every tensor is written by rows, with its columns (or the elements
+        // of its heads) dense.
+        for (const auto &md : attr.dst_split_.dsts_) {
+            const memory_desc_wrapper mdw(md);
+            VCONDCHECK_BG(mdw.is_plain()
+                            && mdw.blocking_desc().strides[mdw.ndims() - 1]
+                                    == 1,
+                    VERBOSE_UNSUPPORTED_TAG);
+        }
+        VCONDCHECK_BG(!bgmmc.is_runtime_M && !bgmmc.is_runtime_N,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.with_reduce, VERBOSE_UNSUPPORTED_FEATURE,
+                "reduction with destination split");
+    }
+
+    if (bgmmc.with_dst_dyn_quant) {
+        VCONDCHECK_BG(!bgmmc.is_runtime_M && !bgmmc.is_runtime_N,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.with_reduce && !bgmmc.with_dst_split,
+                VERBOSE_UNSUPPORTED_FEATURE,
+                "reduction or destination split with dynamic quantization");
+    }
+
     const bool is_copy_a_required = !bgmmc.is_gemv
             && ((bgmmc.is_amx
                         && (bm_conf_utils.is_bf32() || bm_conf_utils.is_tf32()))
@@ -1626,7 +1715,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                             && isa == avx512_core_fp16)
                     || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
                             && !bm_conf_utils.with_weights_decompression())
-                    || bgmmc.transposed_A);
+                    || bgmmc.transposed_A || bgmmc.with_src_norm);
 
     bgmmc.use_buffer_a = is_copy_a_required;
 
@@ -1682,6 +1771,44 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
 
+    if (bgmmc.with_src_norm) {
+        // The normalized source always goes through the whole A buffer,
+        // regardless of the choice made by the blocking heuristic.
+        bgmmc.use_buffer_a = true;
+        bgmmc.use_buffer_a_tail_only = false;
+        bgmmc.use_fused_copy_a = false;
+        const dim_t elems_in_cacheline = 64 / bgmmc.tr_a_dt_sz;
+        bgmmc.LDA = rnd_up(bgmmc.K_blk, elems_in_cacheline);
+        if (bgmmc.LDA >= 512 && math::is_pow2(bgmmc.LDA))
+            bgmmc.LDA += elems_in_cacheline;
+    }
+
+    if (bgmmc.with_dst_split) {
+        // The accumulator always goes through the C buffer. A block of N_blk
+        // columns is stored by a single kernel, so it must not cross the
+        // boundary of a tensor or of a head.
+        bgmmc.use_buffer_c = true;
+        dim_t n_off = 0;
+        for (const auto &md : attr.dst_split_.dsts_) {
+            const bool with_heads = md.ndims > bgmmc.ndims;
+            const dim_t D = md.dims[md.ndims - 1];
+            VCONDCHECK_BG(n_off % bgmmc.N_blk == 0
+                            && IMPLICATION(with_heads, D % bgmmc.N_blk == 0),
+                    VERBOSE_BLOCKING_FAIL,
+                    "destination split is not aligned with N_blk");
+            n_off += with_heads ? md.dims[md.ndims - 3] * D : D;
+        }
+    }
+
+    if (bgmmc.with_dst_dyn_quant) {
+        // The groups of a row are quantized block by block, so they must not
+        // cross the boundary of an N block.
+        bgmmc.use_buffer_c = true;
+        VCONDCHECK_BG(bgmmc.N_blk % dst_scales.get_group(-1) == 0,
+                VERBOSE_BLOCKING_FAIL,
+                "dynamic quantization group is not aligned with N_blk");
+    }
+
     if (bgmmc.wei_n_blk > bgmmc.N_blk && bgmmc.N != bgmmc.N_blk) {
         assert(!bgmmc.is_runtime_N
                 && "N_blk should not be adjusted for runtime N");
@@ -2120,7 +2247,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             bgmmc.with_eltwise, bgmmc.with_binary, bgmmc.acc_dt != bgmmc.dst_dt,
             bgmmc.s8s8_compensation_required, bgmmc.has_zero_point_a,
             bgmmc.has_zero_point_b && !bgmmc.with_wei_decompression,
-            bgmmc.has_zero_point_c, bgmmc.with_dst_scales);
+            bgmmc.has_zero_point_c, bgmmc.with_dst_scales,
+            bgmmc.with_dst_split);
 
     bgmmc.zp_a_comp_shift_n = bgmmc.wei_n_blk;
     bgmmc.zp_a_comp_elems_per_thr
@@ -2150,6 +2278,14 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_a,
                 bgmmc.nthr * bgmmc.buffer_a_per_thread_sz, default_data_align);
 
+    if (bgmmc.with_src_norm)
+        scratchpad.book(key_matmul_src_norm_stats,
+                2 * bgmmc.batch * bgmmc.M, sizeof(float));
+
+    if (bgmmc.with_lora)
+        scratchpad.book(key_matmul_lora_t,
+                bgmmc.batch * bgmmc.M * bgmmc.lora_K, sizeof(float));
+
     if (bgmmc.use_buffer_b) {
         scratchpad.book(key_brgemm_primitive_buffer_b,
                 bgmmc.nthr * bgmmc.buffer_b_per_thread_sz, default_data_align);
@@ -2191,6 +2327,10 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_d,
                 bgmmc.M_blk * bgmmc.N_blk * bgmmc.c_dt_sz * bgmmc.nthr,
                 default_data_align);
+    if (bgmmc.with_dst_dyn_quant)
+        scratchpad.book(key_matmul_dst_dyn_quant_buf,
+                static_cast<size_t>(bgmmc.nthr) * bgmmc.M_blk * bgmmc.N_blk,
+                sizeof(float), default_data_align);
     if (bgmmc.with_dst_scales) {
         // See brgemm_types.hpp comment for `with_dst_scales`.
         scratchpad.book(key_matmul_dst_scales,
@@ -104,6 +104,20 @@ struct brgemm_matmul_conf_t {
 
     format_tag_t src_tag, wei_tag, dst_tag, bia_tag;
     bool with_reduce;
+    // Source normalization is applied while A is copied to the buffer.
+    bool with_src_norm;
+    // The LoRA update initializes the accumulator of the first K block.
+    bool with_lora;
+    // Total rank of all the LoRA adapters, the K size of the update.
+    dim_t lora_K;
+    // The destination columns go to several tensors. Every block of the
+    // accumulator is stored to its tensor from the C buffer by a separate
+    // kernel.
+    bool with_dst_split;
+    // The destination scales are computed from the absolute maximum of every
+    // group of a row. The blocks of the accumulator go through a per-thread
+    // f32 buffer, from which they are quantized once the scales are known.
+    bool with_dst_dyn_quant;
     bool with_bias;
     bool with_sum;
     bool with_eltwise;
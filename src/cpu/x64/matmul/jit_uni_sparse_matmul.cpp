@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
 #include "common/c_types_map.hpp"
@@ -23,6 +24,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
@@ -41,18 +44,24 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
 
     struct call_params_t {
         const int32_t *src_indices;
-        const float *src_values, *wei, *dst;
+        const void *src_values, *wei, *dst;
         size_t block_size;
         size_t nnz;
     };
 
-    sparse_matmul_kernel_t(size_t vlen, const matmul_pd_t *pd)
+    // `dst_dt` is the data type of the stored row, it differs from the
+    // destination data type when a partial result of a split row is written
+    // to the f32 scratchpad.
+    sparse_matmul_kernel_t(
+            size_t vlen, const matmul_pd_t *pd, data_type_t dst_dt)
         : jit_generator_t(jit_name())
         , N_(pd->dst_md()->dims[1])
         , vlen_(vlen)
-        , simd_w_(vlen_ / data_type_size())
+        , simd_w_(vlen_ / sizeof(float))
         , tail_block_size_(N() % block_size())
-        , tail_size_(tail_block_size() % simd_w()) {}
+        , tail_size_(tail_block_size() % simd_w())
+        , src_dt_(pd->src_md()->data_type)
+        , dst_dt_(dst_dt) {}
 
     ~sparse_matmul_kernel_t() override = default;
 
@@ -65,7 +74,9 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
     size_t tail_block_size() const { return tail_block_size_; }
     size_t tail_size() const { return tail_size_; }
 
-    int data_type_size() const { return sizeof(float); }
+    // Source values and weights share the data type.
+    int data_type_size() const { return types::data_type_size(src_dt_); }
+    int dst_data_type_size() const { return types::data_type_size(dst_dt_); }
     int index_type_size() const { return sizeof(int32_t); }
 
     int block_size() const { return vlen(); }
@@ -80,6 +91,8 @@ protected:
     size_t simd_w_;
     size_t tail_block_size_;
     size_t tail_size_;
+    data_type_t src_dt_;
+    data_type_t dst_dt_;
 };
 
 template <cpu_isa_t isa>
@@ -87,6 +100,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_matmul_kernel_t)
 
     using sparse_matmul_kernel_t::data_type_size;
+    using sparse_matmul_kernel_t::dst_data_type_size;
     using sparse_matmul_kernel_t::simd_w;
     using sparse_matmul_kernel_t::tail_block_size;
     using sparse_matmul_kernel_t::tail_size;
@@ -114,7 +128,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     Vmm tail_vmask = Vmm(0);
 
     Vmm vreg_src_val = Vmm(isa == avx512_core ? 19 : 11);
-    Xmm xreg_src_val = Xmm(11);
+    Xmm xreg_src_val = Xmm(isa == avx512_core ? 19 : 11);
 
     void load_kernel_params() {
 #define PARAM_OFF(x) offsetof(call_params_t, x)
@@ -136,7 +150,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     }
 
     Address dst_ptr(size_t offt = 0) {
-        return ptr[reg_dst + reg_block_offset * data_type_size() + offt];
+        return ptr[reg_dst + reg_block_offset * dst_data_type_size() + offt];
     }
 
     Address src_values_ptr(size_t offt = 0) {
@@ -164,6 +178,67 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         uni_vmovups_tail(dst, tail_vmask, src);
     }
 
+    // Converts `simd_w` weights to f32, bf16 and f16 are supported on
+    // avx512_core only.
+    void load_wei(const Vmm &vmm, const Address &addr, bool is_tail) {
+        switch (src_dt_) {
+            case f32:
+                if (is_tail)
+                    load_tail(vmm, addr);
+                else
+                    uni_vmovups(vmm, addr);
+                break;
+            case bf16:
+                vpmovzxwd(is_tail ? vmm | tail_opmask | T_z : vmm, addr);
+                vpslld(vmm, vmm, 16);
+                break;
+            case f16:
+                vcvtph2ps(is_tail ? vmm | tail_opmask | T_z : vmm, addr);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void broadcast_src_value(const Address &addr) {
+        switch (src_dt_) {
+            case f32: uni_vbroadcastss(vreg_src_val, addr); break;
+            case bf16:
+                movzx(reg_tmp.cvt32(), addr);
+                shl(reg_tmp.cvt32(), 16);
+                vmovd(xreg_src_val, reg_tmp.cvt32());
+                vbroadcastss(vreg_src_val, xreg_src_val);
+                break;
+            case f16:
+                movzx(reg_tmp.cvt32(), addr);
+                vmovd(xreg_src_val, reg_tmp.cvt32());
+                vcvtph2ps(xreg_src_val, xreg_src_val);
+                vbroadcastss(vreg_src_val, xreg_src_val);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store_dst(const Address &addr, const Vmm &vmm, bool is_tail) {
+        switch (dst_dt_) {
+            case f32:
+                if (is_tail)
+                    store_tail(addr, vmm);
+                else
+                    uni_vmovups(addr, vmm);
+                break;
+            case bf16: {
+                const Ymm ymm_dst(vmm.getIdx());
+                vcvtneps2bf16(ymm_dst, vmm);
+                vmovdqu16(is_tail ? addr | tail_opmask : addr, ymm_dst);
+                break;
+            }
+            case f16:
+                vcvtps2ph(is_tail ? addr | tail_opmask : addr, vmm, _op_mxcsr);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
     void prepare_tail_mask();
 
     Vmm get_dst_reg(int index) const {
@@ -187,11 +262,10 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         for (int i_load = 0; i_load < nloads; i_load++) {
             Vmm vreg_tmp_wei = get_wei_reg(i_load, is_tail_block);
             // Load a row of weights.
-            if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                load_tail(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            } else {
-                uni_vmovups(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            }
+            const bool is_tail
+                    = is_tail_block && tail_size() > 0 && i_load == nloads - 1;
+            load_wei(vreg_tmp_wei,
+                    wei_ptr(simd_w() * data_type_size() * i_load), is_tail);
             // Multiply the broadcasted value with the row of weights
             // and accumulate result in dst.
             Vmm vreg_tmp_dst = get_dst_reg(i_load);
@@ -209,8 +283,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
             for (int uf = 0; uf < unroll_factor; uf++) {
                 // Load src values to broadcast.
-                uni_vbroadcastss(
-                        vreg_src_val, src_values_ptr(uf * data_type_size()));
+                broadcast_src_value(src_values_ptr(uf * data_type_size()));
                 // Load an index.
                 movsxd(reg_src_col_idx,
                         src_indices_ptr(uf * index_type_size()));
@@ -229,7 +302,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         jz(skip_row_tail, T_NEAR);
 
         // Load src values to broadcast.
-        uni_vbroadcastss(vreg_src_val, src_values_ptr());
+        broadcast_src_value(src_values_ptr());
         // Load an index.
         movsxd(reg_src_col_idx, src_indices_ptr());
         loop_within_block_row(vreg_src_val, reg_src_col_idx, is_tail_block);
@@ -273,11 +346,10 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
             loop_within_block(unroll_factor(), is_tail_block);
 
             for (int i_load = 0; i_load < nloads; i_load++) {
-                if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                    store_tail(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                } else {
-                    uni_vmovups(dst_ptr(vlen() * i_load), vregs_dst[i_load]);
-                }
+                const bool is_tail = is_tail_block && tail_size() > 0
+                        && i_load == nloads - 1;
+                store_dst(dst_ptr(simd_w() * dst_data_type_size() * i_load),
+                        vregs_dst[i_load], is_tail);
             }
             add(reg_blocks_count, 1);
             jmp(loop_over_blocks_begin, T_NEAR);
@@ -299,8 +371,8 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         postamble();
     }
 
-    jit_uni_sparse_matmul_kernel_t(const matmul_pd_t *pd)
-        : sparse_matmul_kernel_t(cpu_isa_traits_t<isa>::vlen, pd) {}
+    jit_uni_sparse_matmul_kernel_t(const matmul_pd_t *pd, data_type_t dst_dt)
+        : sparse_matmul_kernel_t(cpu_isa_traits_t<isa>::vlen, pd, dst_dt) {}
     ~jit_uni_sparse_matmul_kernel_t() override = default;
 };
 
@@ -328,16 +400,22 @@ void jit_uni_sparse_matmul_kernel_t<avx2>::prepare_tail_mask() {
 }
 
 status_t jit_uni_sparse_matmul_t::init(engine_t *engine) {
+    const data_type_t dst_dt = pd()->dst_md()->data_type;
+    const bool need_acc_kernel = dst_dt != f32;
     if (mayiuse(avx512_core)) {
         using kernel_t = jit_uni_sparse_matmul_kernel_t<avx512_core>;
-        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd())};
+        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd(), dst_dt)};
+        if (need_acc_kernel)
+            acc_kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd(), f32)};
     } else if (mayiuse(avx2)) {
         using kernel_t = jit_uni_sparse_matmul_kernel_t<avx2>;
-        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd())};
+        kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd(), dst_dt)};
     }
     if (!kernel_) return status::runtime_error;
+    if (need_acc_kernel && !acc_kernel_) return status::runtime_error;
 
     CHECK(kernel_->create_kernel());
+    if (acc_kernel_) CHECK(acc_kernel_->create_kernel());
     return status::success;
 }
 
@@ -346,13 +424,13 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
-    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
-    const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
     const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
     const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
     status_t status = status::success;
-    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
     CHECK(status);
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -360,56 +438,117 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
-
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
+    const dim_t nnz = src_pointers[M];
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    float *acc = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_matmul_dst_in_acc_dt);
+    sparse_matmul_kernel_t *acc_kernel
+            = acc_kernel_ ? acc_kernel_.get() : kernel_.get();
+
+    // The non-zero elements, rather than the rows, are distributed evenly
+    // between `nparts` parts, so that a few heavy rows do not serialize the
+    // whole computation. A row crossing the boundary of a part is computed
+    // partially by every part it intersects: the first such part stores its
+    // result to slot 1, others to slot 0 of their own f32 scratchpad rows.
+    int nparts = pd()->nthr();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
     const size_t data_to_process_in_kb
-            = (src_d.nnz() + M) * N * src_d.data_type_size() / 1024;
-
-    // If not, use 0, which means all threads.
-    const int nthr = data_to_process_in_kb < threshold_in_kb;
+            = (src_d.nnz() + M) * N * src_dt_size / 1024;
+    if (data_to_process_in_kb < threshold_in_kb) nparts = 1;
+#endif
 
-    parallel(nthr, [&](const int ithr, const int nthr) {
+    auto part_start = [&](int part) {
+        if (part == nparts) return nnz;
         dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
-        if (start >= end) return;
-
-        for (dim_t m = start; m < end; m++) {
-            const int row_begin = src_pointers[m];
-            const int row_end = src_pointers[m + 1];
-            const int nnz = row_end - row_begin;
-
-            sparse_matmul_kernel_t::call_params_t p;
-            p.nnz = nnz;
-            p.src_values = src_values + row_begin;
-            p.src_indices = src_indices + row_begin;
-            p.wei = weights;
-            p.dst = dst + (m * N);
-            p.block_size = kernel_->block_size();
-            (*kernel_)(&p);
+        balance211(nnz, nparts, part, start, end);
+        return start;
+    };
+    // Returns the row the non-zero element `nz` belongs to.
+    auto row_of = [&](dim_t nz) {
+        return static_cast<dim_t>(
+                std::upper_bound(src_pointers + 1, src_pointers + M + 1, nz)
+                - (src_pointers + 1));
+    };
+    auto acc_row = [&](int part, int slot) {
+        return acc + (static_cast<size_t>(part) * 2 + slot) * N;
+    };
+    auto compute = [&](sparse_matmul_kernel_t *kernel, void *row_dst,
+                           dim_t nz_begin, dim_t nz_end) {
+        sparse_matmul_kernel_t::call_params_t p;
+        p.nnz = nz_end - nz_begin;
+        p.src_values = src_values + nz_begin * src_dt_size;
+        p.src_indices = src_indices + nz_begin;
+        p.wei = weights;
+        p.dst = row_dst;
+        p.block_size = kernel->block_size();
+        (*kernel)(&p);
+    };
+
+    parallel(nparts, [&](const int ithr, const int nthr) {
+        for (int part = ithr; part < nparts; part += nthr) {
+            const dim_t nz_start = part_start(part);
+            const dim_t nz_end = part_start(part + 1);
+
+            // The tail of a row started by a previous part.
+            if (nz_start < nz_end) {
+                const dim_t m = row_of(nz_start);
+                if (src_pointers[m] < nz_start)
+                    compute(acc_kernel, acc_row(part, 0), nz_start,
+                            nstl::min<dim_t>(src_pointers[m + 1], nz_end));
+            }
+
+            // Rows starting within the part, including the empty ones. The
+            // last part also owns the empty rows at the end of the matrix.
+            const dim_t m_start = std::lower_bound(src_pointers,
+                                          src_pointers + M, nz_start)
+                    - src_pointers;
+            const dim_t m_end = part == nparts - 1
+                    ? M
+                    : std::lower_bound(src_pointers, src_pointers + M, nz_end)
+                            - src_pointers;
+            for (dim_t m = m_start; m < m_end; m++) {
+                const dim_t row_end = src_pointers[m + 1];
+                if (row_end > nz_end)
+                    compute(acc_kernel, acc_row(part, 1), src_pointers[m],
+                            nz_end);
+                else
+                    compute(kernel_.get(), dst + m * N * dst_dt_size,
+                            src_pointers[m], row_end);
+            }
         }
     });
-#else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
 
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
+    if (nparts == 1) return status::success;
+
+    // Reduce the split rows. A row is reduced by the first part boundary
+    // that falls strictly inside of it.
+    const data_type_t dst_dt = dst_d.data_type();
+    parallel_nd(nparts - 1, [&](dim_t boundary) {
+        const int part = static_cast<int>(boundary) + 1;
+        const dim_t nz = part_start(part);
+        if (nz == 0 || nz >= nnz) return;
+        const dim_t m = row_of(nz);
+        if (src_pointers[m] == nz || part_start(part - 1) > src_pointers[m])
+            return;
+
+        int last_part = part;
+        while (last_part + 1 < nparts
+                && part_start(last_part + 1) < src_pointers[m + 1])
+            last_part++;
+
+        const float *first = acc_row(part - 1, 1);
+        for (dim_t n = 0; n < N; n++) {
+            float val = first[n];
+            for (int p = part; p <= last_part; p++)
+                val += acc_row(p, 0)[n];
+            io::store_float_value(dst_dt, val, dst, m * N + n);
+        }
     });
-#endif
+
     return status::success;
 }
 
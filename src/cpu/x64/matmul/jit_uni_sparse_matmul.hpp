@@ -18,6 +18,8 @@
 #define CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -51,7 +53,8 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper wei_d(weights_md(0));
 
             const bool problem_dt_correct
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
+                    = utils::one_of(src_type, f32, bf16, f16)
+                    && utils::everyone_is(src_type, wei_type, dst_type)
                     && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
                     && utils::everyone_is(s32, src_d.metadata_type(0),
                             src_d.metadata_type(1));
@@ -61,12 +64,22 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(
                     attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+            VDISPATCH_MATMUL(IMPLICATION(src_type == bf16,
+                                     mayiuse(avx512_core_bf16)),
+                    VERBOSE_UNSUPPORTED_ISA);
+            VDISPATCH_MATMUL(IMPLICATION(src_type == f16, mayiuse(avx512_core)),
+                    VERBOSE_UNSUPPORTED_ISA);
             VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
 
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
             return status::success;
         }
 
+        int nthr() const { return nthr_; }
+
         bool formats_ok() const {
             const bool is_dst_ab
                     = memory_desc_wrapper(dst_md()).matches_one_of_tag(
@@ -75,6 +88,19 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
                                            .matches_one_of_tag(format_tag::ab);
             return is_dst_ab && is_wei_ab;
         }
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            // Every part of the non-zero elements may start and end in the
+            // middle of a row, the partial results of such rows are kept in
+            // f32 until they are reduced.
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(key_matmul_dst_in_acc_dt,
+                    static_cast<size_t>(nthr_) * 2 * dst_md()->dims[1]);
+        }
+
+        int nthr_ = 0;
     };
 
     jit_uni_sparse_matmul_t(const pd_t *apd);
@@ -85,7 +111,10 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    // `acc_kernel_` stores f32 rows for the split rows, it is created only
+    // when the destination data type is not f32.
     std::unique_ptr<sparse_matmul_kernel_t> kernel_;
+    std::unique_ptr<sparse_matmul_kernel_t> acc_kernel_;
 };
 
 } // namespace matmul
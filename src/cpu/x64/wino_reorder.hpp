@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_WINO_REORDER_HPP
+#define CPU_X64_WINO_REORDER_HPP
+
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Transforms f32 weights in a plain or blocked format to the layout used by
+// `brgemm_wino_convolution_fwd_t`.
+struct wino_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("wino_reorder", wino_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            using namespace status;
+            const memory_desc_wrapper id(src_md), od(dst_md);
+
+            VDISPATCH_REORDER_IC(id.data_type() == data_type::f32
+                            && od.data_type() == data_type::f32,
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_REORDER_IC(id.is_blocking_desc()
+                            && brgemm_wino::is_wei_md(*dst_md),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_REORDER_IC(id.ndims() == 4
+                            && !id.has_runtime_dims_or_strides()
+                            && id.dims()[0] == od.wino_desc().oc
+                            && id.dims()[1] == od.wino_desc().ic
+                            && id.dims()[2] == brgemm_wino::kernel_size
+                            && id.dims()[3] == brgemm_wino::kernel_size,
+                    VERBOSE_INCONSISTENT_MDS, "src", "dst");
+            VDISPATCH_REORDER_IC(
+                    attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+            auto _pd = make_unique_pd<pd_t>(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return out_of_memory;
+            CHECK(_pd->init(engine, src_engine, dst_engine));
+            CHECK(_pd->init_scratchpad_md());
+            return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd.release());
+        }
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    wino_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        auto src = CTX_IN_MEM(const float *, DNNL_ARG_FROM);
+        auto dst = CTX_OUT_MEM(float *, DNNL_ARG_TO);
+        const memory_desc_wrapper dst_d(pd()->dst_md());
+        brgemm_wino::transform_weights(memory_desc_wrapper(pd()->src_md()),
+                src, dst, dst_d.wino_desc().oc_block);
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -49,6 +49,11 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(shuffle);
             CASE(softmax);
             CASE(zero_pad);
+            // The gated MLP, the matmul top-k and the RoPE primitives are
+            // implemented for CPU only.
+            case primitive_kind::gated_mlp:
+            case primitive_kind::matmul_topk:
+            case primitive_kind::rope: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -114,6 +114,8 @@ struct micro_t : public primitive_t {
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
                     VERBOSE_UNSUPPORTED_TAG);
+            VCHECK_SDPA_UNIMPL(!with_paged_kv(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged kv cache");
 
             memory_desc_wrapper qry_mdw(qry_md());
             memory_desc_wrapper key_mdw(key_md());
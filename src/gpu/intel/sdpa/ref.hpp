@@ -44,6 +44,8 @@ struct ref_t : public primitive_t {
 
             VDISPATCH_SDPA(attr()->has_default_values(smask_t::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(!with_paged_kv(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged kv cache");
             VDISPATCH_SDPA(
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
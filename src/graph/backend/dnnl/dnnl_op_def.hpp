@@ -1189,6 +1189,29 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_sdpa, 1,
                 .SET_EXECUTABLE_CREATOR(executable_creator<sdpa_executable_t>)
                 .SET_ARG_INDICES_GETTER(sdpa_executable_t))
 
+// The data types of src/weights/output must be consistent. The activation of
+// the gate projection is given by alg_kind, alpha and beta with the semantics
+// of dnnl_eltwise.
+DNNL_GRAPH_OP_SCHEMA(dnnl_gated_mlp, 1,
+        op_schema_t()
+                .set_num_inputs(4)
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "w_gate")
+                .set_input(2, "w_up")
+                .set_input(3, "w_down")
+                .set_output(0, "output")
+                .set_output(1, "scratchpad")
+                .set_attr(op_attr::alg_kind, true, attribute_kind::i)
+                .set_attr(op_attr::alpha, false, attribute_kind::f, 0.f)
+                .set_attr(op_attr::beta, false, attribute_kind::f, 0.f)
+                .set_shape_inference_function(
+                        infer_dnnl_gated_mlp_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_gated_mlp)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<gated_mlp_executable_t>)
+                .SET_ARG_INDICES_GETTER(gated_mlp_executable_t))
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -602,6 +602,56 @@ status_t infer_dnnl_sdpa_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_dnnl_gated_mlp_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    // [..., ic]
+    auto src = logical_tensor_wrapper_t(inputs[0]);
+    // [ic, hidden]
+    auto w_gate = logical_tensor_wrapper_t(inputs[1]);
+    // [ic, hidden]
+    auto w_up = logical_tensor_wrapper_t(inputs[2]);
+    // [hidden, oc]
+    auto w_down = logical_tensor_wrapper_t(inputs[3]);
+    // [..., oc]
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    dims src_dims = src.vdims();
+    dims w_gate_dims = w_gate.vdims();
+    dims w_up_dims = w_up.vdims();
+    dims w_down_dims = w_down.vdims();
+
+    VCHECK_INVALID_SHAPE((w_gate_dims.size() == 2 && w_up_dims.size() == 2
+                                 && w_down_dims.size() == 2),
+            "%s, only support 2D weights. input1 dims: %s, input2 dims: %s, "
+            "input3 dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dims2str(w_gate_dims).c_str(), dims2str(w_up_dims).c_str(),
+            dims2str(w_down_dims).c_str());
+
+    VCHECK_INVALID_SHAPE((src_dims.size() >= 2
+                                 && src_dims.back() == w_gate_dims[0]
+                                 && w_gate_dims == w_up_dims
+                                 && w_gate_dims[1] == w_down_dims[0]),
+            "%s, input dims are inconsistent. input0 dims: %s, input1 dims: "
+            "%s, input2 dims: %s, input3 dims: %s",
+            op_t::kind2str(n->get_kind()).c_str(), dims2str(src_dims).c_str(),
+            dims2str(w_gate_dims).c_str(), dims2str(w_up_dims).c_str(),
+            dims2str(w_down_dims).c_str());
+
+    dims inferred_output_shape = src_dims;
+    inferred_output_shape.back() = w_down_dims[1];
+
+    if (out0.ndims() != -1) {
+        VCHECK_INVALID_SHAPE(validate(inferred_output_shape, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], inferred_output_shape);
+    return status::success;
+}
+
 status_t infer_dnnl_host_scalar_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
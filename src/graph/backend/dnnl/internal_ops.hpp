@@ -81,6 +81,7 @@ namespace op_kind {
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
     X(dnnl_sdpa, Dnnl_sdpa) \
+    X(dnnl_gated_mlp, Dnnl_gated_mlp) \
     X(dnnl_host_scalar, Dnnl_host_scalar)
 
 enum kind_t {
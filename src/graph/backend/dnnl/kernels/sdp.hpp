@@ -55,6 +55,10 @@ public:
         bool enable_ukernel = false;
 
         if (ekind == engine_kind::cpu) {
+            // The CPU SDPA primitive dequantizes compressed K and V itself.
+            // Statically quantized partitions are rejected by the primitive
+            // kernel and fall back to the decomposition.
+            enable_ukernel = enable_cpu_ukernel() && !force_primitive();
             enable_decomp = enable_decomp_kernel();
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
@@ -101,10 +105,21 @@ public:
 #endif
     }
 
+    // The online softmax of the CPU SDPA primitive changes the order of the
+    // floating-point operations, so its results are not bitwise equal to
+    // the ones of the graph operations computed one by one. Until the
+    // tolerance of the graph validation accounts for that, an internal env
+    // var enables the primitive on CPU.
+    bool enable_cpu_ukernel() const {
+        const int enable = graph::utils::getenv_int_internal(
+                "GRAPH_SDPA_CPU_UKERNEL", 0);
+        return enable > 0;
+    }
+
     // An internal env var is provided to force using primitive based SDPA
-    // implementation and skipping ukernel based optimization on GPU or
-    // decomposition based optimization on CPU. Currently it's for oneDNN debug
-    // and testing only.
+    // implementation and skipping ukernel based optimization on GPU or SDPA
+    // primitive and decomposition based optimizations on CPU. Currently it's
+    // for oneDNN debug and testing only.
     bool force_primitive() const {
         const int force = graph::utils::getenv_int_internal(
                 "GRAPH_SDPA_FORCE_PRIMITIVE", 0);
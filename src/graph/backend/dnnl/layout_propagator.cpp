@@ -1749,9 +1749,6 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, pd_cache_t &pd_cache,
         const fpmath_t &fpmath, bool use_block_layout,
         subgraph_rewriter_t &rewriter) {
-    UNUSED(p_engine);
-    UNUSED(pd_cache);
-    UNUSED(fpmath);
     UNUSED(use_block_layout);
     UNUSED(rewriter);
 
@@ -1794,14 +1791,64 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         expected_md = make_dnnl_memory_desc(out_lt);
     }
     status_t status = fill_layout_info(dst_val, expected_md);
+    if (status != status::success) return status;
 
-    // fill scratchpads dimensions and data type to scratchpad value_t
+    // fill scratchpads dimensions and data type to scratchpad value_t. If the
+    // primitive is not supported, the failure is reported when compiling the
+    // op.
     value_ptr scratchpad_val = op->get_output_value(1);
-    const memory::desc scratchpad_desc;
+    memory::desc scratchpad_desc;
+    const auto pd
+            = sdpa_executable_t::create_desc(op, p_engine, pd_cache, fpmath);
+    if (pd) {
+        dnnl_memory_desc_t cloned_md = nullptr;
+        CHECK(dnnl_memory_desc_clone(&cloned_md, pd->scratchpad_md()));
+        scratchpad_desc = memory::desc(cloned_md);
+    }
     status = fill_layout_info(scratchpad_val, scratchpad_desc);
     return status;
 }
 
+status_t layout_propagator_for_gated_mlp(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+
+    // The primitive reads and writes row-major tensors only, reorders are
+    // inserted for the tensors given in other layouts.
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        const auto expected_md = to_ncx_format(make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor()));
+        insert_reorder_before(op, i, expected_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        status = fill_layout_info(op->get_input_value(i), expected_md);
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for gated mlp input %zu", i);
+    }
+
+    const auto expected_dst_md = to_ncx_format(make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor()));
+    insert_reorder_after(op, 0, expected_dst_md, p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    status = fill_layout_info(op->get_output_value(0), expected_dst_md);
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for gated mlp output");
+
+    // fill scratchpads dimensions and data type to scratchpad value_t. If the
+    // primitive is not supported, the failure is reported when compiling the
+    // op.
+    memory::desc scratchpad_desc;
+    const auto pd = gated_mlp_executable_t::create_desc(
+            op, p_engine, pd_cache, fpmath);
+    if (pd) {
+        dnnl_memory_desc_t cloned_md = nullptr;
+        CHECK(dnnl_memory_desc_clone(&cloned_md, pd->scratchpad_md()));
+        scratchpad_desc = memory::desc(cloned_md);
+    }
+    return fill_layout_info(op->get_output_value(1), scratchpad_desc);
+}
+
 status_t layout_propagator_for_host_scalar(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, pd_cache_t &pd_cache,
         const fpmath_t &fpmath, bool use_block_layout,
@@ -94,6 +94,7 @@ DECLARE_LAYOUT_PROPAGATOR(groupnorm);
 DECLARE_LAYOUT_PROPAGATOR(gen_index);
 DECLARE_LAYOUT_PROPAGATOR(mask);
 DECLARE_LAYOUT_PROPAGATOR(sdpa);
+DECLARE_LAYOUT_PROPAGATOR(gated_mlp);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
 
 #undef DECLARE_LAYOUT_PROPAGATOR
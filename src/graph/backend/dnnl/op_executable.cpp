@@ -2370,6 +2370,81 @@ arg_indices_t genindex_executable_t::get_arg_indices(const op_t *op) {
     return arg_indices;
 }
 
+std::shared_ptr<primitive_desc_t> sdpa_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpmath) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        return graph::utils::any_cast<std::shared_ptr<primitive_desc_t>>(
+                pd_cache.at(op.get()));
+    }
+
+    auto md_q = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto md_k = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    auto md_v = make_dnnl_memory_desc(
+            op->get_input_value(2)->get_logical_tensor());
+    auto md_dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+
+    const bool with_scale = op->get_attr<bool>(op_attr::with_scale);
+    const auto mask_type = static_cast<attn_mask_type_t>(
+            op->get_attr<int64_t>(op_attr::mask_type));
+
+    auto md_scale = dnnl::memory::desc();
+    size_t idx = 3;
+    if (with_scale)
+        md_scale = make_dnnl_memory_desc(
+                op->get_input_value(idx++)->get_logical_tensor());
+
+    dnnl::memory::desc md_mask;
+    if (mask_type == attn_mask_type::buffer)
+        md_mask = make_dnnl_memory_desc(
+                op->get_input_value(idx++)->get_logical_tensor());
+
+    dnnl::primitive_attr attr, qk_attr, vs_attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_));
+
+    const bool is_invert_scale = op->has_attr(op_attr::is_invert_scale)
+            ? op->get_attr<bool>(op_attr::is_invert_scale)
+            : false;
+
+    if (op->has_attr(op_attr::fusion_info)) {
+        const auto &sdpa_fusion_info
+                = op->get_attr<fusion_info_t>(op_attr::fusion_info);
+        qk_attr = make_dnnl_sdpa_primitive_attr(
+                op, sdpa_fusion_info, attr_type_t::QK);
+        vs_attr = make_dnnl_sdpa_primitive_attr(
+                op, sdpa_fusion_info, attr_type_t::VS);
+    }
+
+    // Set accumulation mode: the two attributes are requested for
+    // dnnl_sdpa, so we can get them directly without calling has_attr().
+    qk_attr.set_accumulation_mode(str2accumulation_mode(
+            op->get_attr<std::string>(op_attr::qk_acc_mode)));
+    vs_attr.set_accumulation_mode(str2accumulation_mode(
+            op->get_attr<std::string>(op_attr::vs_acc_mode)));
+
+    dim_t kv_head_number = op->get_input_value(1)->get_logical_tensor().dims[1];
+
+    const std::string &softmax_mode = op->get_attr<std::string>(op_attr::mode);
+    const alg_kind_t softmax_alg = softmax_mode == "inf_as_zero"
+            ? alg_kind::softmax_accurate_inf_as_zero
+            : alg_kind::softmax_accurate;
+
+    std::shared_ptr<primitive_desc_t> pd;
+    status_t s = create_sdpa_pd(pd, p_engine.get(), md_q.get(), md_k.get(),
+            md_v.get(), md_dst.get(), md_mask.get(), md_scale.get(),
+            is_invert_scale, kv_head_number, mask_type, softmax_alg, attr.get(),
+            qk_attr.get(), vs_attr.get());
+    if (s != status::success) return nullptr;
+
+    pd_cache.insert({op.get(), pd});
+    return pd;
+}
+
 arg_indices_t sdpa_executable_t::get_arg_indices(const op_t *op) {
     arg_indices_t arg_indices;
     // Required input args: query, key, value
@@ -2412,6 +2487,73 @@ arg_indices_t sdpa_executable_t::get_arg_indices(const op_t *op) {
     return arg_indices;
 }
 
+std::shared_ptr<primitive_desc_t> gated_mlp_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpmath) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        return graph::utils::any_cast<std::shared_ptr<primitive_desc_t>>(
+                pd_cache.at(op.get()));
+    }
+
+    // The tokens of src and dst may have several dimensions, they are
+    // flattened into the rows of 2D matrices.
+    auto to_2d = [](const dnnl::memory::desc &md) {
+        const auto dims = md.get_dims();
+        dim_t rows = 1;
+        for (size_t i = 0; i + 1 < dims.size(); i++)
+            rows *= dims[i];
+        return dnnl::memory::desc(
+                {rows, dims.back()}, md.get_data_type(), format_tag::ab);
+    };
+
+    std::vector<dnnl::memory::desc> mds;
+    for (size_t i = 0; i < op->num_inputs(); i++)
+        mds.push_back(make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor()));
+    mds.push_back(make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor()));
+    // Only dense row-major tensors can be viewed as 2D matrices.
+    for (const auto &md : mds)
+        if (md != to_ncx_format(md)) return nullptr;
+    auto md_src = to_2d(mds[0]);
+    auto md_dst = to_2d(mds[4]);
+
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_));
+
+    const auto activation = static_cast<alg_kind_t>(
+            op->get_attr<int64_t>(op_attr::alg_kind));
+    const float alpha = op->has_attr(op_attr::alpha)
+            ? op->get_attr<float>(op_attr::alpha)
+            : 0.f;
+    const float beta = op->has_attr(op_attr::beta)
+            ? op->get_attr<float>(op_attr::beta)
+            : 0.f;
+
+    std::shared_ptr<primitive_desc_t> pd;
+    status_t s = create_gated_mlp_pd(pd, p_engine.get(), md_src.get(),
+            mds[1].get(), mds[2].get(), mds[3].get(), md_dst.get(), activation,
+            alpha, beta, attr.get());
+    if (s != status::success) return nullptr;
+
+    pd_cache.insert({op.get(), pd});
+    return pd;
+}
+
+arg_indices_t gated_mlp_executable_t::get_arg_indices(const op_t *op) {
+    UNUSED(op);
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_WEIGHTS_GATE, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_WEIGHTS_UP, indices_t {input, 2}});
+    arg_indices.insert({DNNL_ARG_WEIGHTS_DOWN, indices_t {input, 3}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+    return arg_indices;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -24,6 +24,7 @@
 #include <unordered_map>
 
 #include "common/primitive.hpp"
+#include "common/gated_mlp_utils.hpp"
 #include "common/primitive_desc_iface.hpp"
 #include "common/sdpa_utils.hpp"
 
@@ -2919,6 +2920,23 @@ private:
 #endif
 };
 
+// Executes an internal primitive created with the user scratchpad mode. The
+// scratchpad buffer planned for the op is passed as DNNL_ARG_SCRATCHPAD.
+inline status_t execute_internal_primitive(
+        const std::shared_ptr<primitive_t> &prim, exec_ctx_t &ctx) {
+    memory_t *scratchpad_mem = ctx.output(DNNL_ARG_SCRATCHPAD);
+    const memory_storage_t *mem_storage
+            = scratchpad_mem ? scratchpad_mem->memory_storage() : nullptr;
+    const void *host_ptr
+            = ctx.host_ptr(mem_storage, /* require_host_ptr = */ true);
+    auto grantor
+            = prim->pd()->scratchpad_registry().grantor(mem_storage, host_ptr);
+    ctx.set_scratchpad_grantor(&grantor);
+    const status_t status = prim->execute(ctx);
+    ctx.set_scratchpad_grantor(nullptr);
+    return status;
+}
+
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
@@ -2927,65 +2945,13 @@ struct sdpa_executable_t : public op_executable_t {
         : with_scale_(op->get_attr<bool>(op_attr::with_scale))
         , mask_type_(static_cast<attn_mask_type_t>(
                   op->get_attr<int64_t>(op_attr::mask_type))) {
-
-        auto md_q = make_dnnl_memory_desc(
-                op->get_input_value(0)->get_logical_tensor());
-        auto md_k = make_dnnl_memory_desc(
-                op->get_input_value(1)->get_logical_tensor());
-        auto md_v = make_dnnl_memory_desc(
-                op->get_input_value(2)->get_logical_tensor());
-        auto md_dst = make_dnnl_memory_desc(
-                op->get_output_value(0)->get_logical_tensor());
-
-        auto md_scale = dnnl::memory::desc();
-        size_t idx = 3;
-        if (with_scale_)
-            md_scale = make_dnnl_memory_desc(
-                    op->get_input_value(idx++)->get_logical_tensor());
-
-        dnnl::memory::desc md_mask;
         with_explicit_mask_ = mask_type_ == attn_mask_type::buffer;
-        if (with_explicit_mask_)
-            md_mask = make_dnnl_memory_desc(
-                    op->get_input_value(idx++)->get_logical_tensor());
-
-        dnnl::primitive_attr attr, qk_attr, vs_attr;
-        attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-        attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_));
-
         is_invert_scale_ = op->has_attr(op_attr::is_invert_scale)
                 ? op->get_attr<bool>(op_attr::is_invert_scale)
                 : false;
 
-        if (op->has_attr(op_attr::fusion_info)) {
-            const auto &sdpa_fusion_info
-                    = op->get_attr<fusion_info_t>(op_attr::fusion_info);
-            qk_attr = make_dnnl_sdpa_primitive_attr(
-                    op, sdpa_fusion_info, attr_type_t::QK);
-            vs_attr = make_dnnl_sdpa_primitive_attr(
-                    op, sdpa_fusion_info, attr_type_t::VS);
-        }
-
-        // Set accumulation mode: the two attributes are requested for
-        // dnnl_sdpa, so we can get them directly without calling has_attr().
-        qk_attr.set_accumulation_mode(str2accumulation_mode(
-                op->get_attr<std::string>(op_attr::qk_acc_mode)));
-        vs_attr.set_accumulation_mode(str2accumulation_mode(
-                op->get_attr<std::string>(op_attr::vs_acc_mode)));
-
-        dim_t kv_head_number
-                = op->get_input_value(1)->get_logical_tensor().dims[1];
-
-        const std::string &softmax_mode
-                = op->get_attr<std::string>(op_attr::mode);
-        const alg_kind_t softmax_alg = softmax_mode == "inf_as_zero"
-                ? alg_kind::softmax_accurate_inf_as_zero
-                : alg_kind::softmax_accurate;
-        status_t s = create_sdpa_pd(sdpa_pd_, p_engine.get(), md_q.get(),
-                md_k.get(), md_v.get(), md_dst.get(), md_mask.get(),
-                md_scale.get(), is_invert_scale_, kv_head_number, mask_type_,
-                softmax_alg, attr.get(), qk_attr.get(), vs_attr.get());
-        if (s != dnnl::impl::status::success) {
+        sdpa_pd_ = create_desc(op, p_engine, pd_cache, fpmath);
+        if (!sdpa_pd_) {
             is_initialized_ = false;
         } else {
             status_t s = sdpa_pd_->create_primitive(sdpa_prim_, p_engine.get());
@@ -2993,6 +2959,11 @@ struct sdpa_executable_t : public op_executable_t {
         }
     }
 
+    // Returns nullptr if the sdpa primitive does not support the op.
+    static std::shared_ptr<primitive_desc_t> create_desc(
+            std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath);
+
     bool is_initialized() const { return is_initialized_; }
 
     void execute(const stream &stream,
@@ -3002,6 +2973,11 @@ struct sdpa_executable_t : public op_executable_t {
         memory_arg_t mem_arg_k = {(args.at(DNNL_ARG_KEYS)).get(), true};
         memory_arg_t mem_arg_v = {(args.at(DNNL_ARG_VALUES)).get(), true};
         memory_arg_t mem_arg_dst = {(args.at(DNNL_ARG_DST)).get(), false};
+        memory_arg_t mem_arg_scratchpad
+                = {args.find(DNNL_ARG_SCRATCHPAD) != args.end()
+                                ? (args.at(DNNL_ARG_SCRATCHPAD)).get()
+                                : nullptr,
+                        false};
         memory_arg_t mem_arg_scale = {
                 with_scale_ ? (args.at(DNNL_ARG_SCALE)).get() : nullptr, true};
         memory_arg_t mem_arg_mask
@@ -3047,9 +3023,10 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        exec_args[DNNL_ARG_SCRATCHPAD] = mem_arg_scratchpad;
 
         exec_ctx_t ctx(stream.get(), std::move(exec_args));
-        sdpa_prim_->execute(ctx);
+        execute_internal_primitive(sdpa_prim_, ctx);
     }
 
 #ifdef DNNL_WITH_SYCL
@@ -3062,6 +3039,11 @@ struct sdpa_executable_t : public op_executable_t {
         memory_arg_t mem_arg_k = {(args.at(DNNL_ARG_KEYS)).get(), true};
         memory_arg_t mem_arg_v = {(args.at(DNNL_ARG_VALUES)).get(), true};
         memory_arg_t mem_arg_dst = {(args.at(DNNL_ARG_DST)).get(), false};
+        memory_arg_t mem_arg_scratchpad
+                = {args.find(DNNL_ARG_SCRATCHPAD) != args.end()
+                                ? (args.at(DNNL_ARG_SCRATCHPAD)).get()
+                                : nullptr,
+                        false};
         memory_arg_t mem_arg_scale = {
                 with_scale_ ? (args.at(DNNL_ARG_SCALE)).get() : nullptr, true};
         memory_arg_t mem_arg_mask
@@ -3107,6 +3089,7 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        exec_args[DNNL_ARG_SCRATCHPAD] = mem_arg_scratchpad;
 
         auto strm_t = stream.get();
         exec_ctx_t ctx(strm_t, std::move(exec_args));
@@ -3117,7 +3100,7 @@ struct sdpa_executable_t : public op_executable_t {
 
         if (!deps.empty()) sycl_stream_impl->sycl_ctx().set_deps(deps);
 
-        sdpa_prim_->execute(ctx);
+        execute_internal_primitive(sdpa_prim_, ctx);
 
         ::sycl::event return_event = sycl_stream_impl->get_output_event();
         strm_t->after_exec_hook();
@@ -3134,6 +3117,11 @@ struct sdpa_executable_t : public op_executable_t {
         memory_arg_t mem_arg_k = {(args.at(DNNL_ARG_KEYS)).get(), true};
         memory_arg_t mem_arg_v = {(args.at(DNNL_ARG_VALUES)).get(), true};
         memory_arg_t mem_arg_dst = {(args.at(DNNL_ARG_DST)).get(), false};
+        memory_arg_t mem_arg_scratchpad
+                = {args.find(DNNL_ARG_SCRATCHPAD) != args.end()
+                                ? (args.at(DNNL_ARG_SCRATCHPAD)).get()
+                                : nullptr,
+                        false};
         memory_arg_t mem_arg_scale = {
                 with_scale_ ? (args.at(DNNL_ARG_SCALE)).get() : nullptr, true};
         memory_arg_t mem_arg_mask
@@ -3179,6 +3167,7 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        exec_args[DNNL_ARG_SCRATCHPAD] = mem_arg_scratchpad;
 
         exec_ctx_t ctx(stream.get(), std::move(exec_args));
 
@@ -3195,7 +3184,7 @@ struct sdpa_executable_t : public op_executable_t {
             ocl_stream->ocl_ctx().set_deps(events);
         }
 
-        sdpa_prim_->execute(ctx);
+        execute_internal_primitive(sdpa_prim_, ctx);
 
         cl_event return_event = nullptr;
         if ((ocl_stream->flags() & stream_flags::in_order) == 0) {
@@ -3222,6 +3211,81 @@ private:
     bool is_initialized_;
 };
 
+struct gated_mlp_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    gated_mlp_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+            const fpmath_t &fpmath, bool use_block_layout) {
+        UNUSED(use_block_layout);
+        pd_ = create_desc(op, p_engine, pd_cache, fpmath);
+        if (!pd_) {
+            is_initialized_ = false;
+        } else {
+            status_t s = pd_->create_primitive(prim_, p_engine.get());
+            is_initialized_ = s == status::success ? true : false;
+        }
+    }
+
+    // Returns nullptr if the gated mlp primitive does not support the op.
+    static std::shared_ptr<primitive_desc_t> create_desc(
+            std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath);
+
+    bool is_initialized() const { return is_initialized_; }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        exec_args_t exec_args;
+        exec_args[DNNL_ARG_SRC] = {(args.at(DNNL_ARG_SRC)).get(), true};
+        exec_args[DNNL_ARG_WEIGHTS_GATE]
+                = {(args.at(DNNL_ARG_WEIGHTS_GATE)).get(), true};
+        exec_args[DNNL_ARG_WEIGHTS_UP]
+                = {(args.at(DNNL_ARG_WEIGHTS_UP)).get(), true};
+        exec_args[DNNL_ARG_WEIGHTS_DOWN]
+                = {(args.at(DNNL_ARG_WEIGHTS_DOWN)).get(), true};
+        exec_args[DNNL_ARG_DST] = {(args.at(DNNL_ARG_DST)).get(), false};
+        exec_args[DNNL_ARG_SCRATCHPAD]
+                = {args.find(DNNL_ARG_SCRATCHPAD) != args.end()
+                                ? (args.at(DNNL_ARG_SCRATCHPAD)).get()
+                                : nullptr,
+                        false};
+
+        exec_ctx_t ctx(stream.get(), std::move(exec_args));
+        execute_internal_primitive(prim_, ctx);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        // The gated mlp primitive is implemented for CPU only.
+        assert(!"unimplemented");
+        return {};
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        // The gated mlp primitive is implemented for CPU only.
+        assert(!"unimplemented");
+        return {};
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    std::shared_ptr<primitive_desc_t> pd_;
+    std::shared_ptr<primitive_t> prim_;
+    bool is_initialized_ = false;
+};
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
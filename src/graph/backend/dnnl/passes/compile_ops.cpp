@@ -73,6 +73,14 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
                     "failed to create executable for op %s",
                     op->get_name().c_str());
         }
+        if (cur_op->get_kind() == op_kind::dnnl_gated_mlp) {
+            auto gated_mlp_exec
+                    = std::dynamic_pointer_cast<gated_mlp_executable_t>(exec);
+            VCHECK_COMPILE_OPS(gated_mlp_exec->is_initialized(),
+                    status::unimplemented,
+                    "failed to create executable for op %s",
+                    op->get_name().c_str());
+        }
         sg->execs_.emplace_back(exec);
 
         sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
@@ -4530,6 +4530,146 @@ status_t fuse_sdpa(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+namespace {
+
+// Returns the producer of the value if it is an op of the given kind with a
+// single consumer of its output, nullptr otherwise.
+op_ptr get_single_use_producer(const value_ptr &val, op_kind_t kind) {
+    if (!val->has_producer()) return nullptr;
+    op_t &producer = val->get_producer();
+    if (producer.get_kind() != kind) return nullptr;
+    if (producer.get_output_value(0)->get_consumers().size() != 1)
+        return nullptr;
+    return producer.shared_from_this();
+}
+
+// A matmul without bias, transposes and fused operations, with 2D weights.
+bool is_plain_matmul(const op_ptr &op) {
+    if (!op || op->get_kind() != op_kind::dnnl_matmul) return false;
+    if (op->num_inputs() != 2 || op->has_attr(op_attr::fusion_info))
+        return false;
+    for (auto attr : {op_attr::transpose_a, op_attr::transpose_b})
+        if (op->has_attr(attr) && op->get_attr<bool>(attr)) return false;
+    return ltw(op->get_input_value(1)->get_logical_tensor()).ndims() == 2;
+}
+
+bool is_binary(const op_ptr &op, dnnl::algorithm alg) {
+    return op && op->get_kind() == op_kind::dnnl_binary
+            && !op->has_attr(op_attr::fusion_info)
+            && static_cast<dnnl::algorithm>(
+                       op->get_attr<int64_t>(op_attr::alg_kind))
+            == alg;
+}
+
+} // namespace
+
+status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg) {
+    using algorithm = dnnl::algorithm;
+
+    for (auto &down : sg->get_ops()) {
+        if (!is_plain_matmul(down)) continue;
+
+        // hidden = act(src * W_gate) x (src * W_up)
+        auto mul = get_single_use_producer(
+                down->get_input_value(0), op_kind::dnnl_binary);
+        if (!is_binary(mul, algorithm::binary_mul)) continue;
+
+        for (size_t gate_idx = 0; gate_idx < 2; gate_idx++) {
+            std::vector<op_ptr> fused_ops {down, mul};
+            auto up = get_single_use_producer(
+                    mul->get_input_value(1 - gate_idx), op_kind::dnnl_matmul);
+            if (!is_plain_matmul(up)) continue;
+            fused_ops.push_back(up);
+
+            auto gate_val = mul->get_input_value(gate_idx);
+            if (!gate_val->has_producer()) continue;
+            auto act = gate_val->get_producer().shared_from_this();
+            if (gate_val->get_consumers().size() != 1) continue;
+
+            op_ptr gate;
+            algorithm alg = algorithm::undef;
+            float alpha = 0.f, beta = 0.f;
+            if (act->get_kind() == op_kind::dnnl_eltwise
+                    && !act->has_attr(op_attr::fusion_info)) {
+                // act(src * W_gate)
+                alg = static_cast<algorithm>(
+                        act->get_attr<int64_t>(op_attr::alg_kind));
+                if (act->has_attr(op_attr::alpha))
+                    alpha = act->get_attr<float>(op_attr::alpha);
+                if (act->has_attr(op_attr::beta))
+                    beta = act->get_attr<float>(op_attr::beta);
+                gate = get_single_use_producer(
+                        act->get_input_value(0), op_kind::dnnl_matmul);
+                fused_ops.push_back(act);
+            } else if (is_binary(act, algorithm::binary_mul)) {
+                // Swish decomposed to x * sigmoid(x) where x = src * W_gate.
+                for (size_t x_idx = 0; x_idx < 2 && !gate; x_idx++) {
+                    auto x_val = act->get_input_value(x_idx);
+                    auto sig_val = act->get_input_value(1 - x_idx);
+                    if (!x_val->has_producer() || !sig_val->has_producer())
+                        continue;
+                    auto sig = sig_val->get_producer().shared_from_this();
+                    if (sig->get_kind() != op_kind::dnnl_eltwise
+                            || sig->has_attr(op_attr::fusion_info)
+                            || sig_val->get_consumers().size() != 1
+                            || static_cast<algorithm>(sig->get_attr<int64_t>(
+                                       op_attr::alg_kind))
+                                    != algorithm::eltwise_logistic
+                            || sig->get_input_value(0) != x_val
+                            || x_val->get_consumers().size() != 2)
+                        continue;
+                    auto x = x_val->get_producer().shared_from_this();
+                    if (x->get_kind() != op_kind::dnnl_matmul) continue;
+                    gate = x;
+                    alg = algorithm::eltwise_swish;
+                    alpha = 1.f;
+                    fused_ops.push_back(act);
+                    fused_ops.push_back(sig);
+                }
+            }
+            if (!is_plain_matmul(gate)) continue;
+            fused_ops.push_back(gate);
+
+            // The gate and the up projections read the same tokens.
+            if (gate->get_input_value(0) != up->get_input_value(0)) continue;
+
+            subgraph_rewriter_t rewriter(sg);
+            op_ptr gated_mlp_op
+                    = std::make_shared<op_t>(op_kind::dnnl_gated_mlp);
+            gated_mlp_op->set_attr<int64_t>(
+                    op_attr::alg_kind, static_cast<int64_t>(alg));
+            gated_mlp_op->set_attr<float>(op_attr::alpha, alpha);
+            gated_mlp_op->set_attr<float>(op_attr::beta, beta);
+
+            auto src_val = gate->get_input_value(0);
+            src_val->remove_consumer(*gate, 0);
+            src_val->remove_consumer(*up, 0);
+            gated_mlp_op->connect_input(0, src_val);
+            const std::pair<op_ptr, size_t> weights[]
+                    = {{gate, 1}, {up, 1}, {down, 1}};
+            size_t input_idx = 1;
+            for (const auto &w : weights) {
+                auto w_val = w.first->get_input_value(w.second);
+                w_val->remove_consumer(*w.first, w.second);
+                gated_mlp_op->connect_input(input_idx++, w_val);
+            }
+
+            auto dst_val = down->get_output_value(0);
+            dst_val->set_producer(*gated_mlp_op);
+            gated_mlp_op->add_output(dst_val);
+            insert_empty_scratchpad(gated_mlp_op);
+
+            for (auto &op : fused_ops)
+                rewriter.to_remove(op);
+            rewriter.to_insert(gated_mlp_op);
+            rewriter.run();
+            return infer_shape(sg);
+        }
+    }
+
+    return status::unimplemented;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
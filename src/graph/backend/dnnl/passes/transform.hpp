@@ -300,6 +300,11 @@ status_t fuse_implicit_causal_mask(std::shared_ptr<subgraph_t> &sg);
 /// This pass will transform the sdpa subgraph into a dnnl_sdpa op.
 status_t fuse_sdpa(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will transform the gated mlp subgraph into a dnnl_gated_mlp op.
+/// It returns unimplemented if the subgraph is not a gated mlp supported by
+/// the primitive.
+status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
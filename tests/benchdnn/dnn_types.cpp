@@ -1018,8 +1018,13 @@ std::ostream &operator<<(
             const int arg = args[i];
             if (!sparse_options.is_encoding_def(arg)) {
                 s << sparse_options.get_encoding(arg);
-                if (!sparse_options.is_sparsity_def(arg))
+                // The distribution is positional, so the sparsity is printed
+                // whenever the distribution is not the default one.
+                if (!sparse_options.is_sparsity_def(arg)
+                        || !sparse_options.is_distribution_def(arg))
                     s << "+" << sparse_options.get_sparsity(arg);
+                if (!sparse_options.is_distribution_def(arg))
+                    s << "+skewed";
             }
             if (i != (int)args.size() - 1)
                 s << ":";
@@ -1986,9 +1991,18 @@ int sparse_options_t::from_str(const std::string &s) {
             auto encoding_str = parser::get_substr(subs, subs_pos, '+');
             auto sparsity_str = parser::get_substr(subs, subs_pos, '+');
             if (encoding_str.empty() || sparsity_str.empty()) { return FAIL; }
+            auto distribution = sparse_options_t::def_distribution;
+            if (subs_pos != std::string::npos) {
+                auto distribution_str
+                        = parser::get_substr(subs, subs_pos, '+');
+                if (distribution_str == "skewed")
+                    distribution = sparse_options_t::skewed;
+                else if (distribution_str != "uniform")
+                    return FAIL;
+            }
             add(get_arg(options_count),
                     str2sparse_encoding(encoding_str.c_str()),
-                    atof(sparsity_str.c_str()));
+                    atof(sparsity_str.c_str()), distribution);
         }
         options_count++;
     }
@@ -572,22 +572,31 @@ struct isa_hints_t {
 using policy_t = attr_t::policy_t;
 
 struct sparse_options_t {
+    // Distribution of non-zero elements across the rows of a tensor.
+    // `uniform` spreads them evenly (with a bounded random deviation),
+    // `skewed` follows a power law: few rows hold most of the elements, as
+    // in recommendation features.
+    enum distribution_t { uniform = 0, skewed };
+
     static constexpr dnnl_sparse_encoding_t def_encoding
             = dnnl_sparse_encoding_undef;
     static constexpr float def_sparsity = 0.9f;
+    static constexpr distribution_t def_distribution = uniform;
 
     sparse_options_t() = default;
-    sparse_options_t(int arg, dnnl_sparse_encoding_t encoding, float sparsity) {
-        add(arg, encoding, sparsity);
+    sparse_options_t(int arg, dnnl_sparse_encoding_t encoding, float sparsity,
+            distribution_t distribution = def_distribution) {
+        add(arg, encoding, sparsity, distribution);
     }
 
-    void add(int arg, dnnl_sparse_encoding_t encoding, float sparsity) {
-        options_.insert({arg, {encoding, sparsity}});
+    void add(int arg, dnnl_sparse_encoding_t encoding, float sparsity,
+            distribution_t distribution = def_distribution) {
+        options_.insert({arg, {encoding, sparsity, distribution}});
     }
 
     dnnl_sparse_encoding_t get_encoding(int arg) const {
         if (options_.count(arg) == 0) return dnnl_sparse_encoding_undef;
-        return options_.at(arg).first;
+        return options_.at(arg).encoding;
     }
     dnnl_sparse_encoding_t get_encoding(data_kind_t kind) const {
         // Note: the commented code doesn't work as `arg` returned is a
@@ -603,7 +612,19 @@ struct sparse_options_t {
 
     float get_sparsity(int arg) const {
         if (options_.count(arg) == 0) return 0.0f;
-        return options_.at(arg).second;
+        return options_.at(arg).sparsity;
+    }
+
+    distribution_t get_distribution(int arg) const {
+        if (options_.count(arg) == 0) return def_distribution;
+        return options_.at(arg).distribution;
+    }
+    distribution_t get_distribution(data_kind_t kind) const {
+        switch (kind) {
+            case SRC: return get_distribution(DNNL_ARG_SRC);
+            case WEI: return get_distribution(DNNL_ARG_WEIGHTS);
+            default: return def_distribution;
+        }
     }
 
     bool is_encoding_def(int arg) const {
@@ -614,11 +635,16 @@ struct sparse_options_t {
         return get_sparsity(arg) == def_sparsity;
     }
 
+    bool is_distribution_def(int arg) const {
+        return get_distribution(arg) == def_distribution;
+    }
+
     bool is_def() const {
         bool ret = true;
         for (const auto &opt : options_) {
             ret = ret && is_encoding_def(opt.first)
-                    && is_sparsity_def(opt.first);
+                    && is_sparsity_def(opt.first)
+                    && is_distribution_def(opt.first);
         }
         return ret;
     }
@@ -635,7 +661,12 @@ struct sparse_options_t {
     int from_str(const std::string &s);
 
 private:
-    std::unordered_map<int, std::pair<dnnl_sparse_encoding_t, float>> options_;
+    struct option_t {
+        dnnl_sparse_encoding_t encoding;
+        float sparsity;
+        distribution_t distribution;
+    };
+    std::unordered_map<int, option_t> options_;
 };
 
 std::ostream &operator<<(
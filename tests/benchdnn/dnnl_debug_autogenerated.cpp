@@ -70,6 +70,8 @@ dnnl_sparse_encoding_t str2sparse_encoding(const char *str) {
     CASE(csr);
     CASE(packed);
     CASE(coo);
+    CASE(structured);
+    CASE(bsr);
 #undef CASE
     if (!strcmp("undef", str) || !strcmp("dnnl_sparse_encoding_undef", str))
         return dnnl_sparse_encoding_undef;
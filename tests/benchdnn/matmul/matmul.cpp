@@ -239,10 +239,23 @@ int fill_sparse_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
     std::uniform_int_distribution<> pointers_gen(0, avg_nnz_per_row * coef);
     std::minstd_rand pointers_seed;
 
+    const bool is_skewed = prb->sparse_options.get_distribution(kind)
+            == sparse_options_t::skewed;
+    // For the skewed distribution the i-th row gets a share of nnz
+    // proportional to 1 / (i + 1) (Zipf's law).
+    double harmonic_sum = 0;
+    if (is_skewed) {
+        for (int64_t i = 0; i < dim0; i++)
+            harmonic_sum += 1.0 / (i + 1);
+    }
+
     // Distribute nnz across all rows.
     std::vector<int64_t> distributed_nnz(dim0);
     for (int64_t i = 0; i < dim0; i++) {
-        int64_t nnz_per_row = std::min(pointers_gen(pointers_seed), (int)dim1);
+        int64_t nnz_per_row = is_skewed
+                ? static_cast<int64_t>(nnz / harmonic_sum / (i + 1))
+                : pointers_gen(pointers_seed);
+        nnz_per_row = std::min(nnz_per_row, dim1);
         nnz_per_row = std::min(nnz_per_row, (nnz - distributed_nnz_cnt));
         distributed_nnz[i] = nnz_per_row;
         distributed_nnz_cnt += nnz_per_row;
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_GATED_MLP_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_GATED_MLP_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a gated MLP primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor [mb, ic].
+/// @param w_gate_desc Gate weights memory descriptor [ic, hidden].
+/// @param w_up_desc Up weights memory descriptor [ic, hidden].
+/// @param w_down_desc Down weights memory descriptor [hidden, oc].
+/// @param dst_desc Destination memory descriptor [mb, oc].
+/// @param activation Eltwise algorithm applied to the gate projection.
+/// @param alpha Alpha parameter of the activation.
+/// @param beta Beta parameter of the activation.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API gated_mlp_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t w_gate_desc,
+        const_dnnl_memory_desc_t w_up_desc,
+        const_dnnl_memory_desc_t w_down_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_alg_kind_t activation,
+        float alpha, float beta, const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Gated MLP internal primitive.
+struct gated_mlp : public dnnl::primitive {
+    /// Primitive descriptor for a gated MLP primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &w_gate_desc,
+                const memory::desc &w_up_desc,
+                const memory::desc &w_down_desc,
+                const memory::desc &dst_desc, algorithm activation,
+                float alpha = 1.f, float beta = 0.f,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = gated_mlp_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), w_gate_desc.get(),
+                    w_up_desc.get(), w_down_desc.get(), dst_desc.get(),
+                    (dnnl_alg_kind_t)activation, alpha, beta, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a gated MLP "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    gated_mlp() = default;
+
+    /// Constructs a gated MLP primitive.
+    /// @param pd Primitive descriptor for a gated MLP primitive.
+    gated_mlp(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
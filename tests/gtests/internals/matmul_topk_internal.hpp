@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_MATMUL_TOPK_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_MATMUL_TOPK_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a matmul top-k primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor [m, k].
+/// @param weights_desc Weights memory descriptor [k, n].
+/// @param dst_values_desc Selected values memory descriptor [m, topk].
+/// @param dst_indices_desc Selected indices memory descriptor [m, topk].
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API matmul_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_values_desc,
+        const_dnnl_memory_desc_t dst_indices_desc,
+        const_dnnl_primitive_attr_t attr);
+
+namespace dnnl {
+namespace impl {
+
+/// Matmul top-k internal primitive.
+struct matmul_topk : public dnnl::primitive {
+    /// Primitive descriptor for a matmul top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &dst_values_desc,
+                const memory::desc &dst_indices_desc,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = matmul_topk_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), weights_desc.get(),
+                    dst_values_desc.get(), dst_indices_desc.get(),
+                    attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a matmul "
+                    "top-k primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    matmul_topk() = default;
+
+    /// Constructs a matmul top-k primitive.
+    /// @param pd Primitive descriptor for a matmul top-k primitive.
+    matmul_topk(const primitive_desc &pd) : primitive(pd) {}
+};
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_POOLING_POST_OP_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_POOLING_POST_OP_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Appends a pooling post-op. The destination is pooled over the spatial
+/// dimensions with a `kernel x kernel` window moved by `stride` points, and
+/// `padding` points are added on the top and on the left. The destination of
+/// the primitive becomes the pooled tensor, so its memory descriptor must be
+/// queried from the primitive descriptor.
+///
+/// @param post_ops Post-ops.
+/// @param alg Pooling algorithm: #dnnl_pooling_max,
+///     #dnnl_pooling_avg_include_padding or #dnnl_pooling_avg_exclude_padding.
+/// @param kernel Size of the pooling window.
+/// @param stride Stride of the pooling window.
+/// @param padding Padding, must be smaller than the window.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API pooling_post_ops_append(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg, dnnl_dim_t kernel, dnnl_dim_t stride,
+        dnnl_dim_t padding);
+
+namespace dnnl {
+namespace impl {
+
+/// Appends a pooling post-op to `po`.
+inline void append_pooling(post_ops &po, algorithm alg, memory::dim kernel,
+        memory::dim stride, memory::dim padding) {
+    dnnl::error::wrap_c_api(pooling_post_ops_append(po.get(),
+                                    static_cast<dnnl_alg_kind_t>(alg), kernel,
+                                    stride, padding),
+            "could not append a pooling post-op");
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
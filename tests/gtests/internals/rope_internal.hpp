@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef DNNL_TEST_INTERNAL_ROPE_INTERNAL_HPP
+#define DNNL_TEST_INTERNAL_ROPE_INTERNAL_HPP
+
+#include "dnnl.hpp"
+
+// NOLINTBEGIN(readability-identifier-naming)
+
+/// Creates a primitive descriptor for a RoPE primitive
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor [batch, heads, seq_len, head].
+/// @param cos_desc Cosine table memory descriptor [positions, rotary / 2].
+/// @param sin_desc Sine table memory descriptor [positions, rotary / 2].
+/// @param pos_desc Positions memory descriptor [batch, seq_len] (can be NULL,
+///     then token s has position s).
+/// @param dst_desc Destination memory descriptor.
+/// @param layout Pairing of the rotated elements (dnnl_rope_layout_t).
+/// @param rotary_dims Number of rotated elements of every head.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t cos_desc,
+        const_dnnl_memory_desc_t sin_desc, const_dnnl_memory_desc_t pos_desc,
+        const_dnnl_memory_desc_t dst_desc, int layout, dnnl_dim_t rotary_dims,
+        const_dnnl_primitive_attr_t attr);
+
+/// Appends a RoPE post-op. The destination rows are split into heads of
+/// `head_size` elements, the first `rotary_dims` elements of every head are
+/// rotated. The post-op takes the cosine and the sine tables as
+/// DNNL_ARG_SRC_1 and DNNL_ARG_SRC_2 and the s32 position of every
+/// destination row as DNNL_ARG_SRC_3.
+///
+/// @param post_ops Post-ops.
+/// @param layout Pairing of the rotated elements (dnnl_rope_layout_t).
+/// @param head_size Number of elements in a head.
+/// @param rotary_dims Number of rotated elements of every head.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API rope_post_ops_append(dnnl_post_ops_t post_ops,
+        int layout, dnnl_dim_t head_size, dnnl_dim_t rotary_dims);
+
+namespace dnnl {
+namespace impl {
+
+/// RoPE internal primitive.
+struct rope : public dnnl::primitive {
+    /// Primitive descriptor for a RoPE primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &cos_desc, const memory::desc &sin_desc,
+                const memory::desc &pos_desc, const memory::desc &dst_desc,
+                int layout, memory::dim rotary_dims,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = rope_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), cos_desc.get(),
+                    sin_desc.get(), pos_desc.get(), dst_desc.get(), layout,
+                    rotary_dims, attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a RoPE "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope() = default;
+
+    /// Constructs a RoPE primitive.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    rope(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// Appends a RoPE post-op to `po`.
+inline void append_rope(post_ops &po, int layout, memory::dim head_size,
+        memory::dim rotary_dims) {
+    dnnl::error::wrap_c_api(
+            rope_post_ops_append(po.get(), layout, head_size, rotary_dims),
+            "could not append a RoPE post-op");
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// NOLINTEND(readability-identifier-naming)
+#endif
@@ -46,6 +46,34 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         const_dnnl_primitive_attr_t kq_attr,
         const_dnnl_primitive_attr_t vs_attr);
 
+/// Creates a primitive descriptor for a scaled dot product attention primitive
+/// reading K and V from a paged KV cache
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param query_desc Query memory descriptor (tensor Q)
+/// @param key_desc Key pool memory descriptor [pages, kv_heads, D, page]
+/// @param value_desc Value pool memory descriptor [pages, kv_heads, page, Dv]
+/// @param dst_desc Destination memory descriptor.
+/// @param attn_mask_desc Attention mask memory descriptor.
+/// @param kv_page_size Number of tokens in a page.
+/// @param block_table_desc Block table memory descriptor [batch, max_pages].
+/// @param seq_lens_desc Sequence lengths memory descriptor [batch].
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+
+dnnl_status_t DNNL_API sdpa_paged_kv_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t mask_desc, const_dnnl_memory_desc_t scale_desc,
+        bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, dnnl_dim_t kv_page_size,
+        const_dnnl_memory_desc_t block_table_desc,
+        const_dnnl_memory_desc_t seq_lens_desc,
+        const_dnnl_primitive_attr_t attr);
+
 namespace dnnl {
 namespace impl {
 
@@ -81,6 +109,31 @@ struct sdpa : public dnnl::primitive {
                     "primitive");
             reset(pd);
         }
+
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc *attn_mask_desc,
+                const memory::desc &scale_desc, const memory::desc &output_desc,
+                bool invert_scale, memory::dim kv_head_number,
+                int attn_mask_type, int softmax_alg, memory::dim kv_page_size,
+                const memory::desc &block_table_desc,
+                const memory::desc &seq_lens_desc,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = sdpa_paged_kv_primitive_desc_create(&pd,
+                    aengine.get(), query_desc.get(), key_desc.get(),
+                    value_desc.get(), output_desc.get(),
+                    optional_arg(attn_mask_desc), scale_desc.get(),
+                    invert_scale, kv_head_number, attn_mask_type,
+                    (dnnl_alg_kind_t)softmax_alg, kv_page_size,
+                    block_table_desc.get(), seq_lens_desc.get(), attr.get());
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a paged KV "
+                    "sdpa primitive");
+            reset(pd);
+        }
     };
 
     /// Default constructor. Produces an empty object.
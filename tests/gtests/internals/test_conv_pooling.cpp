@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "pooling_post_op_internal.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct conv_pooling_test_params_t {
+    memory::dim mb, ic, oc, ih, iw;
+    memory::dim kernel, stride, padding;
+    algorithm pool_alg;
+    memory::dim pool_kernel, pool_stride, pool_padding;
+    bool with_bias;
+    bool with_relu;
+};
+
+std::ostream &operator<<(
+        std::ostream &ss, const conv_pooling_test_params_t &p) {
+    ss << "mb" << p.mb << "ic" << p.ic << "oc" << p.oc << "ih" << p.ih << "iw"
+       << p.iw << "k" << p.kernel << "s" << p.stride << "p" << p.padding << "_"
+       << dnnl_alg_kind2str(static_cast<dnnl_alg_kind_t>(p.pool_alg)) << "k"
+       << p.pool_kernel << "s" << p.pool_stride << "p" << p.pool_padding
+       << (p.with_bias ? "_bias" : "") << (p.with_relu ? "_relu" : "");
+    return ss;
+}
+
+namespace {
+
+void fill_random(memory &mem, std::minstd_rand &gen) {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto *ptr = static_cast<float *>(mem.get_data_handle());
+    const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ptr[i] = dist(gen);
+}
+
+} // namespace
+
+class conv_pooling_test_t
+    : public ::testing::TestWithParam<conv_pooling_test_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        strm = stream(eng);
+    }
+
+    engine eng;
+    stream strm;
+};
+
+// The convolution with the post-op is compared with a plain convolution
+// followed by a reference pooling of its output.
+TEST_P(conv_pooling_test_t, compare) {
+    const auto p = GetParam();
+    const memory::dim oh = (p.ih + 2 * p.padding - p.kernel) / p.stride + 1;
+    const memory::dim ow = (p.iw + 2 * p.padding - p.kernel) / p.stride + 1;
+    const memory::dim pad_r_h
+            = (oh - 1) * p.stride + p.kernel - p.ih - p.padding;
+    const memory::dim pad_r_w
+            = (ow - 1) * p.stride + p.kernel - p.iw - p.padding;
+
+    const memory::desc src_md({p.mb, p.ic, p.ih, p.iw}, mdt::f32, tag::nhwc);
+    const memory::desc wei_md(
+            {p.oc, p.ic, p.kernel, p.kernel}, mdt::f32, tag::hwio);
+    const memory::desc bia_md = p.with_bias
+            ? memory::desc({p.oc}, mdt::f32, tag::a)
+            : memory::desc();
+    const memory::desc conv_dst_md({p.mb, p.oc, oh, ow}, mdt::f32, tag::nhwc);
+    const memory::dims strides {p.stride, p.stride};
+    const memory::dims pad_l {p.padding, p.padding};
+    const memory::dims pad_r {pad_r_h, pad_r_w};
+
+    post_ops conv_po;
+    if (p.with_relu) conv_po.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr conv_attr;
+    conv_attr.set_post_ops(conv_po);
+
+    post_ops po = conv_po;
+    impl::append_pooling(
+            po, p.pool_alg, p.pool_kernel, p.pool_stride, p.pool_padding);
+    primitive_attr attr;
+    attr.set_post_ops(po);
+
+    convolution_forward::primitive_desc pd;
+    try {
+        pd = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, conv_dst_md, strides, pad_l, pad_r,
+                attr);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    const memory::dim ph
+            = (oh + 2 * p.pool_padding - p.pool_kernel) / p.pool_stride + 1;
+    const memory::dim pw
+            = (ow + 2 * p.pool_padding - p.pool_kernel) / p.pool_stride + 1;
+    const memory::desc dst_md = pd.dst_desc();
+    ASSERT_EQ(dst_md.get_dims(), (memory::dims {p.mb, p.oc, ph, pw}));
+
+    memory src(src_md, eng), wei(wei_md, eng), bia(bia_md, eng);
+    std::minstd_rand gen(7);
+    fill_random(src, gen);
+    fill_random(wei, gen);
+    if (p.with_bias) fill_random(bia, gen);
+
+    memory dst(dst_md, eng), conv_dst(conv_dst_md, eng);
+    convolution_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+    convolution_forward(convolution_forward::primitive_desc(eng,
+                                prop_kind::forward_inference,
+                                algorithm::convolution_direct, src_md, wei_md,
+                                bia_md, conv_dst_md, strides, pad_l, pad_r,
+                                conv_attr))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, conv_dst}});
+    strm.wait();
+
+    const auto *conv_ptr
+            = static_cast<const float *>(conv_dst.get_data_handle());
+    const auto *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    const bool is_max = p.pool_alg == algorithm::pooling_max;
+    for_(memory::dim n = 0; n < p.mb; n++)
+    for_(memory::dim y = 0; y < ph; y++)
+    for_(memory::dim x = 0; x < pw; x++)
+    for (memory::dim c = 0; c < p.oc; c++) {
+        float ref = is_max ? std::numeric_limits<float>::lowest() : 0.f;
+        memory::dim num = 0;
+        for_(memory::dim i = 0; i < p.pool_kernel; i++)
+        for (memory::dim j = 0; j < p.pool_kernel; j++) {
+            const memory::dim h = y * p.pool_stride - p.pool_padding + i;
+            const memory::dim w = x * p.pool_stride - p.pool_padding + j;
+            if (h < 0 || h >= oh || w < 0 || w >= ow) continue;
+            const float v = conv_ptr[((n * oh + h) * ow + w) * p.oc + c];
+            ref = is_max ? std::max(ref, v) : ref + v;
+            num++;
+        }
+        if (p.pool_alg == algorithm::pooling_avg_include_padding)
+            ref /= static_cast<float>(p.pool_kernel * p.pool_kernel);
+        else if (p.pool_alg == algorithm::pooling_avg_exclude_padding)
+            ref /= static_cast<float>(num);
+        ASSERT_NEAR(dst_ptr[((n * ph + y) * pw + x) * p.oc + c], ref, 1e-4f)
+                << "mb: " << n << " oh: " << y << " ow: " << x << " oc: " << c;
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(CPU, conv_pooling_test_t,
+        ::testing::Values(
+                conv_pooling_test_params_t {2, 16, 32, 14, 14, 3, 1, 1, algorithm::pooling_max, 2, 2, 0, true, true},
+                conv_pooling_test_params_t {1, 8, 24, 15, 13, 3, 1, 1, algorithm::pooling_max, 3, 2, 1, false, true},
+                conv_pooling_test_params_t {1, 3, 64, 23, 23, 7, 2, 3, algorithm::pooling_max, 3, 2, 1, true, true},
+                conv_pooling_test_params_t {2, 32, 80, 9, 11, 1, 1, 0, algorithm::pooling_avg_include_padding, 2, 2, 0, true, false},
+                conv_pooling_test_params_t {1, 16, 16, 10, 10, 3, 1, 1, algorithm::pooling_avg_exclude_padding, 3, 2, 1, false, false},
+                conv_pooling_test_params_t {1, 16, 16, 10, 10, 3, 1, 1, algorithm::pooling_avg_include_padding, 3, 2, 1, true, false}));
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "gated_mlp_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct gated_mlp_test_params_t {
+    memory::dim mb;
+    memory::dim ic;
+    memory::dim hidden;
+    memory::dim oc;
+    algorithm activation;
+    mdt dt;
+};
+
+std::ostream &operator<<(std::ostream &ss, const gated_mlp_test_params_t &p) {
+    ss << "mb" << p.mb << "ic" << p.ic << "hidden" << p.hidden << "oc"
+       << p.oc << "_" << dnnl_alg_kind2str(static_cast<dnnl_alg_kind_t>(
+                                 p.activation))
+       << "_" << dnnl_dt2str(static_cast<dnnl_data_type_t>(p.dt));
+    return ss;
+}
+
+// The fused primitive is compared with the unfused sequence of matmul,
+// eltwise and binary operations executed in f32.
+class gated_mlp_test_t
+    : public ::testing::TestWithParam<gated_mlp_test_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        strm = stream(eng);
+        p = GetParam();
+    }
+
+    // Fills the memory with values representable in all the data types so
+    // that the reference does not depend on the conversion of the inputs.
+    static void fill(memory &mem, std::minstd_rand &gen) {
+        std::uniform_int_distribution<int> dist(-16, 16);
+        auto *ptr = static_cast<float *>(mem.get_data_handle());
+        const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = dist(gen) / 64.f;
+    }
+
+    memory convert(memory &mem, mdt dt) {
+        memory::desc md(mem.get_desc().get_dims(), dt, tag::ab);
+        memory out(md, eng);
+        reorder(mem, out).execute(strm, mem, out);
+        strm.wait();
+        return out;
+    }
+
+    engine eng;
+    stream strm;
+    gated_mlp_test_params_t p;
+};
+
+TEST_P(gated_mlp_test_t, compare) {
+    const memory::desc src_md({p.mb, p.ic}, mdt::f32, tag::ab);
+    const memory::desc w_gate_md({p.ic, p.hidden}, mdt::f32, tag::ab);
+    const memory::desc w_down_md({p.hidden, p.oc}, mdt::f32, tag::ab);
+    const memory::desc hidden_md({p.mb, p.hidden}, mdt::f32, tag::ab);
+    const memory::desc dst_md({p.mb, p.oc}, mdt::f32, tag::ab);
+
+    memory src(src_md, eng), w_gate(w_gate_md, eng), w_up(w_gate_md, eng);
+    memory w_down(w_down_md, eng);
+    std::minstd_rand gen(p.mb * 131 + p.hidden);
+    fill(src, gen);
+    fill(w_gate, gen);
+    fill(w_up, gen);
+    fill(w_down, gen);
+
+    const float alpha = 1.f;
+    const float beta = 0.f;
+
+    memory f_src = convert(src, p.dt), f_w_gate = convert(w_gate, p.dt);
+    memory f_w_up = convert(w_up, p.dt), f_w_down = convert(w_down, p.dt);
+    memory f_dst(memory::desc({p.mb, p.oc}, p.dt, tag::ab), eng);
+
+    impl::gated_mlp::primitive_desc pd;
+    try {
+        pd = impl::gated_mlp::primitive_desc(eng, f_src.get_desc(),
+                f_w_gate.get_desc(), f_w_up.get_desc(), f_w_down.get_desc(),
+                f_dst.get_desc(), p.activation, alpha, beta);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::gated_mlp(pd).execute(strm,
+            {{DNNL_ARG_SRC, f_src}, {DNNL_ARG_WEIGHTS_GATE, f_w_gate},
+                    {DNNL_ARG_WEIGHTS_UP, f_w_up},
+                    {DNNL_ARG_WEIGHTS_DOWN, f_w_down},
+                    {DNNL_ARG_DST, f_dst}});
+    strm.wait();
+
+    // Reference: gate = act(src * W_gate), hidden = (src * W_up) x gate,
+    // dst = hidden * W_down.
+    memory gate(hidden_md, eng), hidden(hidden_md, eng), ref(dst_md, eng);
+    post_ops gate_po;
+    gate_po.append_eltwise(p.activation, alpha, beta);
+    primitive_attr gate_attr;
+    gate_attr.set_post_ops(gate_po);
+    matmul(matmul::primitive_desc(eng, src_md, w_gate_md, hidden_md, gate_attr))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, w_gate},
+                            {DNNL_ARG_DST, gate}});
+
+    post_ops up_po;
+    up_po.append_binary(algorithm::binary_mul, hidden_md);
+    primitive_attr up_attr;
+    up_attr.set_post_ops(up_po);
+    matmul(matmul::primitive_desc(eng, src_md, w_gate_md, hidden_md, up_attr))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, w_up},
+                            {DNNL_ARG_DST, hidden},
+                            {DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1,
+                                    gate}});
+
+    matmul(matmul::primitive_desc(eng, hidden_md, w_down_md, dst_md))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, hidden}, {DNNL_ARG_WEIGHTS, w_down},
+                            {DNNL_ARG_DST, ref}});
+    strm.wait();
+
+    memory dst = convert(f_dst, mdt::f32);
+    const auto *ref_ptr = static_cast<const float *>(ref.get_data_handle());
+    const auto *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    // The hidden activations are rounded to the source data type before the
+    // down projection.
+    const float rtol = p.dt == mdt::f32 ? 1e-5f : 1e-2f;
+    for (memory::dim i = 0; i < p.mb * p.oc; i++) {
+        const float diff = std::fabs(dst_ptr[i] - ref_ptr[i]);
+        ASSERT_LE(diff, rtol * std::max(1.f, std::fabs(ref_ptr[i])))
+                << "index: " << i << " ref: " << ref_ptr[i]
+                << " got: " << dst_ptr[i];
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(CPU_f32, gated_mlp_test_t,
+        ::testing::Values(
+                gated_mlp_test_params_t {1, 64, 256, 64, algorithm::eltwise_swish, mdt::f32},
+                gated_mlp_test_params_t {7, 96, 200, 80, algorithm::eltwise_swish, mdt::f32},
+                gated_mlp_test_params_t {45, 64, 130, 48, algorithm::eltwise_gelu_erf, mdt::f32},
+                gated_mlp_test_params_t {33, 32, 64, 32, algorithm::eltwise_gelu_tanh, mdt::f32},
+                gated_mlp_test_params_t {16, 48, 100, 40, algorithm::eltwise_relu, mdt::f32}));
+INSTANTIATE_TEST_SUITE_P(CPU_f16, gated_mlp_test_t,
+        ::testing::Values(
+                gated_mlp_test_params_t {1, 64, 256, 64, algorithm::eltwise_swish, mdt::f16},
+                gated_mlp_test_params_t {37, 96, 200, 80, algorithm::eltwise_swish, mdt::f16}));
+// clang-format on
+
+} // namespace dnnl
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "matmul_topk_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+struct matmul_topk_test_params_t {
+    memory::dim m;
+    memory::dim k;
+    memory::dim n;
+    memory::dim topk;
+    mdt dt;
+};
+
+std::ostream &operator<<(std::ostream &ss, const matmul_topk_test_params_t &p) {
+    ss << "m" << p.m << "k" << p.k << "n" << p.n << "topk" << p.topk << "_"
+       << dnnl_dt2str(static_cast<dnnl_data_type_t>(p.dt));
+    return ss;
+}
+
+// The fused primitive is compared with a matmul followed by a stable sort of
+// every row of the logits. The inputs are chosen so that the logits are exact
+// in f32, hence the selection is expected to match bit to bit, including the
+// resolution of ties.
+class matmul_topk_test_t
+    : public ::testing::TestWithParam<matmul_topk_test_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        strm = stream(eng);
+        p = GetParam();
+    }
+
+    static void fill(memory &mem, std::minstd_rand &gen) {
+        std::uniform_int_distribution<int> dist(-16, 16);
+        auto *ptr = static_cast<float *>(mem.get_data_handle());
+        const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = dist(gen) / 64.f;
+    }
+
+    memory convert(memory &mem, mdt dt) {
+        memory::desc md(mem.get_desc().get_dims(), dt, tag::ab);
+        memory out(md, eng);
+        reorder(mem, out).execute(strm, mem, out);
+        strm.wait();
+        return out;
+    }
+
+    engine eng;
+    stream strm;
+    matmul_topk_test_params_t p;
+};
+
+TEST_P(matmul_topk_test_t, compare) {
+    const memory::desc src_md({p.m, p.k}, mdt::f32, tag::ab);
+    const memory::desc wei_md({p.k, p.n}, mdt::f32, tag::ab);
+    const memory::desc logits_md({p.m, p.n}, mdt::f32, tag::ab);
+    const memory::desc val_md({p.m, p.topk}, mdt::f32, tag::ab);
+    const memory::desc idx_md({p.m, p.topk}, mdt::s32, tag::ab);
+
+    memory src(src_md, eng), wei(wei_md, eng);
+    std::minstd_rand gen(p.m * 131 + p.n);
+    fill(src, gen);
+    fill(wei, gen);
+
+    memory f_src = convert(src, p.dt), f_wei = convert(wei, p.dt);
+    memory val(val_md, eng), idx(idx_md, eng);
+
+    impl::matmul_topk::primitive_desc pd;
+    try {
+        pd = impl::matmul_topk::primitive_desc(
+                eng, f_src.get_desc(), f_wei.get_desc(), val_md, idx_md);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    impl::matmul_topk(pd).execute(strm,
+            {{DNNL_ARG_SRC, f_src}, {DNNL_ARG_WEIGHTS, f_wei},
+                    {DNNL_ARG_DST_0, val}, {DNNL_ARG_DST_1, idx}});
+
+    memory logits(logits_md, eng);
+    matmul(matmul::primitive_desc(eng, src_md, wei_md, logits_md))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, logits}});
+    strm.wait();
+
+    const auto *l_ptr = static_cast<const float *>(logits.get_data_handle());
+    const auto *val_ptr = static_cast<const float *>(val.get_data_handle());
+    const auto *idx_ptr = static_cast<const int32_t *>(idx.get_data_handle());
+    std::vector<int32_t> order(p.n);
+    for (memory::dim m = 0; m < p.m; m++) {
+        const float *row = l_ptr + m * p.n;
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                [&](int32_t a, int32_t b) { return row[a] > row[b]; });
+        for (memory::dim i = 0; i < p.topk; i++) {
+            ASSERT_EQ(idx_ptr[m * p.topk + i], order[i])
+                    << "row: " << m << " position: " << i;
+            ASSERT_EQ(val_ptr[m * p.topk + i], row[order[i]])
+                    << "row: " << m << " position: " << i;
+        }
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(CPU_f32, matmul_topk_test_t,
+        ::testing::Values(
+                matmul_topk_test_params_t {1, 64, 1000, 1, mdt::f32},
+                matmul_topk_test_params_t {1, 128, 32000, 40, mdt::f32},
+                matmul_topk_test_params_t {5, 64, 3001, 8, mdt::f32},
+                matmul_topk_test_params_t {40, 32, 777, 16, mdt::f32},
+                matmul_topk_test_params_t {3, 16, 50, 50, mdt::f32}));
+INSTANTIATE_TEST_SUITE_P(CPU_f16, matmul_topk_test_t,
+        ::testing::Values(
+                matmul_topk_test_params_t {1, 64, 5000, 10, mdt::f16},
+                matmul_topk_test_params_t {3, 64, 1000, 1, mdt::f16}));
+// clang-format on
+
+} // namespace dnnl
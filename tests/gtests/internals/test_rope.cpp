@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "rope_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace dnnl {
+
+using mdt = memory::data_type;
+using tag = memory::format_tag;
+
+const int interleaved = impl::rope_layout::interleaved;
+const int half_split = impl::rope_layout::half_split;
+
+struct rope_test_params_t {
+    memory::dim mb;
+    memory::dim heads;
+    memory::dim seq_len;
+    memory::dim head_size;
+    memory::dim rotary_dims;
+    int layout;
+    bool with_positions;
+    mdt dt;
+};
+
+std::ostream &operator<<(std::ostream &ss, const rope_test_params_t &p) {
+    ss << "mb" << p.mb << "h" << p.heads << "s" << p.seq_len << "d"
+       << p.head_size << "r" << p.rotary_dims << "_"
+       << (p.layout == interleaved ? "interleaved" : "half_split")
+       << (p.with_positions ? "_pos" : "") << "_"
+       << dnnl_dt2str(static_cast<dnnl_data_type_t>(p.dt));
+    return ss;
+}
+
+namespace {
+
+// Fills the cosine and the sine tables the usual way: pair i of position p
+// is rotated by p * base^(-2i / rotary_dims).
+void fill_tables(memory &cos, memory &sin, memory::dim rotary_dims) {
+    const auto dims = cos.get_desc().get_dims();
+    auto *c = static_cast<float *>(cos.get_data_handle());
+    auto *s = static_cast<float *>(sin.get_data_handle());
+    const memory::dim half = rotary_dims / 2;
+    for (memory::dim p = 0; p < dims[0]; p++)
+        for (memory::dim i = 0; i < half; i++) {
+            const double theta = p * std::pow(10000., -2. * i / rotary_dims);
+            c[p * half + i] = static_cast<float>(std::cos(theta));
+            s[p * half + i] = static_cast<float>(std::sin(theta));
+        }
+}
+
+void fill_random(memory &mem, std::minstd_rand &gen) {
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto *ptr = static_cast<float *>(mem.get_data_handle());
+    const size_t nelems = mem.get_desc().get_size() / sizeof(float);
+    for (size_t i = 0; i < nelems; i++)
+        ptr[i] = dist(gen);
+}
+
+// Rotates the head `x` of `head_size` elements in place.
+void ref_rotate(float *x, const float *c, const float *s,
+        memory::dim rotary_dims, int layout) {
+    const memory::dim half = rotary_dims / 2;
+    for (memory::dim i = 0; i < half; i++) {
+        const memory::dim i0 = layout == interleaved ? 2 * i : i;
+        const memory::dim i1 = layout == interleaved ? 2 * i + 1 : i + half;
+        const float x0 = x[i0], x1 = x[i1];
+        x[i0] = x0 * c[i] - x1 * s[i];
+        x[i1] = x1 * c[i] + x0 * s[i];
+    }
+}
+
+} // namespace
+
+class rope_test_t : public ::testing::TestWithParam<rope_test_params_t> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        strm = stream(eng);
+        p = GetParam();
+        SKIP_IF(unsupported_data_type(p.dt, eng),
+                "Engine does not support this data type.");
+    }
+
+    memory convert(memory &mem, mdt dt) {
+        memory::desc md(mem.get_desc().get_dims(), dt, tag::abcd);
+        memory out(md, eng);
+        reorder(mem, out).execute(strm, mem, out);
+        strm.wait();
+        return out;
+    }
+
+    engine eng;
+    stream strm;
+    rope_test_params_t p;
+};
+
+TEST_P(rope_test_t, compare) {
+    const memory::dim max_positions = p.seq_len + 11;
+    const memory::dims dims = {p.mb, p.heads, p.seq_len, p.head_size};
+    const memory::desc f32_md(dims, mdt::f32, tag::abcd);
+    const memory::desc data_md(dims, p.dt, tag::abcd);
+    const memory::desc table_md(
+            {max_positions, p.rotary_dims / 2}, mdt::f32, tag::ab);
+    const memory::desc pos_md = p.with_positions
+            ? memory::desc({p.mb, p.seq_len}, mdt::s32, tag::ab)
+            : memory::desc();
+
+    memory src(f32_md, eng), cos(table_md, eng), sin(table_md, eng);
+    std::minstd_rand gen(p.seq_len * 7 + p.head_size);
+    fill_random(src, gen);
+    fill_tables(cos, sin, p.rotary_dims);
+
+    memory pos;
+    std::vector<int32_t> positions(p.mb * p.seq_len);
+    std::uniform_int_distribution<int32_t> pos_dist(
+            0, static_cast<int32_t>(max_positions - 1));
+    for (memory::dim i = 0; i < p.mb * p.seq_len; i++)
+        positions[i] = p.with_positions ? pos_dist(gen)
+                                        : static_cast<int32_t>(i % p.seq_len);
+    if (p.with_positions) {
+        pos = memory(pos_md, eng);
+        auto *pos_ptr = static_cast<int32_t *>(pos.get_data_handle());
+        std::copy(positions.begin(), positions.end(), pos_ptr);
+    }
+
+    // The reference is computed on the source as the primitive sees it.
+    memory d_src = convert(src, p.dt);
+    memory ref = convert(d_src, mdt::f32);
+    memory dst(data_md, eng);
+
+    impl::rope::primitive_desc pd;
+    try {
+        pd = impl::rope::primitive_desc(eng, data_md, table_md, table_md,
+                pos_md, data_md, p.layout, p.rotary_dims);
+    } catch (const error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, d_src},
+            {DNNL_ARG_SRC_1, cos}, {DNNL_ARG_SRC_2, sin}, {DNNL_ARG_DST, dst}};
+    if (p.with_positions) args.insert({DNNL_ARG_SRC_3, pos});
+    impl::rope(pd).execute(strm, args);
+    strm.wait();
+
+    memory f32_dst = convert(dst, mdt::f32);
+    auto *ref_ptr = static_cast<float *>(ref.get_data_handle());
+    const auto *dst_ptr = static_cast<const float *>(f32_dst.get_data_handle());
+    const auto *c = static_cast<const float *>(cos.get_data_handle());
+    const auto *s = static_cast<const float *>(sin.get_data_handle());
+    const memory::dim half = p.rotary_dims / 2;
+    const float eps = p.dt == mdt::f32 ? 1e-6f : 1e-2f;
+    for_(memory::dim mb = 0; mb < p.mb; mb++)
+    for_(memory::dim h = 0; h < p.heads; h++)
+    for (memory::dim t = 0; t < p.seq_len; t++) {
+        const memory::dim off
+                = ((mb * p.heads + h) * p.seq_len + t) * p.head_size;
+        const int32_t pp = positions[mb * p.seq_len + t];
+        ref_rotate(ref_ptr + off, c + pp * half, s + pp * half, p.rotary_dims,
+                p.layout);
+        for (memory::dim d = 0; d < p.head_size; d++)
+            ASSERT_NEAR(dst_ptr[off + d], ref_ptr[off + d], eps)
+                    << "mb: " << mb << " head: " << h << " token: " << t
+                    << " element: " << d;
+    }
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(CPU, rope_test_t,
+        ::testing::Values(
+                rope_test_params_t {2, 3, 5, 64, 64, interleaved, false, mdt::f32},
+                rope_test_params_t {2, 3, 5, 64, 64, half_split, false, mdt::f32},
+                rope_test_params_t {1, 4, 7, 80, 32, interleaved, true, mdt::f32},
+                rope_test_params_t {1, 4, 7, 80, 32, half_split, true, mdt::f32},
+                rope_test_params_t {3, 2, 1, 128, 128, half_split, true, mdt::bf16},
+                rope_test_params_t {2, 2, 9, 64, 48, interleaved, true, mdt::f16}));
+// clang-format on
+
+class rope_matmul_test_t : public ::testing::TestWithParam<int> {
+protected:
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = engine(engine::kind::cpu, 0);
+#endif
+        strm = stream(eng);
+    }
+
+    engine eng;
+    stream strm;
+};
+
+// The matmul with the post-op is compared with a plain matmul followed by a
+// reference rotation of the heads of every destination row.
+TEST_P(rope_matmul_test_t, compare) {
+    const int layout = GetParam();
+    const memory::dim B = 2, M = 7, K = 40, heads = 3, D = 32, R = 24;
+    const memory::dim N = heads * D, max_positions = 64;
+
+    const memory::desc src_md({B, M, K}, mdt::f32, tag::abc);
+    const memory::desc wei_md({B, K, N}, mdt::f32, tag::abc);
+    const memory::desc dst_md({B, M, N}, mdt::f32, tag::abc);
+    const memory::desc table_md({max_positions, R / 2}, mdt::f32, tag::ab);
+    const memory::desc pos_md({B * M}, mdt::s32, tag::a);
+
+    memory src(src_md, eng), wei(wei_md, eng);
+    memory cos(table_md, eng), sin(table_md, eng), pos(pos_md, eng);
+    std::minstd_rand gen(17);
+    fill_random(src, gen);
+    fill_random(wei, gen);
+    fill_tables(cos, sin, R);
+    auto *pos_ptr = static_cast<int32_t *>(pos.get_data_handle());
+    std::uniform_int_distribution<int32_t> pos_dist(0, max_positions - 1);
+    for (memory::dim r = 0; r < B * M; r++)
+        pos_ptr[r] = pos_dist(gen);
+
+    post_ops po;
+    impl::append_rope(po, layout, D, R);
+    primitive_attr attr;
+    attr.set_post_ops(po);
+
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr, true);
+    if (!pd) GTEST_SKIP() << "Unimplemented: matmul with a RoPE post-op";
+
+    memory dst(dst_md, eng), ref(dst_md, eng);
+    const int arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(0);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {arg | DNNL_ARG_SRC_1, cos}, {arg | DNNL_ARG_SRC_2, sin},
+                    {arg | DNNL_ARG_SRC_3, pos}});
+    matmul(matmul::primitive_desc(eng, src_md, wei_md, dst_md))
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, ref}});
+    strm.wait();
+
+    auto *ref_ptr = static_cast<float *>(ref.get_data_handle());
+    const auto *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+    const auto *c = static_cast<const float *>(cos.get_data_handle());
+    const auto *s = static_cast<const float *>(sin.get_data_handle());
+    for (memory::dim r = 0; r < B * M; r++) {
+        for (memory::dim h = 0; h < heads; h++)
+            ref_rotate(ref_ptr + r * N + h * D, c + pos_ptr[r] * R / 2,
+                    s + pos_ptr[r] * R / 2, R, layout);
+        for (memory::dim n = 0; n < N; n++)
+            ASSERT_NEAR(dst_ptr[r * N + n], ref_ptr[r * N + n], 1e-4f)
+                    << "row: " << r << " column: " << n;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CPU, rope_matmul_test_t,
+        ::testing::Values(interleaved, half_split));
+
+} // namespace dnnl
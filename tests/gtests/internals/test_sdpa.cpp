@@ -1028,7 +1028,10 @@ void prim_sdpa_quant(const sdpa_dims_t &p, const sdpa_tensors_t &t,
     primitive_attr bmm1_attr;
     post_ops bmm1_po;
     bmm1_attr.set_scratchpad_mode(dnnl::scratchpad_mode::library);
-    auto mask_f32 = as(strm, mask, mdt::f32);
+    // Without a mask the memory object is empty, there is nothing to convert.
+    auto mask_f32 = p.mask.type != mask_type::no_mask
+            ? as(strm, mask, mdt::f32)
+            : memory();
     auto mask_sz = mask.get_desc().get_dims();
     auto scale_f32 = as(strm, scale_device, mdt::f32);
 
@@ -1805,6 +1808,29 @@ memory::format_tag no_key_transposed = memory::format_tag::abcd;
 using sdpa_test = sdpa_test_t<sdpa_dims_t>;
 using sdpa_test_datatypes = sdpa_test_t<sdpa_dims_t_tuple>;
 
+// The CPU implementation is checked against the same reference on small
+// problems only, the GPU shapes below are too big for it.
+class sdpa_test_cpu : public sdpa_test_t<sdpa_dims_t_tuple> {
+public:
+    static void SetUpTestSuite() {}
+    static void TearDownTestSuite() {}
+
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = dnnl::engine(engine::kind::cpu, 0);
+#endif
+        strm = dnnl::stream(eng);
+        p = GetParam();
+        doubled_memory.reserve(30);
+        t = get_descriptors(eng, strm, p, doubled_memory);
+        scale_dt = t.m_query.get_desc().get_data_type();
+    }
+};
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(ScaleTypes_f16, sdpa_test_datatypes,
@@ -2071,6 +2097,70 @@ INSTANTIATE_TEST_SUITE_P(phi3_mini_4k_instruct,
                     sdpa_dims_t{   1,     32,       32,   2049,       1,     96,     96,      96, mdt::f16, mdt::s8,  mdt::f16, mdt::s8,  mdt::s8, mdt::f16, mdt::s8, mdt::f16, quantize_type::per_token_with_groups,  with_key_transposed, mask_type::twoD }
     ), &print_to_string);
 
+INSTANTIATE_TEST_SUITE_P(CPU_AllMaskTypes, sdpa_test_cpu,
+        testing::Combine(testing::Values(1), // mb
+                testing::Values(num_heads_t {2, 2}, num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {37, 100}, seq_len_size_t {1, 65}, seq_len_size_t {70, 70}), // seq_len
+                testing::Values(head_group_size_t {64, 64, 64}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::f32)), // dt
+                testing::Values(tensor_type_t("K", mdt::f32)), // kdt
+                testing::Values(tensor_type_t("V", mdt::f32)), // vdt
+                testing::Values(quantize_type::no_quantization), // qtype
+                testing::Values(dnnl::memory::format_tag::abcd, dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_tl}, mask_config_t {mask_type::causal_br}, mask_config_t {mask_type::twoD, mdt::f32}), // mask_type
+                testing::Values(default_scale_type), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
+INSTANTIATE_TEST_SUITE_P(CPU_DataTypes_bf16, sdpa_test_cpu,
+        testing::Combine(testing::Values(2), // mb
+                testing::Values(num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {33, 130}), // seq_len
+                testing::Values(head_group_size_t {64, 64, 64}, head_group_size_t {128, 128, 128}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::bf16)), // dt
+                testing::Values(tensor_type_t("K", mdt::bf16)), // kdt
+                testing::Values(tensor_type_t("V", mdt::bf16)), // vdt
+                testing::Values(quantize_type::no_quantization), // qtype
+                testing::Values(dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_br}), // mask_type
+                testing::Values(default_scale_type), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
+INSTANTIATE_TEST_SUITE_P(CPU_DataTypes_f16, sdpa_test_cpu,
+        testing::Combine(testing::Values(2), // mb
+                testing::Values(num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {33, 130}), // seq_len
+                testing::Values(head_group_size_t {64, 64, 64}, head_group_size_t {128, 128, 128}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::f16)), // dt
+                testing::Values(tensor_type_t("K", mdt::f16)), // kdt
+                testing::Values(tensor_type_t("V", mdt::f16)), // vdt
+                testing::Values(quantize_type::no_quantization), // qtype
+                testing::Values(dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_br}), // mask_type
+                testing::Values(default_scale_type), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
+INSTANTIATE_TEST_SUITE_P(CPU_Quantized_f32, sdpa_test_cpu,
+        testing::Combine(testing::Values(1), // mb
+                testing::Values(num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {37, 100}, seq_len_size_t {1, 130}), // seq_len
+                testing::Values(head_group_size_t {64, 32, 32}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::f32)), // dt
+                testing::Values(tensor_type_t("K", mdt::s8, mdt::f32, mdt::s8), tensor_type_t("K", mdt::u4, mdt::f32, mdt::u4)), // kdt
+                testing::Values(tensor_type_t("V", mdt::s8, mdt::f32, mdt::s8), tensor_type_t("V", mdt::s4, mdt::f32, mdt::undef)), // vdt
+                testing::Values(quantize_type::per_token_with_groups, quantize_type::per_tensor3), // qtype
+                testing::Values(dnnl::memory::format_tag::abcd, dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_br}), // mask_type
+                testing::Values(default_scale_type), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
 // clang-format on
 
 GPU_TEST_P(sdpa_test, compare) {
@@ -2081,10 +2171,179 @@ GPU_TEST_P(sdpa_test_datatypes, compare) {
     compare();
 }
 
+CPU_TEST_P(sdpa_test_cpu, compare) {
+    compare();
+}
+
 GPU_TEST_P(sdpa_test, perf) {
     perf();
 }
 
+struct sdpa_paged_kv_params_t {
+    memory::dim queries;
+    memory::dim page_size;
+    // abcd: the pages of keys are read in place, abdc: they are repacked.
+    memory::format_tag key_tag;
+};
+
+std::ostream &operator<<(std::ostream &ss, const sdpa_paged_kv_params_t &p) {
+    ss << "Q:" << p.queries << " page:" << p.page_size << " K:" << p.key_tag;
+    return ss;
+}
+
+// Paged attention has to match the attention over the contiguous K and V of
+// every sequence. The unused parts of the pool are filled with NaNs.
+class sdpa_paged_kv_test_cpu
+    : public ::testing::TestWithParam<sdpa_paged_kv_params_t> {};
+
+CPU_TEST_P(sdpa_paged_kv_test_cpu, compare) {
+    using tag = memory::format_tag;
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+    SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::cpu,
+            "This test requires CPU engine");
+    dnnl::engine eng = get_test_engine();
+#else
+    dnnl::engine eng(engine::kind::cpu, 0);
+#endif
+    dnnl::stream strm(eng);
+
+    const auto p = GetParam();
+    const memory::dim B = 2, H = 4, Hkv = 2, D = 64, Dv = 64;
+    const memory::dim Sq = p.queries, page = p.page_size;
+    const std::vector<memory::dim> seq_lens = {50, 37};
+    const memory::dim max_pages = (seq_lens[0] + page - 1) / page;
+    const memory::dim n_pages = B * max_pages + 3;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto fill = [&](const memory &m) {
+        float *ptr = static_cast<float *>(m.get_data_handle());
+        const size_t n = m.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; i++)
+            ptr[i] = dist(gen);
+    };
+
+    memory::desc scale_md({1, 1, 1, 1}, mdt::f32, tag::abcd);
+    memory scale(scale_md, eng);
+    *static_cast<float *>(scale.get_data_handle()) = 1.f / std::sqrt(D);
+
+    memory::desc k_pool_md({n_pages, Hkv, D, page}, mdt::f32, p.key_tag);
+    memory::desc v_pool_md({n_pages, Hkv, page, Dv}, mdt::f32, tag::abcd);
+    memory k_pool(k_pool_md, eng), v_pool(v_pool_md, eng);
+    for (auto *m : {&k_pool, &v_pool}) {
+        float *ptr = static_cast<float *>(m->get_data_handle());
+        const size_t n = m->get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; i++)
+            ptr[i] = NAN;
+    }
+
+    memory::desc bt_md({B, max_pages}, mdt::s32, tag::ab);
+    memory::desc sl_md({B}, mdt::s32, tag::a);
+    memory block_table(bt_md, eng), seq_lens_mem(sl_md, eng);
+    int32_t *bt = static_cast<int32_t *>(block_table.get_data_handle());
+    int32_t *sl = static_cast<int32_t *>(seq_lens_mem.get_data_handle());
+    for (memory::dim b = 0; b < B; b++) {
+        sl[b] = static_cast<int32_t>(seq_lens[b]);
+        // Pages are handed out from the end of the pool.
+        for (memory::dim i = 0; i < max_pages; i++)
+            bt[b * max_pages + i]
+                    = static_cast<int32_t>(n_pages - 1 - (b * max_pages + i));
+    }
+
+    memory::desc q_md({B, H, Sq, D}, mdt::f32, tag::abcd);
+    memory::desc dst_md({B, H, Sq, Dv}, mdt::f32, tag::abcd);
+    memory query(q_md, eng), dst(dst_md, eng);
+    fill(query);
+
+    const auto k_strides = k_pool_md.get_strides();
+    const auto v_strides = v_pool_md.get_strides();
+    float *k_pool_ptr = static_cast<float *>(k_pool.get_data_handle());
+    float *v_pool_ptr = static_cast<float *>(v_pool.get_data_handle());
+    const float *q_ptr = static_cast<const float *>(query.get_data_handle());
+    const float *dst_ptr = static_cast<const float *>(dst.get_data_handle());
+
+    // Contiguous K, V and the expected output of every sequence.
+    std::vector<memory> ref_dst;
+    for (memory::dim b = 0; b < B; b++) {
+        const memory::dim Sk = seq_lens[b];
+        memory::desc qb_md({1, H, Sq, D}, mdt::f32, tag::abcd);
+        memory::desc kb_md({1, Hkv, D, Sk}, mdt::f32, tag::abcd);
+        memory::desc vb_md({1, Hkv, Sk, Dv}, mdt::f32, tag::abcd);
+        memory::desc db_md({1, H, Sq, Dv}, mdt::f32, tag::abcd);
+        memory qb(qb_md, eng), kb(kb_md, eng), vb(vb_md, eng), db(db_md, eng);
+        std::memcpy(qb.get_data_handle(), q_ptr + b * H * Sq * D,
+                qb_md.get_size());
+        fill(kb);
+        fill(vb);
+
+        const float *k = static_cast<const float *>(kb.get_data_handle());
+        const float *v = static_cast<const float *>(vb.get_data_handle());
+        for (memory::dim h = 0; h < Hkv; h++)
+            for (memory::dim t = 0; t < Sk; t++) {
+                const memory::dim pg = bt[b * max_pages + t / page];
+                for (memory::dim d = 0; d < D; d++)
+                    k_pool_ptr[pg * k_strides[0] + h * k_strides[1]
+                            + d * k_strides[2] + (t % page) * k_strides[3]]
+                            = k[(h * D + d) * Sk + t];
+                for (memory::dim d = 0; d < Dv; d++)
+                    v_pool_ptr[pg * v_strides[0] + h * v_strides[1]
+                            + (t % page) * v_strides[2] + d * v_strides[3]]
+                            = v[(h * Sk + t) * Dv + d];
+            }
+
+        dnnl::impl::sdpa::primitive_desc pd;
+        try {
+            pd = dnnl::impl::sdpa::primitive_desc(eng, qb_md, kb_md, vb_md,
+                    nullptr, scale_md, db_md, false, Hkv,
+                    dnnl::impl::attn_mask_type::bottom_right,
+                    dnnl::impl::alg_kind::softmax_accurate_inf_as_zero);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+        dnnl::impl::sdpa(pd).execute(strm,
+                {{DNNL_ARG_QUERIES, qb}, {DNNL_ARG_KEYS, kb},
+                        {DNNL_ARG_VALUES, vb}, {DNNL_ARG_SCALE, scale},
+                        {DNNL_ARG_DST, db}});
+        ref_dst.push_back(db);
+    }
+
+    dnnl::impl::sdpa::primitive_desc paged_pd;
+    try {
+        paged_pd = dnnl::impl::sdpa::primitive_desc(eng, q_md, k_pool_md,
+                v_pool_md, nullptr, scale_md, dst_md, false, Hkv,
+                dnnl::impl::attn_mask_type::bottom_right,
+                dnnl::impl::alg_kind::softmax_accurate_inf_as_zero, page,
+                bt_md, sl_md);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+    dnnl::impl::sdpa(paged_pd).execute(strm,
+            {{DNNL_ARG_QUERIES, query}, {DNNL_ARG_KEYS, k_pool},
+                    {DNNL_ARG_VALUES, v_pool}, {DNNL_ARG_SCALE, scale},
+                    {DNNL_ARG_BLOCK_TABLE, block_table},
+                    {DNNL_ARG_SEQ_LENS, seq_lens_mem}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    for (memory::dim b = 0; b < B; b++) {
+        const float *ref
+                = static_cast<const float *>(ref_dst[b].get_data_handle());
+        for (memory::dim i = 0; i < H * Sq * Dv; i++)
+            ASSERT_NEAR(dst_ptr[b * H * Sq * Dv + i], ref[i], 1e-5f)
+                    << "b:" << b << " i:" << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CPU_PagedKV, sdpa_paged_kv_test_cpu,
+        testing::Values(
+                sdpa_paged_kv_params_t {1, 16, memory::format_tag::abcd},
+                sdpa_paged_kv_params_t {1, 16, memory::format_tag::abdc},
+                sdpa_paged_kv_params_t {5, 32, memory::format_tag::abcd},
+                sdpa_paged_kv_params_t {5, 32, memory::format_tag::abdc}));
+
 /*
 GPU_TEST_P(sdpa_test_datatypes, perf) {
     perf();
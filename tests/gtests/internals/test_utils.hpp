@@ -66,7 +66,8 @@ void write_to_dnnl_memory(const T *handle, dnnl::memory &mem, dnnl::engine &eng,
 
     if (!handle) throw std::runtime_error("handle is nullptr.");
 
-    if (eng.get_kind() == dnnl::engine::kind::gpu) {
+    if (eng.get_kind() == dnnl::engine::kind::gpu
+            || eng.get_kind() == dnnl::engine::kind::cpu) {
         if (mem.get_desc().get_data_type() != dnnl_f32
                 && std::is_same<T, float>::value) {
             dnnl::memory mem_f32_mem(
@@ -96,7 +97,7 @@ void write_to_dnnl_memory(const T *handle, dnnl::memory &mem, dnnl::engine &eng,
             write_to_dnnl_memory<unsigned>(
                     (const unsigned *)handle, mem_u32_mem, eng, s);
             dnnl::reorder(mem_u32_mem, mem).execute(s, mem_u32_mem, mem);
-        } else {
+        } else if (eng.get_kind() == dnnl::engine::kind::gpu) {
             s.wait();
             void *mapped_ptr = mem.map_data();
             if (!mapped_ptr)
@@ -104,18 +105,16 @@ void write_to_dnnl_memory(const T *handle, dnnl::memory &mem, dnnl::engine &eng,
                         "Failed to map memory in write_to_dnnl_memory");
             std::memcpy(mapped_ptr, handle, size);
             mem.unmap_data(mapped_ptr);
+        } else {
+            uint8_t *dst = static_cast<uint8_t *>(mem.get_data_handle());
+            if (!dst)
+                throw std::runtime_error("get_data_handle returned nullptr.");
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = ((uint8_t *)handle)[i];
         }
         return;
     }
 
-    if (eng.get_kind() == dnnl::engine::kind::cpu) {
-        uint8_t *dst = static_cast<uint8_t *>(mem.get_data_handle());
-        if (!dst) throw std::runtime_error("get_data_handle returned nullptr.");
-        for (size_t i = 0; i < size; ++i)
-            dst[i] = ((uint8_t *)handle)[i];
-        return;
-    }
-
     assert(!"not expected");
 }
 
@@ -738,8 +738,10 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
         // Make sure ref fused impl is not deployed.
         // NOTE: When out_of_memory testing enabled, all implementations that
         // construct primitive attributes will fail, hence the ref
-        // implementation is deployed.
-        if (!test_out_of_memory()) {
+        // implementation is deployed. The dedicated brgemm implementation
+        // of the fusion is not used for unfused convolutions.
+        if (!test_out_of_memory()
+                && impl_info_fused.compare(0, 14, "brgconv_1x1_dw") != 0) {
             ASSERT_EQ(impl_info_fused, impl_info_unfused);
         }
     }
@@ -820,6 +822,517 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestGetAttr) {
     }
 }
 
+TEST_F(attr_test_t, TestSrcNormalization) {
+    dnnl::primitive_attr attr;
+
+    normalization_flags flags = normalization_flags::use_scale;
+    float eps = 1.f;
+    attr.get_src_normalization(flags, eps);
+    ASSERT_EQ(flags, normalization_flags::none);
+    ASSERT_EQ(eps, 0.f);
+
+    const auto ref_flags = normalization_flags::rms_norm
+            | normalization_flags::use_scale;
+    attr.set_src_normalization(ref_flags, 1e-5f);
+    attr.get_src_normalization(flags, eps);
+    ASSERT_EQ(flags, ref_flags);
+    ASSERT_EQ(eps, 1e-5f);
+
+    EXPECT_ANY_THROW(attr.set_src_normalization(
+            normalization_flags::fuse_norm_relu, 1e-5f));
+    EXPECT_ANY_THROW(
+            attr.set_src_normalization(normalization_flags::none, -1.f));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSrcNormalizationMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Source normalization is supported only on CPU");
+
+    const memory::dim B = 2, M = 13, K = 70, N = 33;
+    const float eps = 1e-5f;
+
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::f32, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+    memory::desc ss_md({K}, data_type::f32, tag::a);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto scale = test::make_memory(ss_md, eng);
+    auto shift = test::make_memory(ss_md, eng);
+    fill_data<float>(B * M * K, src);
+    fill_data<float>(B * K * N, wei);
+    fill_data<float>(K, scale);
+    fill_data<float>(K, shift);
+
+    for (auto flags : {normalization_flags::rms_norm
+                         | normalization_flags::use_scale,
+                 normalization_flags::use_scale
+                         | normalization_flags::use_shift}) {
+        primitive_attr attr;
+        attr.set_fpmath_mode(fpmath_mode::strict);
+        attr.set_src_normalization(flags, eps);
+        auto pd = matmul::primitive_desc(
+                eng, src_md, wei_md, dst_md, attr, true);
+        SKIP_IF(!pd, "Source normalization is not supported");
+
+        auto dst = test::make_memory(dst_md, eng);
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                {DNNL_ARG_ATTR_SRC_NORM_SCALE, scale}};
+        const bool rms = bool(flags & normalization_flags::rms_norm);
+        const bool with_shift = bool(flags & normalization_flags::use_shift);
+        if (with_shift)
+            args.insert({DNNL_ARG_ATTR_SRC_NORM_SHIFT, shift});
+
+        stream s(eng);
+        matmul(pd).execute(s, args);
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto wei_ptr = map_memory<float>(wei);
+        auto scale_ptr = map_memory<float>(scale);
+        auto shift_ptr = map_memory<float>(shift);
+        auto dst_ptr = map_memory<float>(dst);
+
+        std::vector<float> norm(K);
+        for_(memory::dim b = 0; b < B; b++)
+        for (memory::dim m = 0; m < M; m++) {
+            const float *x = &src_ptr[(b * M + m) * K];
+            float mean = 0.f, var = 0.f;
+            if (!rms) {
+                for (memory::dim k = 0; k < K; k++)
+                    mean += x[k];
+                mean /= K;
+            }
+            for (memory::dim k = 0; k < K; k++)
+                var += (x[k] - mean) * (x[k] - mean);
+            var /= K;
+            const float rstd = 1.f / std::sqrt(var + eps);
+            for (memory::dim k = 0; k < K; k++)
+                norm[k] = (x[k] - mean) * rstd * scale_ptr[k]
+                        + (with_shift ? shift_ptr[k] : 0.f);
+
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += norm[k] * wei_ptr[(b * K + k) * N + n];
+                const float got = dst_ptr[(b * M + m) * N + n];
+                ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::fabs(ref)));
+            }
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestLora) {
+    dnnl::primitive_attr attr;
+
+    memory::dim rank = 1, num_adapters = 1;
+    float alpha = 0.f;
+    attr.get_lora(rank, num_adapters, alpha);
+    ASSERT_EQ(rank, 0);
+    ASSERT_EQ(num_adapters, 0);
+    ASSERT_EQ(alpha, 1.f);
+
+    attr.set_lora(8, 4, 0.5f);
+    attr.get_lora(rank, num_adapters, alpha);
+    ASSERT_EQ(rank, 8);
+    ASSERT_EQ(num_adapters, 4);
+    ASSERT_EQ(alpha, 0.5f);
+
+    EXPECT_ANY_THROW(attr.set_lora(0));
+    EXPECT_ANY_THROW(attr.set_lora(8, 0));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestLoraMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "LoRA is supported only on CPU");
+
+    const memory::dim B = 2, M = 13, K = 70, N = 33;
+    const memory::dim R = 4, A = 3;
+    const float alpha = 0.5f;
+
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::f32, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+    memory::desc lora_a_md({A, K, R}, data_type::f32, tag::abc);
+    memory::desc lora_b_md({A, R, N}, data_type::f32, tag::abc);
+    memory::desc idx_md({B, M}, data_type::s32, tag::ab);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto lora_a = test::make_memory(lora_a_md, eng);
+    auto lora_b = test::make_memory(lora_b_md, eng);
+    auto idx = test::make_memory(idx_md, eng);
+    fill_data<float>(B * M * K, src);
+    fill_data<float>(B * K * N, wei);
+    fill_data<float>(A * K * R, lora_a);
+    fill_data<float>(A * R * N, lora_b);
+    {
+        // Every adapter and a row without any.
+        auto idx_ptr = map_memory<int32_t>(idx);
+        for (memory::dim r = 0; r < B * M; r++)
+            idx_ptr[r] = r % (A + 1) == A ? -1 : r % (A + 1);
+    }
+
+    for (memory::dim num_adapters : {memory::dim(1), A}) {
+        primitive_attr attr;
+        attr.set_fpmath_mode(fpmath_mode::strict);
+        attr.set_lora(R, num_adapters, alpha);
+        auto pd = matmul::primitive_desc(
+                eng, src_md, wei_md, dst_md, attr, true);
+        SKIP_IF(!pd, "LoRA is not supported");
+
+        auto dst = test::make_memory(dst_md, eng);
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                {DNNL_ARG_ATTR_LORA_A, lora_a}, {DNNL_ARG_ATTR_LORA_B, lora_b}};
+        if (num_adapters > 1) args.insert({DNNL_ARG_ATTR_LORA_INDICES, idx});
+
+        stream s(eng);
+        matmul(pd).execute(s, args);
+        s.wait();
+
+        auto src_ptr = map_memory<float>(src);
+        auto wei_ptr = map_memory<float>(wei);
+        auto a_ptr = map_memory<float>(lora_a);
+        auto b_ptr = map_memory<float>(lora_b);
+        auto idx_ptr = map_memory<int32_t>(idx);
+        auto dst_ptr = map_memory<float>(dst);
+
+        std::vector<float> t(R);
+        for_(memory::dim b = 0; b < B; b++)
+        for (memory::dim m = 0; m < M; m++) {
+            const memory::dim r = b * M + m;
+            const float *x = &src_ptr[r * K];
+            const int a = num_adapters > 1 ? idx_ptr[r] : 0;
+            for (memory::dim j = 0; j < R; j++) {
+                t[j] = 0.f;
+                for (memory::dim k = 0; k < K && a >= 0; k++)
+                    t[j] += x[k] * a_ptr[(a * K + k) * R + j];
+            }
+
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += x[k] * wei_ptr[(b * K + k) * N + n];
+                for (memory::dim j = 0; j < R && a >= 0; j++)
+                    ref += alpha * t[j] * b_ptr[(a * R + j) * N + n];
+                const float got = dst_ptr[r * N + n];
+                ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::fabs(ref)));
+            }
+        }
+    }
+}
+
+TEST_F(attr_test_t, TestDstSplit) {
+    dnnl::primitive_attr attr;
+    ASSERT_TRUE(attr.get_dst_split().empty());
+
+    memory::desc q_md({2, 4, 8, 16}, data_type::f32, tag::abcd);
+    memory::desc v_md({2, 8, 32}, data_type::bf16, tag::abc);
+    attr.set_dst_split({q_md, v_md});
+    const auto dsts = attr.get_dst_split();
+    ASSERT_EQ(dsts.size(), 2u);
+    ASSERT_EQ(dsts[0], q_md);
+    ASSERT_EQ(dsts[1], v_md);
+
+    EXPECT_ANY_THROW(attr.set_dst_split({}));
+    EXPECT_ANY_THROW(attr.set_dst_split(std::vector<memory::desc>(9, v_md)));
+    EXPECT_ANY_THROW(attr.set_dst_split(
+            {memory::desc({16}, data_type::f32, tag::a)}));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestDstSplitMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Destination split is supported only on CPU");
+
+    // A fused QKV projection: Q with two heads, K with one head and V as a
+    // plain matrix with its own scale.
+    const memory::dim B = 2, M = 13, K = 70, D = 64;
+    const memory::dim Hq = 2, Hk = 1;
+    const memory::dim N = (Hq + Hk + 1) * D;
+    const float v_scale = 2.f;
+
+    memory::desc src_md({B, M, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({B, K, N}, data_type::f32, tag::abc);
+    memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+    memory::desc q_md({B, Hq, M, D}, data_type::f32, tag::abcd);
+    memory::desc k_md({B, Hk, M, D}, data_type::f32, tag::abcd);
+    memory::desc v_md({B, M, D}, data_type::f32, tag::abc);
+
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::strict);
+    attr.set_dst_split({q_md, k_md, v_md});
+    attr.set_scales_mask(DNNL_ARG_MULTIPLE_DST + 2, 0);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr, true);
+    SKIP_IF(!pd, "Destination split is not supported");
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto q = test::make_memory(q_md, eng);
+    auto k = test::make_memory(k_md, eng);
+    auto v = test::make_memory(v_md, eng);
+    auto scale = test::make_memory(
+            memory::desc({1}, data_type::f32, tag::a), eng);
+    fill_data<float>(B * M * K, src);
+    fill_data<float>(B * K * N, wei);
+    map_memory<float>(scale)[0] = v_scale;
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_MULTIPLE_DST + 0, q},
+                    {DNNL_ARG_MULTIPLE_DST + 1, k},
+                    {DNNL_ARG_MULTIPLE_DST + 2, v},
+                    {DNNL_ARG_ATTR_SCALES | (DNNL_ARG_MULTIPLE_DST + 2),
+                            scale}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<float>(wei);
+    auto q_ptr = map_memory<float>(q);
+    auto k_ptr = map_memory<float>(k);
+    auto v_ptr = map_memory<float>(v);
+
+    for_(memory::dim b = 0; b < B; b++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float ref = 0.f;
+        for (memory::dim kk = 0; kk < K; kk++)
+            ref += src_ptr[(b * M + m) * K + kk]
+                    * wei_ptr[(b * K + kk) * N + n];
+
+        const memory::dim h = n / D, d = n % D;
+        float got = 0.f;
+        if (h < Hq)
+            got = q_ptr[((b * Hq + h) * M + m) * D + d];
+        else if (h < Hq + Hk)
+            got = k_ptr[((b * Hk + h - Hq) * M + m) * D + d];
+        else {
+            got = v_ptr[(b * M + m) * D + d];
+            ref /= v_scale;
+        }
+        ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::fabs(ref)));
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestPrefetchHintMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Prefetch hint is supported only on CPU");
+
+    // Two chained layers: the weights of the second one are prefetched while
+    // the first one executes. The hint must not change the results.
+    const memory::dim M = 4, K = 96, N = 160;
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc next_wei_md({N, K}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto next_wei = test::make_memory(next_wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto dst_ref = test::make_memory(dst_md, eng);
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+    fill_data<float>(N * K, next_wei);
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_ref}});
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}, {DNNL_ARG_PREFETCH_HINT, next_wei}});
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    auto dst_ref_ptr = map_memory<float>(dst_ref);
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_EQ(dst_ptr[i], dst_ref_ptr[i]);
+
+    // Primitives not supporting the hint ignore it.
+    auto eltwise_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, dst_md,
+            dst_md, 0.f);
+    eltwise_forward(eltwise_pd)
+            .execute(s,
+                    {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_PREFETCH_HINT, next_wei}});
+    s.wait();
+}
+
+TEST_F(attr_test_t, TestConstantWeights) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_constant_weights());
+    attr.set_constant_weights(true);
+    ASSERT_TRUE(attr.get_constant_weights());
+    attr.set_constant_weights(false);
+    ASSERT_FALSE(attr.get_constant_weights());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestConstantWeightsConvolution) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Constant weights are used only on CPU");
+
+    // An int8 convolution with a source zero point and padding, so that the
+    // compensations depend on the position of the output point. The results
+    // with the attribute must match the ones without it, also when the
+    // weights buffer changes.
+    const memory::dim N = 2, IC = 32, OC = 48, IH = 10, IW = 12, K = 3;
+    const int32_t src_zp = 7;
+    memory::desc src_md({N, IC, IH, IW}, data_type::u8, tag::nhwc);
+    memory::desc user_wei_md({OC, IC, K, K}, data_type::s8, tag::oihw);
+    memory::desc wei_md({OC, IC, K, K}, data_type::s8, tag::any);
+    memory::desc dst_md({N, OC, IH, IW}, data_type::f32, tag::nhwc);
+    memory::desc zp_md({1}, data_type::s32, tag::a);
+
+    auto make_pd = [&](bool constant_weights) {
+        primitive_attr attr;
+        attr.set_zero_points_mask(DNNL_ARG_SRC, 0);
+        attr.set_constant_weights(constant_weights);
+        return convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+    };
+    auto pd = make_pd(true);
+    auto ref_pd = make_pd(false);
+
+    stream s(eng);
+    auto src = test::make_memory(src_md, eng);
+    auto zp = test::make_memory(zp_md, eng);
+    {
+        auto src_ptr = map_memory<uint8_t>(src);
+        for (memory::dim i = 0; i < N * IC * IH * IW; i++)
+            src_ptr[i] = static_cast<uint8_t>((i * 13) % 29);
+        map_memory<int32_t>(zp)[0] = src_zp;
+    }
+    auto make_weights = [&](int seed) {
+        auto user_wei = test::make_memory(user_wei_md, eng);
+        {
+            auto wei_ptr = map_memory<int8_t>(user_wei);
+            for (memory::dim i = 0; i < OC * IC * K * K; i++)
+                wei_ptr[i] = static_cast<int8_t>((i * seed) % 11 - 5);
+        }
+        auto wei = test::make_memory(pd.weights_desc(), eng);
+        reorder(user_wei, wei).execute(s, user_wei, wei);
+        s.wait();
+        return wei;
+    };
+
+    const auto run = [&](const convolution_forward::primitive_desc &cpd,
+                             const memory &wei) {
+        auto dst = test::make_memory(dst_md, eng);
+        convolution_forward(cpd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, zp}});
+        s.wait();
+        return dst;
+    };
+    const auto check = [&](const memory &dst, const memory &ref) {
+        auto dst_ptr = map_memory<float>(dst);
+        auto ref_ptr = map_memory<float>(ref);
+        for (memory::dim i = 0; i < N * OC * IH * IW; i++)
+            ASSERT_EQ(dst_ptr[i], ref_ptr[i]);
+    };
+
+    ASSERT_EQ(ref_pd.weights_desc(), pd.weights_desc());
+    auto wei_a = make_weights(3);
+    auto wei_b = make_weights(7);
+    auto ref_a = run(ref_pd, wei_a);
+    auto ref_b = run(ref_pd, wei_b);
+    for (int i = 0; i < 2; i++)
+        check(run(pd, wei_a), ref_a);
+    check(run(pd, wei_b), ref_b);
+    check(run(pd, wei_a), ref_a);
+}
+
+TEST_F(attr_test_t, TestBatchStats) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_batch_stats());
+    attr.set_batch_stats(true);
+    ASSERT_TRUE(attr.get_batch_stats());
+    attr.set_batch_stats(false);
+    ASSERT_FALSE(attr.get_batch_stats());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestBatchStatsConvolution) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Batch statistics are supported only on CPU");
+
+    // The statistics are computed over the destination after the post-ops,
+    // and the values are shifted to check the variance does not lose
+    // precision.
+    const memory::dim N = 2, IC = 16, OC = 24, IH = 9, IW = 11, K = 3;
+    const memory::dim OH = IH - K + 1, OW = IW - K + 1;
+    const float shift = 100.f;
+
+    memory::desc src_md({N, IC, IH, IW}, data_type::f32, tag::nhwc);
+    memory::desc wei_md({OC, IC, K, K}, data_type::f32, tag::any);
+    memory::desc bia_md({OC}, data_type::f32, tag::a);
+    memory::desc dst_md({N, OC, OH, OW}, data_type::f32, tag::nhwc);
+
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_linear, 1.f, shift);
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::strict);
+    attr.set_post_ops(ops);
+    attr.set_batch_stats(true);
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_training, algorithm::convolution_direct, src_md,
+            wei_md, bia_md, dst_md, {1, 1}, {0, 0}, {0, 0}, attr, true);
+    SKIP_IF(!pd, "Batch statistics are not supported");
+
+    const memory::desc stat_md({OC}, data_type::f32, tag::a);
+    ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_MEAN), stat_md);
+    ASSERT_EQ(pd.query_md(query::exec_arg_md, DNNL_ARG_VARIANCE), stat_md);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(pd.weights_desc(), eng);
+    auto bia = test::make_memory(bia_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto mean = test::make_memory(stat_md, eng);
+    auto variance = test::make_memory(stat_md, eng);
+    fill_data<float>(N * IC * IH * IW, src);
+    fill_data<float>(pd.weights_desc().get_size() / sizeof(float), wei);
+    fill_data<float>(OC, bia);
+
+    stream s(eng);
+    convolution_forward(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_MEAN, mean}, {DNNL_ARG_VARIANCE, variance}});
+    s.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    auto mean_ptr = map_memory<float>(mean);
+    auto variance_ptr = map_memory<float>(variance);
+    const memory::dim count = N * OH * OW;
+    for (memory::dim oc = 0; oc < OC; oc++) {
+        double sum = 0, sum_sq = 0;
+        for (memory::dim i = 0; i < count; i++)
+            sum += dst_ptr[i * OC + oc];
+        const double ref_mean = sum / count;
+        for (memory::dim i = 0; i < count; i++) {
+            const double diff = dst_ptr[i * OC + oc] - ref_mean;
+            sum_sq += diff * diff;
+        }
+        const double ref_variance = sum_sq / count;
+        ASSERT_NEAR(mean_ptr[oc], ref_mean, 1e-5 * std::fabs(ref_mean));
+        ASSERT_NEAR(variance_ptr[oc], ref_variance,
+                1e-4 * std::max(1., ref_variance));
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestGetCppObjects) {
     SKIP_IF_CUDA(true, "Binary post-op is not supported for CUDA");
     SKIP_IF_HIP(true, "Binary post-op is not supported for HIP");
@@ -681,6 +681,73 @@ CPU_TEST_F(attr_quantization_test_t, TestMatmulBatchMXFP) {
     CHECK_OK(matmul::primitive_desc(eng, a_md, b_md, q_c_md, attr));
 }
 
+CPU_TEST_F(attr_quantization_test_t, TestMatmulDynamicQuantization) {
+    const memory::dim M = 7, K = 40, N = 96, G = 32;
+    memory::desc a_md {{M, K}, data_type::f32, tag::ab};
+    memory::desc b_md {{K, N}, data_type::f32, tag::ab};
+    memory::desc c_md {{M, N}, data_type::s8, tag::ab};
+    const int per_tensor_mask = 3;
+
+    // Groups must split the rows evenly.
+    CHECK_UNIMPL(matmul::primitive_desc(eng, a_md, b_md, c_md,
+            gen_attr_with_scales(DNNL_ARG_DST, per_tensor_mask,
+                    data_type::f32, {1, 36}, quantization_mode::dynamic_fp)));
+    CHECK_UNIMPL(matmul::primitive_desc(eng, a_md, b_md, c_md,
+            gen_attr_with_scales(DNNL_ARG_DST, per_tensor_mask,
+                    data_type::f32, {2, G}, quantization_mode::dynamic_fp)));
+    // Scales are floating-point.
+    CHECK_UNIMPL(matmul::primitive_desc(eng, a_md, b_md, c_md,
+            gen_attr_with_scales(DNNL_ARG_DST, per_tensor_mask,
+                    data_type::e8m0, {1, G}, quantization_mode::dynamic_fp)));
+    // The destination has no zero point.
+    primitive_attr zp_attr = gen_attr_with_scales(DNNL_ARG_DST,
+            per_tensor_mask, data_type::f32, {1, G},
+            quantization_mode::dynamic_fp);
+    zp_attr.set_zero_points_mask(DNNL_ARG_DST, 0);
+    CHECK_UNIMPL(matmul::primitive_desc(eng, a_md, b_md, c_md, zp_attr));
+
+    primitive_attr attr = gen_attr_with_scales(DNNL_ARG_DST, per_tensor_mask,
+            data_type::f32, {1, G}, quantization_mode::dynamic_fp);
+    auto pd = matmul::primitive_desc(eng, a_md, b_md, c_md, attr);
+
+    auto a = test::make_memory(a_md, eng);
+    auto b = test::make_memory(b_md, eng);
+    auto c = test::make_memory(c_md, eng);
+    auto c_scales = test::make_memory(
+            memory::desc({M * N / G}, data_type::f32, tag::a), eng);
+    fill_data<float>(M * K, a);
+    fill_data<float>(K * N, b);
+
+    stream s(eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, a}, {DNNL_ARG_WEIGHTS, b}, {DNNL_ARG_DST, c},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, c_scales}});
+    s.wait();
+
+    auto a_ptr = map_memory<float>(a);
+    auto b_ptr = map_memory<float>(b);
+    auto c_ptr = map_memory<int8_t>(c);
+    auto c_scales_ptr = map_memory<float>(c_scales);
+
+    std::vector<float> ref(N);
+    for (memory::dim m = 0; m < M; m++) {
+        for (memory::dim n = 0; n < N; n++) {
+            ref[n] = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref[n] += a_ptr[m * K + k] * b_ptr[k * N + n];
+        }
+        for (memory::dim g = 0; g < N / G; g++) {
+            float absmax = 0.f;
+            for (memory::dim n = g * G; n < (g + 1) * G; n++)
+                absmax = std::max(absmax, std::fabs(ref[n]));
+            const float scale = c_scales_ptr[m * (N / G) + g];
+            ASSERT_NEAR(scale, absmax / 127.f, 1e-5f * absmax);
+            for (memory::dim n = g * G; n < (g + 1) * G; n++)
+                ASSERT_NEAR(c_ptr[m * N + n], ref[n] / scale, 1.f);
+        }
+    }
+}
+
 TEST_F(attr_quantization_test_t, TestPool) {
     // Datatype s8 is not supported in the Nvidia backend
     SKIP_IF_HIP(true, "Unsupported datatype for AMD");
@@ -35,6 +35,21 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
+    // Structured.
+    ASSERT_NO_THROW(md = memory::desc::structured({64, 128}, dt::s8, 2, 4));
+    // Invalid N:M patterns.
+    EXPECT_ANY_THROW(memory::desc::structured({64, 128}, dt::s8, 4, 4));
+    EXPECT_ANY_THROW(memory::desc::structured({64, 128}, dt::s8, 0, 4));
+    EXPECT_ANY_THROW(memory::desc::structured({128}, dt::s8, 2, 4));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(
+                            {64, 128}, dt::f32, 4, {16, 32}, dt::s32, dt::s32));
+    // Dimensions must be divisible by the block dimensions.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {64, 128}, dt::f32, 4, {16, 48}, dt::s32, dt::s32));
+    // The number of non-zero blocks cannot exceed the number of blocks.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {64, 128}, dt::f32, 17, {16, 32}, dt::s32, dt::s32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -94,6 +109,27 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
     ASSERT_NO_THROW(md1 = memory::desc::packed({64, 128}, dt::f32, nnz));
     ASSERT_NO_THROW(md2 = memory::desc::packed({64, 128}, dt::f32, nnz + 1));
     ASSERT_NE(md1, md2);
+
+    // Structured.
+
+    // Equal memory descriptors.
+    ASSERT_NO_THROW(md1 = memory::desc::structured({64, 128}, dt::s8, 2, 4));
+    ASSERT_NO_THROW(md2 = memory::desc::structured({64, 128}, dt::s8, 2, 4));
+    ASSERT_EQ(md1, md2);
+
+    // Different patterns with the same number of non-zero entries.
+    ASSERT_NO_THROW(md1 = memory::desc::structured({64, 128}, dt::s8, 2, 4));
+    ASSERT_NO_THROW(md2 = memory::desc::structured({64, 128}, dt::s8, 4, 8));
+    ASSERT_NE(md1, md2);
+
+    // BSR.
+
+    // Different block dimensions with the same number of non-zero entries.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr(
+                            {64, 128}, dt::f32, 4, {16, 32}, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr(
+                            {64, 128}, dt::f32, 4, {32, 16}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDQueries) {
@@ -139,6 +175,34 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
 
     ASSERT_EQ(md.get_nnz(), nnz);
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed);
+
+    // Structured.
+    ASSERT_NO_THROW(md = memory::desc::structured(dims, dt::s8, 2, 4));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), dt::s8);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), dims[0] * dims[1] / 2);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::structured);
+
+    // The tail group along the reduction dimension is accounted as a
+    // complete one.
+    ASSERT_NO_THROW(md = memory::desc::structured({10, 3}, dt::s8, 2, 4));
+    ASSERT_EQ(md.get_nnz(), 3 * 3 * 2);
+
+    // BSR.
+    const int nnz_blocks = 3;
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz_blocks,
+                            {16, 32}, indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    // The number of non-zero entries accounts for the whole blocks.
+    ASSERT_EQ(md.get_nnz(), nnz_blocks * 16 * 32);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -194,6 +258,27 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
 
     // Size of bitmask.
     ASSERT_EQ(md.get_size(2), 0u);
+
+    // Structured.
+
+    // The user-created memory descriptor for structured encoding cannot
+    // be queried for sizes either.
+    ASSERT_NO_THROW(md = memory::desc::structured({64, 128}, dt::s8, 2, 4));
+    // Size of values.
+    ASSERT_EQ(md.get_size(0), 0u);
+    // Size of bitmask.
+    ASSERT_EQ(md.get_size(1), 0u);
+
+    // BSR.
+    const int nnz_blocks = 3;
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz_blocks,
+                            {16, 32}, dt::s32, dt::s32));
+    // Size of values.
+    ASSERT_EQ(md.get_size(0), nnz_blocks * 16 * 32 * sizeof(float));
+    // Size of block column indices.
+    ASSERT_EQ(md.get_size(1), nnz_blocks * sizeof(int32_t));
+    // Size of block row pointers.
+    ASSERT_EQ(md.get_size(2), (64 / 16 + 1) * sizeof(int32_t));
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
@@ -332,6 +417,175 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestStructuredSparseMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    const memory::dim M = 16, K = 128, N = 64;
+    const memory::dim n = 2, m = 4;
+
+    auto src_md = memory::desc({M, K}, dt::u8, memory::format_tag::ab);
+    auto wei_md = memory::desc::structured({K, N}, dt::s8, n, m);
+    auto dst_md = memory::desc({M, N}, dt::s32, memory::format_tag::ab);
+
+    auto pd = matmul::primitive_desc(
+            eng, src_md, wei_md, dst_md, primitive_attr(), true);
+    SKIP_IF(!pd, "structured sparse weights are not supported");
+
+    const auto sparse_wei_md = pd.weights_desc();
+    ASSERT_EQ(sparse_wei_md.get_sparse_encoding(),
+            memory::sparse_encoding::structured);
+    ASSERT_EQ(sparse_wei_md.get_size(0),
+            (size_t)sparse_wei_md.get_nnz() * sizeof(int8_t));
+
+    std::vector<uint8_t> src(M * K);
+    std::vector<int8_t> wei(K * N);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = (uint8_t)(i % 7 + 1);
+    // Every group of `m` elements along K has more than `n` non-zero
+    // elements, so the reorder has to prune the smallest ones.
+    for (memory::dim k = 0; k < K; k++)
+        for (memory::dim j = 0; j < N; j++)
+            wei[k * N + j] = (int8_t)((k * 3 + j * 5) % 11 - 5);
+
+    // Reference: prune the dense weights by magnitude.
+    std::vector<int8_t> pruned_wei(wei);
+    for (memory::dim g = 0; g < K / m; g++)
+        for (memory::dim j = 0; j < N; j++) {
+            std::vector<bool> keep(m, false);
+            for (memory::dim t = 0; t < n; t++) {
+                memory::dim max_i = -1;
+                int max_v = 0;
+                for (memory::dim i = 0; i < m; i++) {
+                    const int v = std::abs(wei[(g * m + i) * N + j]);
+                    if (!keep[i] && v > max_v) {
+                        max_v = v;
+                        max_i = i;
+                    }
+                }
+                if (max_i >= 0) keep[max_i] = true;
+            }
+            for (memory::dim i = 0; i < m; i++)
+                if (!keep[i]) pruned_wei[(g * m + i) * N + j] = 0;
+        }
+
+    auto strm = make_stream(eng);
+
+    auto dense_wei_md = memory::desc({K, N}, dt::s8, memory::format_tag::ab);
+    memory dense_wei_mem(dense_wei_md, eng, wei.data());
+    memory sparse_wei_mem(sparse_wei_md, eng);
+    reorder(dense_wei_mem, sparse_wei_mem)
+            .execute(strm, dense_wei_mem, sparse_wei_mem);
+
+    memory src_mem(src_md, eng, src.data());
+    memory dst_mem(pd.dst_desc(), eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, sparse_wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    const int32_t *dst = (const int32_t *)dst_mem.get_data_handle();
+    for (memory::dim i = 0; i < M; i++)
+        for (memory::dim j = 0; j < N; j++) {
+            int32_t ref = 0;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src[i * K + k] * pruned_wei[k * N + j];
+            ASSERT_EQ(dst[i * N + j], ref) << "i: " << i << ", j: " << j;
+        }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestBsrSparseMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // M is not a multiple of the M blocking to cover the tail.
+    const memory::dim M = 80, K = 64, N = 96;
+    const memory::dim bk = 16, bn = 32;
+    const memory::dim KB = K / bk, NB = N / bn;
+
+    // Non-zero blocks form a checkerboard, the last block column is empty.
+    auto is_nz_block = [&](memory::dim kb, memory::dim nb) {
+        return (kb + nb) % 2 == 0 && nb != NB - 1;
+    };
+    std::vector<float> wei(K * N, 0.f);
+    memory::dim nnz_blocks = 0;
+    for (memory::dim kb = 0; kb < KB; kb++)
+        for (memory::dim nb = 0; nb < NB; nb++) {
+            if (!is_nz_block(kb, nb)) continue;
+            nnz_blocks++;
+            for (memory::dim k = kb * bk; k < (kb + 1) * bk; k++)
+                for (memory::dim j = nb * bn; j < (nb + 1) * bn; j++)
+                    wei[k * N + j] = (float)((k * 3 + j * 5) % 7 - 3);
+        }
+    std::vector<float> src(M * K);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = (float)(i % 5 - 2);
+
+    auto strm = make_stream(eng);
+
+    // The memory may have room for more blocks than the tensor has.
+    auto sparse_wei_md = memory::desc::bsr(
+            {K, N}, dt::f32, nnz_blocks + 1, {bk, bn}, dt::s32, dt::s32);
+    auto dense_wei_md = memory::desc({K, N}, dt::f32, memory::format_tag::ab);
+    memory dense_wei_mem(dense_wei_md, eng, wei.data());
+    memory sparse_wei_mem(sparse_wei_md, eng);
+    reorder(dense_wei_mem, sparse_wei_mem)
+            .execute(strm, dense_wei_mem, sparse_wei_mem);
+    strm.wait();
+
+    const int32_t *indices
+            = (const int32_t *)sparse_wei_mem.get_data_handle(1);
+    const int32_t *pointers
+            = (const int32_t *)sparse_wei_mem.get_data_handle(2);
+    ASSERT_EQ(pointers[0], 0);
+    ASSERT_EQ(pointers[KB], nnz_blocks);
+    for (memory::dim kb = 0; kb < KB; kb++) {
+        memory::dim nb = 0;
+        for (int32_t blk = pointers[kb]; blk < pointers[kb + 1]; blk++) {
+            while (!is_nz_block(kb, nb))
+                nb++;
+            ASSERT_EQ(indices[blk], nb);
+            nb++;
+        }
+    }
+
+    // The memory is too small for the tensor.
+    {
+        auto small_wei_md = memory::desc::bsr(
+                {K, N}, dt::f32, nnz_blocks - 1, {bk, bn}, dt::s32, dt::s32);
+        memory small_wei_mem(small_wei_md, eng);
+        EXPECT_ANY_THROW(reorder(dense_wei_mem, small_wei_mem)
+                                 .execute(strm, dense_wei_mem, small_wei_mem));
+    }
+
+    auto src_md = memory::desc({M, K}, dt::f32, memory::format_tag::ab);
+    auto dst_md = memory::desc({M, N}, dt::f32, memory::format_tag::ab);
+    auto pd = matmul::primitive_desc(eng, src_md, sparse_wei_md, dst_md);
+
+    memory src_mem(src_md, eng, src.data());
+    memory dst_mem(dst_md, eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, sparse_wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    // All the values are small integers, so the result is exact.
+    const float *dst = (const float *)dst_mem.get_data_handle();
+    for (memory::dim i = 0; i < M; i++)
+        for (memory::dim j = 0; j < N; j++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src[i * K + k] * wei[k * N + j];
+            ASSERT_EQ(dst[i * N + j], ref) << "i: " << i << ", j: " << j;
+        }
+}
+
 TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     engine eng = get_test_engine();
 
@@ -400,6 +400,10 @@ INSTANTIATE_TEST_SUITE_P(Test_Softmax_Forward_Float, softmax_test_t,
                         tag::nc, tag::cn, tag::undef, {2, 1000}, 1},
                 tp {inference, alg_softmax, dt::f32, dt::f32, dt::undef,
                         tag::nc, tag::any, tag::undef, {1, 13}, 1},
+                tp {inference, alg_softmax, dt::f32, dt::f32, dt::undef,
+                        tag::nc, tag::nc, tag::undef, {2, 65539}, 1},
+                tp {inference, alg_logsoftmax, dt::f32, dt::f32, dt::undef,
+                        tag::nc, tag::nc, tag::undef, {1, 65539}, 1},
                 tp {inference, alg_softmax, dt::f32, dt::f32, dt::undef,
                         tag::ncw, tag::ncw, tag::undef, {16, 257, 32}, 1},
                 tp {inference, alg_logsoftmax, dt::f32, dt::f32, dt::undef,